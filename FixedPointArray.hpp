@@ -0,0 +1,1334 @@
+/**
+ * @file FixedPointArray.hpp
+ * @author Robert Connor Luce
+ * @brief Header file for FixedPointArray class, a contiguous aligned container of fixed-point numbers with bulk arithmetic.
+ */
+#include <cstddef>
+#include <new>
+#include <algorithm>
+#include <memory>
+#include <span>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+#include <limits>
+#include <vector>
+#include "FixedPointNumber.hpp"
+#include "FixedPointSimd.hpp"
+#include "FixedPointDivisor.hpp"
+#include "FixedPointThreadPool.hpp"
+#ifndef FIXEDPOINTARRAY_HPP
+#define FIXEDPOINTARRAY_HPP
+/**
+ * @brief Class template for a contiguous, cache-line aligned array of fixed-point numbers.
+ * @details FixedPointNumber is exactly as wide as its storage integer, so the elements are the raw integers laid out
+ * back to back. The bulk operations work on spans, so they apply equally to arrays, slices of arrays and other
+ * contiguous buffers, and give the same results as the scalar operators element by element. Multiply, divide and
+ * shiftRight take the same FixedPointRounding as the scalar functions. Element-wise add, subtract, multiply,
+ * shiftRight, quantize, dequantize, exponential, logarithmBase2, sine, cosine and arcTangent2 run on the FixedPointSimd
+ * kernels, division by one value runs on a FixedPointDivisor, and the reductions split inputs of more than
+ * parallelThreshold elements per thread across the threads of fixedPointDefaultThreadPool().
+ * @tparam numberOfIntegerBits Number of bits allocated for the integer part.
+ * @tparam numberOfFractionalBits Number of bits allocated for the fractional part.
+ */
+template<int numberOfIntegerBits, int numberOfFractionalBits>
+class FixedPointArray
+{
+public:
+	using ValueType = FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>;
+	using StorageType = typename ValueType::StorageType;
+	using AccumulatorType = typename ValueType::AccumulatorType;
+	static constexpr std::size_t alignment = 64;
+	static constexpr std::size_t parallelThreshold = std::size_t(1) << 20;
+private:
+	ValueType* values;
+	std::size_t numberOfValues;
+	static ValueType* allocate(std::size_t numberOfValues);
+	static void deallocate(ValueType* values);
+	static void checkSizes(std::size_t size1, std::size_t size2);
+	static std::size_t numberOfThreadsFor(std::size_t numberOfValues);
+	template<typename ChunkFunction>
+	static void forEachChunk(std::size_t numberOfValues, std::size_t numberOfChunks, ChunkFunction chunkFunction);
+public:
+	FixedPointArray();
+	explicit FixedPointArray(std::size_t numberOfValues);
+	FixedPointArray(std::size_t numberOfValues, const ValueType &value);
+	FixedPointArray(std::initializer_list<ValueType> values);
+	explicit FixedPointArray(std::span<const ValueType> values);
+	FixedPointArray(const FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> &other);
+	FixedPointArray(FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> &&other) noexcept;
+	~FixedPointArray();
+	FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>& operator=(const FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> &other);
+	FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>& operator=(FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> &&other) noexcept;
+	std::size_t size() const;
+	bool empty() const;
+	ValueType* data();
+	const ValueType* data() const;
+	StorageType* rawData();
+	const StorageType* rawData() const;
+	ValueType* begin();
+	const ValueType* begin() const;
+	ValueType* end();
+	const ValueType* end() const;
+	ValueType& operator[](std::size_t index);
+	const ValueType& operator[](std::size_t index) const;
+	ValueType& at(std::size_t index);
+	const ValueType& at(std::size_t index) const;
+	static void add(std::span<const ValueType> values1, std::span<const ValueType> values2, std::span<ValueType> result);
+	static void add(std::span<const ValueType> values, const ValueType &value, std::span<ValueType> result);
+	static void subtract(std::span<const ValueType> values1, std::span<const ValueType> values2, std::span<ValueType> result);
+	static void subtract(std::span<const ValueType> values, const ValueType &value, std::span<ValueType> result);
+	template<FixedPointRounding rounding = FixedPointRounding::RoundHalfUp>
+	static void multiply(std::span<const ValueType> values1, std::span<const ValueType> values2, std::span<ValueType> result);
+	template<FixedPointRounding rounding = FixedPointRounding::RoundHalfUp>
+	static void multiply(std::span<const ValueType> values, const ValueType &value, std::span<ValueType> result);
+	template<FixedPointRounding rounding = FixedPointRounding::RoundHalfUp>
+	static void divide(std::span<const ValueType> values1, std::span<const ValueType> values2, std::span<ValueType> result);
+	template<FixedPointRounding rounding = FixedPointRounding::RoundHalfUp>
+	static void divide(std::span<const ValueType> values, const ValueType &value, std::span<ValueType> result);
+	static void negate(std::span<const ValueType> values, std::span<ValueType> result);
+	static void absoluteValue(std::span<const ValueType> values, std::span<ValueType> result);
+	static void shiftLeft(std::span<const ValueType> values, int amountToShift, std::span<ValueType> result);
+	template<FixedPointRounding rounding = FixedPointRounding::RoundHalfUp>
+	static void shiftRight(std::span<const ValueType> values, int amountToShift, std::span<ValueType> result);
+	static double quantizationScale(std::span<const float> values);
+	template<FixedPointRounding rounding = FixedPointRounding::RoundHalfUp>
+	static void quantize(std::span<const float> values, double scale, std::span<ValueType> result);
+	static void dequantize(std::span<const ValueType> values, double scale, std::span<float> result);
+	static void squareRoot(std::span<const ValueType> values, std::span<ValueType> result);
+	static void reciprocalSquareRoot(std::span<const ValueType> values, std::span<ValueType> result);
+	static void exponential(std::span<const ValueType> values, std::span<ValueType> result);
+	static void logarithmBase2(std::span<const ValueType> values, std::span<ValueType> result);
+	static void sine(std::span<const ValueType> values, std::span<ValueType> result);
+	static void cosine(std::span<const ValueType> values, std::span<ValueType> result);
+	static void arcTangent2(std::span<const ValueType> ordinates, std::span<const ValueType> abscissas, std::span<ValueType> result);
+	static ValueType maximum(std::span<const ValueType> values);
+	static ValueType minimum(std::span<const ValueType> values);
+	static std::pair<ValueType, ValueType> minimumAndMaximum(std::span<const ValueType> values);
+	static std::size_t indexOf(std::span<const ValueType> values, const ValueType &value);
+	static std::size_t indexOfMaximum(std::span<const ValueType> values);
+	static std::size_t indexOfMinimum(std::span<const ValueType> values);
+	template<int resultIntegerBits = numberOfIntegerBits, int resultFractionalBits = numberOfFractionalBits, FixedPointRounding rounding = FixedPointRounding::RoundHalfUp>
+	static FixedPointNumber<resultIntegerBits, resultFractionalBits> dot(std::span<const ValueType> values1, std::span<const ValueType> values2);
+	template<int resultIntegerBits = numberOfIntegerBits, int resultFractionalBits = numberOfFractionalBits, FixedPointRounding rounding = FixedPointRounding::RoundHalfUp>
+	static FixedPointNumber<resultIntegerBits, resultFractionalBits> sum(std::span<const ValueType> values);
+	FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> absoluteValue() const;
+	FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> operator+(const FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> &other) const;
+	FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> operator+(const ValueType &value) const;
+	FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> operator-() const;
+	FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> operator-(const FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> &other) const;
+	FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> operator-(const ValueType &value) const;
+	FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> operator*(const FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> &other) const;
+	FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> operator*(const ValueType &value) const;
+	FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> operator/(const FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> &other) const;
+	FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> operator/(const ValueType &value) const;
+	FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> operator<<(const int amountToShift) const;
+	FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> operator>>(const int amountToShift) const;
+	void operator+=(const FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> &other);
+	void operator+=(const ValueType &value);
+	void operator-=(const FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> &other);
+	void operator-=(const ValueType &value);
+	void operator*=(const FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> &other);
+	void operator*=(const ValueType &value);
+	void operator/=(const FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> &other);
+	void operator/=(const ValueType &value);
+	void operator<<=(const int amountToShift);
+	void operator>>=(const int amountToShift);
+};
+/**
+ * @brief Allocate uninitialized, aligned storage for a number of values.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param numberOfValues
+ * @return ValueType*
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+typename FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::ValueType* FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::allocate(std::size_t numberOfValues)
+{
+	if (numberOfValues == 0)
+	{
+		return nullptr;
+	}
+	return static_cast<ValueType*>(::operator new(numberOfValues * sizeof(ValueType), std::align_val_t(alignment)));
+}
+/**
+ * @brief Release storage obtained from allocate.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::deallocate(ValueType* values)
+{
+	if (values != nullptr)
+	{
+		::operator delete(values, std::align_val_t(alignment));
+	}
+}
+/**
+ * @brief Check that two operands of a bulk operation have the same number of elements.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param size1
+ * @param size2
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::checkSizes(std::size_t size1, std::size_t size2)
+{
+	if (size1 != size2)
+	{
+		throw std::invalid_argument("Fixed-point spans must have the same number of elements.");
+	}
+}
+/**
+ * @brief Construct an empty Fixed Point Array object.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::FixedPointArray()
+{
+	this->values = nullptr;
+	this->numberOfValues = 0;
+}
+/**
+ * @brief Construct a new Fixed Point Array object of zeros.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param numberOfValues
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::FixedPointArray(std::size_t numberOfValues)
+{
+	this->values = allocate(numberOfValues);
+	this->numberOfValues = numberOfValues;
+	std::uninitialized_value_construct_n(this->values, numberOfValues);
+}
+/**
+ * @brief Construct a new Fixed Point Array object with every element set to one value.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param numberOfValues
+ * @param value
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::FixedPointArray(std::size_t numberOfValues, const ValueType &value)
+{
+	this->values = allocate(numberOfValues);
+	this->numberOfValues = numberOfValues;
+	std::uninitialized_fill_n(this->values, numberOfValues, value);
+}
+/**
+ * @brief Construct a new Fixed Point Array object from a list of values.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::FixedPointArray(std::initializer_list<ValueType> values)
+{
+	this->values = allocate(values.size());
+	this->numberOfValues = values.size();
+	std::uninitialized_copy(values.begin(), values.end(), this->values);
+}
+/**
+ * @brief Construct a new Fixed Point Array object as a copy of a span of values.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::FixedPointArray(std::span<const ValueType> values)
+{
+	this->values = allocate(values.size());
+	this->numberOfValues = values.size();
+	std::uninitialized_copy(values.begin(), values.end(), this->values);
+}
+/**
+ * @brief Construct a new Fixed Point Array object as a copy of another.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param other
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::FixedPointArray(const FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> &other)
+{
+	this->values = allocate(other.numberOfValues);
+	this->numberOfValues = other.numberOfValues;
+	std::uninitialized_copy(other.begin(), other.end(), this->values);
+}
+/**
+ * @brief Construct a new Fixed Point Array object by taking the storage of another, which is left empty.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param other
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::FixedPointArray(FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> &&other) noexcept
+{
+	this->values = other.values;
+	this->numberOfValues = other.numberOfValues;
+	other.values = nullptr;
+	other.numberOfValues = 0;
+}
+/**
+ * @brief Destroy the Fixed Point Array object.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::~FixedPointArray()
+{
+	deallocate(this->values);
+}
+/**
+ * @brief Replace the contents with a copy of another array.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param other
+ * @return FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>&
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>& FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::operator=(const FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> &other)
+{
+	if (this != &other)
+	{
+		if (this->numberOfValues != other.numberOfValues)
+		{
+			ValueType* values = allocate(other.numberOfValues);
+			deallocate(this->values);
+			this->values = values;
+			this->numberOfValues = other.numberOfValues;
+		}
+		std::copy(other.begin(), other.end(), this->values);
+	}
+	return *this;
+}
+/**
+ * @brief Replace the contents by taking the storage of another array, which is left empty.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param other
+ * @return FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>&
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>& FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::operator=(FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> &&other) noexcept
+{
+	if (this != &other)
+	{
+		deallocate(this->values);
+		this->values = other.values;
+		this->numberOfValues = other.numberOfValues;
+		other.values = nullptr;
+		other.numberOfValues = 0;
+	}
+	return *this;
+}
+/**
+ * @brief Get the number of elements.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @return std::size_t
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+std::size_t FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::size() const
+{
+	return this->numberOfValues;
+}
+/**
+ * @brief Check whether the array has no elements.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @return true If the array is empty.
+ * @return false If the array has elements.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+bool FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::empty() const
+{
+	return this->numberOfValues == 0;
+}
+/**
+ * @brief Get a pointer to the first element.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @return ValueType*
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+typename FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::ValueType* FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::data()
+{
+	return this->values;
+}
+/**
+ * @brief Get a pointer to the first element.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @return const ValueType*
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+const typename FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::ValueType* FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::data() const
+{
+	return this->values;
+}
+/**
+ * @brief Get a pointer to the raw two's complement values of the elements.
+ * @details FixedPointNumber is a standard-layout type whose only member is its raw value, so each element is
+ * pointer-interconvertible with its raw value.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @return StorageType*
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+typename FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::StorageType* FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::rawData()
+{
+	static_assert(sizeof(ValueType) == sizeof(StorageType) && std::is_standard_layout_v<ValueType>, "FixedPointNumber must be layout-compatible with its storage.");
+	return reinterpret_cast<StorageType*>(this->values);
+}
+/**
+ * @brief Get a pointer to the raw two's complement values of the elements.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @return const StorageType*
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+const typename FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::StorageType* FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::rawData() const
+{
+	static_assert(sizeof(ValueType) == sizeof(StorageType) && std::is_standard_layout_v<ValueType>, "FixedPointNumber must be layout-compatible with its storage.");
+	return reinterpret_cast<const StorageType*>(this->values);
+}
+/**
+ * @brief Get an iterator to the first element.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @return ValueType*
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+typename FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::ValueType* FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::begin()
+{
+	return this->values;
+}
+/**
+ * @brief Get an iterator to the first element.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @return const ValueType*
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+const typename FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::ValueType* FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::begin() const
+{
+	return this->values;
+}
+/**
+ * @brief Get an iterator past the last element.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @return ValueType*
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+typename FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::ValueType* FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::end()
+{
+	return this->values + this->numberOfValues;
+}
+/**
+ * @brief Get an iterator past the last element.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @return const ValueType*
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+const typename FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::ValueType* FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::end() const
+{
+	return this->values + this->numberOfValues;
+}
+/**
+ * @brief Access an element without bounds checking.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param index
+ * @return ValueType&
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+typename FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::ValueType& FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::operator[](std::size_t index)
+{
+	return this->values[index];
+}
+/**
+ * @brief Access an element without bounds checking.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param index
+ * @return const ValueType&
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+const typename FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::ValueType& FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::operator[](std::size_t index) const
+{
+	return this->values[index];
+}
+/**
+ * @brief Access an element, throwing if the index is out of range.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param index
+ * @return ValueType&
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+typename FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::ValueType& FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::at(std::size_t index)
+{
+	if (index >= this->numberOfValues)
+	{
+		throw std::out_of_range("Fixed-point array index out of range.");
+	}
+	return this->values[index];
+}
+/**
+ * @brief Access an element, throwing if the index is out of range.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param index
+ * @return const ValueType&
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+const typename FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::ValueType& FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::at(std::size_t index) const
+{
+	if (index >= this->numberOfValues)
+	{
+		throw std::out_of_range("Fixed-point array index out of range.");
+	}
+	return this->values[index];
+}
+/**
+ * @brief Add two spans element by element.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values1
+ * @param values2
+ * @param result Receives the sums; may alias either input.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::add(std::span<const ValueType> values1, std::span<const ValueType> values2, std::span<ValueType> result)
+{
+	FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::add(values1, values2, result);
+}
+/**
+ * @brief Add one value to every element of a span.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param value
+ * @param result Receives the sums; may alias the input.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::add(std::span<const ValueType> values, const ValueType &value, std::span<ValueType> result)
+{
+	checkSizes(values.size(), result.size());
+	const ValueType broadcastValue = value;
+	for (std::size_t index = 0; index < result.size(); index++)
+	{
+		result[index] = values[index] + broadcastValue;
+	}
+}
+/**
+ * @brief Subtract two spans element by element.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values1
+ * @param values2
+ * @param result Receives the differences; may alias either input.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::subtract(std::span<const ValueType> values1, std::span<const ValueType> values2, std::span<ValueType> result)
+{
+	FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::subtract(values1, values2, result);
+}
+/**
+ * @brief Subtract one value from every element of a span.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param value
+ * @param result Receives the differences; may alias the input.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::subtract(std::span<const ValueType> values, const ValueType &value, std::span<ValueType> result)
+{
+	checkSizes(values.size(), result.size());
+	const ValueType broadcastValue = value;
+	for (std::size_t index = 0; index < result.size(); index++)
+	{
+		result[index] = values[index] - broadcastValue;
+	}
+}
+/**
+ * @brief Multiply two spans element by element.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam rounding The rounding applied to every product.
+ * @param values1
+ * @param values2
+ * @param result Receives the products; may alias either input.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <FixedPointRounding rounding>
+void FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::multiply(std::span<const ValueType> values1, std::span<const ValueType> values2, std::span<ValueType> result)
+{
+	FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::template multiply<rounding>(values1, values2, result);
+}
+/**
+ * @brief Multiply every element of a span by one value.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam rounding The rounding applied to every product.
+ * @param values
+ * @param value
+ * @param result Receives the products; may alias the input.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <FixedPointRounding rounding>
+void FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::multiply(std::span<const ValueType> values, const ValueType &value, std::span<ValueType> result)
+{
+	checkSizes(values.size(), result.size());
+	const ValueType broadcastValue = value;
+	for (std::size_t index = 0; index < result.size(); index++)
+	{
+		result[index] = values[index].template multiply<rounding>(broadcastValue);
+	}
+}
+/**
+ * @brief Divide two spans element by element.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam rounding The rounding applied to every quotient.
+ * @param values1
+ * @param values2
+ * @param result Receives the quotients; may alias either input.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <FixedPointRounding rounding>
+void FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::divide(std::span<const ValueType> values1, std::span<const ValueType> values2, std::span<ValueType> result)
+{
+	checkSizes(values1.size(), values2.size());
+	checkSizes(values1.size(), result.size());
+	for (std::size_t index = 0; index < result.size(); index++)
+	{
+		result[index] = values1[index].template divide<rounding>(values2[index]);
+	}
+}
+/**
+ * @brief Divide every element of a span by one value.
+ * @details The reciprocal of the value is computed once by a FixedPointDivisor, so every quotient is a multiply and
+ * shifts instead of a division.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam rounding The rounding applied to every quotient.
+ * @param values
+ * @param value
+ * @param result Receives the quotients; may alias the input.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <FixedPointRounding rounding>
+void FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::divide(std::span<const ValueType> values, const ValueType &value, std::span<ValueType> result)
+{
+	checkSizes(values.size(), result.size());
+	const FixedPointDivisor<numberOfIntegerBits, numberOfFractionalBits> divisor(value);
+	divisor.template divide<rounding>(values, result);
+}
+/**
+ * @brief Negate every element of a span.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param result Receives the negations; may alias the input.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::negate(std::span<const ValueType> values, std::span<ValueType> result)
+{
+	checkSizes(values.size(), result.size());
+	for (std::size_t index = 0; index < result.size(); index++)
+	{
+		result[index] = -values[index];
+	}
+}
+/**
+ * @brief Take the absolute value of every element of a span.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param result Receives the absolute values; may alias the input.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::absoluteValue(std::span<const ValueType> values, std::span<ValueType> result)
+{
+	checkSizes(values.size(), result.size());
+	for (std::size_t index = 0; index < result.size(); index++)
+	{
+		result[index] = values[index].absoluteValue();
+	}
+}
+/**
+ * @brief Shift every element of a span left by the same number of bits.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param amountToShift
+ * @param result Receives the shifted values; may alias the input.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::shiftLeft(std::span<const ValueType> values, int amountToShift, std::span<ValueType> result)
+{
+	checkSizes(values.size(), result.size());
+	for (std::size_t index = 0; index < result.size(); index++)
+	{
+		result[index] = values[index] << amountToShift;
+	}
+}
+/**
+ * @brief Shift every element of a span right by the same number of bits.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam rounding The rounding applied to the discarded bits of every element.
+ * @param values
+ * @param amountToShift
+ * @param result Receives the shifted values; may alias the input.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <FixedPointRounding rounding>
+void FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::shiftRight(std::span<const ValueType> values, int amountToShift, std::span<ValueType> result)
+{
+	checkSizes(values.size(), result.size());
+	FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::template shiftRight<rounding>(values, amountToShift, result);
+}
+/**
+ * @brief Choose the per-tensor scale that maps the largest magnitude among the values onto the largest representable
+ * number, so that quantize uses the whole range of the format without saturating.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @return double The scale for quantize and dequantize, or 1 if every value is zero or the span is empty. NaN values
+ * are ignored.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+double FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::quantizationScale(std::span<const float> values)
+{
+	float largestMagnitude = 0.0f;
+	for (float value : values)
+	{
+		float magnitude = value < 0.0f ? -value : value;
+		largestMagnitude = magnitude > largestMagnitude ? magnitude : largestMagnitude;
+	}
+	if (largestMagnitude == 0.0f)
+	{
+		return 1.0;
+	}
+	return static_cast<double>(largestMagnitude) / ValueType::fromDouble(std::numeric_limits<double>::infinity()).toDouble();
+}
+/**
+ * @brief Quantize floats to fixed point with a per-tensor scale, so that each element becomes values[i] / scale.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam rounding The rounding applied to every quantized value.
+ * @param values
+ * @param scale Real value of one unit of the fixed-point format, such as the one from quantizationScale.
+ * @param result Receives the quantized values; values out of range saturate and NaN becomes zero.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <FixedPointRounding rounding>
+void FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::quantize(std::span<const float> values, double scale, std::span<ValueType> result)
+{
+	checkSizes(values.size(), result.size());
+	FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::template quantize<rounding>(values, scale, result);
+}
+/**
+ * @brief Dequantize fixed point to floats with a per-tensor scale, so that each element becomes values[i] * scale.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param scale Real value of one unit of the fixed-point format.
+ * @param result Receives the products, each rounded once to float.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::dequantize(std::span<const ValueType> values, double scale, std::span<float> result)
+{
+	checkSizes(values.size(), result.size());
+	FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::dequantize(values, scale, result);
+}
+/**
+ * @brief Take the square root of every element of a span.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param result Receives the square roots; may alias the input.
+ * @throws std::domain_error If an element is negative.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::squareRoot(std::span<const ValueType> values, std::span<ValueType> result)
+{
+	checkSizes(values.size(), result.size());
+	for (std::size_t index = 0; index < result.size(); index++)
+	{
+		result[index] = values[index].squareRoot();
+	}
+}
+/**
+ * @brief Take the reciprocal square root of every element of a span.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param result Receives the reciprocal square roots; may alias the input.
+ * @throws std::domain_error If an element is not positive.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::reciprocalSquareRoot(std::span<const ValueType> values, std::span<ValueType> result)
+{
+	checkSizes(values.size(), result.size());
+	for (std::size_t index = 0; index < result.size(); index++)
+	{
+		result[index] = values[index].reciprocalSquareRoot();
+	}
+}
+/**
+ * @brief Raise e to the power of every element of a span.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param result Receives the powers; may alias the input.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::exponential(std::span<const ValueType> values, std::span<ValueType> result)
+{
+	checkSizes(values.size(), result.size());
+	FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::exponential(values, result);
+}
+/**
+ * @brief Take the base-2 logarithm of every element of a span.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param result Receives the logarithms; may alias the input.
+ * @throws std::domain_error If an element is not positive.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::logarithmBase2(std::span<const ValueType> values, std::span<ValueType> result)
+{
+	checkSizes(values.size(), result.size());
+	FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::logarithmBase2(values, result);
+}
+/**
+ * @brief Take the sine of every element of a span of radians.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param result Receives the sines; may alias the input.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::sine(std::span<const ValueType> values, std::span<ValueType> result)
+{
+	checkSizes(values.size(), result.size());
+	FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::sine(values, result);
+}
+/**
+ * @brief Take the cosine of every element of a span of radians.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param result Receives the cosines; may alias the input.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::cosine(std::span<const ValueType> values, std::span<ValueType> result)
+{
+	checkSizes(values.size(), result.size());
+	FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::cosine(values, result);
+}
+/**
+ * @brief Take the angle in radians of every point of two spans of coordinates.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param ordinates The y coordinates.
+ * @param abscissas The x coordinates.
+ * @param result Receives the angles; may alias either input.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::arcTangent2(std::span<const ValueType> ordinates, std::span<const ValueType> abscissas, std::span<ValueType> result)
+{
+	checkSizes(ordinates.size(), abscissas.size());
+	checkSizes(ordinates.size(), result.size());
+	FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::arcTangent2(ordinates, abscissas, result);
+}
+/**
+ * @brief Decide how many threads a reduction over a number of values should use.
+ * @details Each thread gets at least parallelThreshold elements, so small and medium inputs stay on the calling thread.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param numberOfValues
+ * @return std::size_t
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+std::size_t FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::numberOfThreadsFor(std::size_t numberOfValues)
+{
+	std::size_t numberOfThreads = std::min(fixedPointDefaultThreadPool().getNumberOfThreads(), numberOfValues / parallelThreshold);
+	return std::max<std::size_t>(numberOfThreads, 1);
+}
+/**
+ * @brief Split a range of values into contiguous chunks of nearly equal size and process the chunks as tasks of
+ * fixedPointDefaultThreadPool().
+ * @details Chunk boundaries depend only on the number of values and the number of chunks, so callers that combine the
+ * per-chunk results in chunk order get deterministic results.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam ChunkFunction Callable as chunkFunction(chunk, firstIndex, numberOfValuesInChunk).
+ * @param numberOfValues
+ * @param numberOfChunks At least 1.
+ * @param chunkFunction
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <typename ChunkFunction>
+void FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::forEachChunk(std::size_t numberOfValues, std::size_t numberOfChunks, ChunkFunction chunkFunction)
+{
+	std::size_t chunkSize = (numberOfValues + numberOfChunks - 1) / numberOfChunks;
+	fixedPointDefaultThreadPool().parallelFor(numberOfChunks, [numberOfValues, chunkSize, &chunkFunction](std::size_t chunk)
+	{
+		chunkFunction(chunk, chunk * chunkSize, std::min(chunkSize, numberOfValues - chunk * chunkSize));
+	});
+}
+/**
+ * @brief Find the smallest and largest elements of a span.
+ * @details Inputs large enough are split into one contiguous chunk per thread, and the chunk results are combined in
+ * order, so the result does not depend on the number of threads.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values Must not be empty.
+ * @return std::pair<ValueType, ValueType> The minimum followed by the maximum.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+std::pair<typename FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::ValueType, typename FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::ValueType> FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::minimumAndMaximum(std::span<const ValueType> values)
+{
+	std::size_t numberOfThreads = numberOfThreadsFor(values.size());
+	std::vector<std::pair<ValueType, ValueType>> chunkResults(numberOfThreads);
+	forEachChunk(values.size(), numberOfThreads, [values, &chunkResults](std::size_t chunk, std::size_t firstIndex, std::size_t numberOfValuesInChunk)
+	{
+		FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::minimumAndMaximum(values.subspan(firstIndex, numberOfValuesInChunk), chunkResults[chunk].first, chunkResults[chunk].second);
+	});
+	std::pair<ValueType, ValueType> result = chunkResults[0];
+	for (std::size_t chunk = 1; chunk < numberOfThreads; chunk++)
+	{
+		result.first = std::min(result.first, chunkResults[chunk].first);
+		result.second = std::max(result.second, chunkResults[chunk].second);
+	}
+	return result;
+}
+/**
+ * @brief Find the largest element of a span.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @return ValueType
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+typename FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::ValueType FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::maximum(std::span<const ValueType> values)
+{
+	if (values.empty())
+	{
+		throw std::runtime_error("Cannot determine maximum of an empty array.");
+	}
+	return minimumAndMaximum(values).second;
+}
+/**
+ * @brief Find the smallest element of a span.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @return ValueType
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+typename FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::ValueType FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::minimum(std::span<const ValueType> values)
+{
+	if (values.empty())
+	{
+		throw std::runtime_error("Cannot determine minimum of an empty array.");
+	}
+	return minimumAndMaximum(values).first;
+}
+/**
+ * @brief Find the first element of a span equal to a value.
+ * @details Large inputs are searched one chunk per thread; the earliest chunk with a match decides the result.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param value
+ * @return std::size_t Index of the first match, or values.size() if there is none.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+std::size_t FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::indexOf(std::span<const ValueType> values, const ValueType &value)
+{
+	std::size_t numberOfThreads = numberOfThreadsFor(values.size());
+	std::vector<std::size_t> chunkResults(numberOfThreads, values.size());
+	forEachChunk(values.size(), numberOfThreads, [values, &value, &chunkResults](std::size_t chunk, std::size_t firstIndex, std::size_t numberOfValuesInChunk)
+	{
+		std::size_t index = FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::indexOf(values.subspan(firstIndex, numberOfValuesInChunk), value);
+		if (index < numberOfValuesInChunk)
+		{
+			chunkResults[chunk] = firstIndex + index;
+		}
+	});
+	return *std::min_element(chunkResults.begin(), chunkResults.end());
+}
+/**
+ * @brief Compute the dot product of two spans, rounding once into the result format.
+ * @details The exact products are summed in the wide AccumulatorType, one chunk per thread for large inputs, and the
+ * total is rounded once and saturated to the range of the result format, so the result does not depend on the order
+ * of accumulation or the number of threads.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam resultIntegerBits Number of integer bits of the result; defaults to the format of the operands.
+ * @tparam resultFractionalBits Number of fractional bits of the result; defaults to the format of the operands.
+ * @tparam rounding The rounding applied to the discarded fractional bits.
+ * @param values1
+ * @param values2
+ * @return FixedPointNumber<resultIntegerBits, resultFractionalBits>
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <int resultIntegerBits, int resultFractionalBits, FixedPointRounding rounding>
+FixedPointNumber<resultIntegerBits, resultFractionalBits> FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::dot(std::span<const ValueType> values1, std::span<const ValueType> values2)
+{
+	checkSizes(values1.size(), values2.size());
+	std::size_t numberOfThreads = numberOfThreadsFor(values1.size());
+	std::vector<AccumulatorType> chunkResults(numberOfThreads);
+	forEachChunk(values1.size(), numberOfThreads, [values1, values2, &chunkResults](std::size_t chunk, std::size_t firstIndex, std::size_t numberOfValuesInChunk)
+	{
+		chunkResults[chunk] = FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::dot(values1.subspan(firstIndex, numberOfValuesInChunk), values2.subspan(firstIndex, numberOfValuesInChunk));
+	});
+	AccumulatorType accumulator = static_cast<AccumulatorType>(0);
+	for (const AccumulatorType &chunkResult : chunkResults)
+	{
+		accumulator = static_cast<AccumulatorType>(accumulator + chunkResult);
+	}
+	return FixedPointNumber<resultIntegerBits, resultFractionalBits>::template fromScaledInteger<rounding>(accumulator, 2 * numberOfFractionalBits);
+}
+/**
+ * @brief Compute the sum of a span, rounding once into the result format.
+ * @details The sum is exact in the wide AccumulatorType, so unlike repeated operator+ it cannot wrap; only the final
+ * conversion rounds and saturates.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam resultIntegerBits Number of integer bits of the result; defaults to the format of the operands.
+ * @tparam resultFractionalBits Number of fractional bits of the result; defaults to the format of the operands.
+ * @tparam rounding The rounding applied to the discarded fractional bits.
+ * @param values
+ * @return FixedPointNumber<resultIntegerBits, resultFractionalBits>
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <int resultIntegerBits, int resultFractionalBits, FixedPointRounding rounding>
+FixedPointNumber<resultIntegerBits, resultFractionalBits> FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::sum(std::span<const ValueType> values)
+{
+	std::size_t numberOfThreads = numberOfThreadsFor(values.size());
+	std::vector<AccumulatorType> chunkResults(numberOfThreads);
+	forEachChunk(values.size(), numberOfThreads, [values, &chunkResults](std::size_t chunk, std::size_t firstIndex, std::size_t numberOfValuesInChunk)
+	{
+		chunkResults[chunk] = FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::sum(values.subspan(firstIndex, numberOfValuesInChunk));
+	});
+	AccumulatorType accumulator = static_cast<AccumulatorType>(0);
+	for (const AccumulatorType &chunkResult : chunkResults)
+	{
+		accumulator = static_cast<AccumulatorType>(accumulator + chunkResult);
+	}
+	return FixedPointNumber<resultIntegerBits, resultFractionalBits>::template fromScaledInteger<rounding>(accumulator, numberOfFractionalBits);
+}
+/**
+ * @brief Find the index of the largest element of a span, the first one if it occurs more than once.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @return std::size_t
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+std::size_t FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::indexOfMaximum(std::span<const ValueType> values)
+{
+	return indexOf(values, maximum(values));
+}
+/**
+ * @brief Find the index of the smallest element of a span, the first one if it occurs more than once.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @return std::size_t
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+std::size_t FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::indexOfMinimum(std::span<const ValueType> values)
+{
+	return indexOf(values, minimum(values));
+}
+/**
+ * @brief Get the absolute value of every element.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @return FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::absoluteValue() const
+{
+	FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> result(this->numberOfValues);
+	absoluteValue(*this, result);
+	return result;
+}
+/**
+ * @brief Add two arrays element by element.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param other
+ * @return FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::operator+(const FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> &other) const
+{
+	FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> result(this->numberOfValues);
+	add(*this, other, result);
+	return result;
+}
+/**
+ * @brief Add one value to every element.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param value
+ * @return FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::operator+(const ValueType &value) const
+{
+	FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> result(this->numberOfValues);
+	add(*this, value, result);
+	return result;
+}
+/**
+ * @brief Negate every element.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @return FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::operator-() const
+{
+	FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> result(this->numberOfValues);
+	negate(*this, result);
+	return result;
+}
+/**
+ * @brief Subtract two arrays element by element.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param other
+ * @return FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::operator-(const FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> &other) const
+{
+	FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> result(this->numberOfValues);
+	subtract(*this, other, result);
+	return result;
+}
+/**
+ * @brief Subtract one value from every element.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param value
+ * @return FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::operator-(const ValueType &value) const
+{
+	FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> result(this->numberOfValues);
+	subtract(*this, value, result);
+	return result;
+}
+/**
+ * @brief Multiply two arrays element by element.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param other
+ * @return FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::operator*(const FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> &other) const
+{
+	FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> result(this->numberOfValues);
+	multiply(*this, other, result);
+	return result;
+}
+/**
+ * @brief Multiply every element by one value.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param value
+ * @return FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::operator*(const ValueType &value) const
+{
+	FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> result(this->numberOfValues);
+	multiply(*this, value, result);
+	return result;
+}
+/**
+ * @brief Divide two arrays element by element.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param other
+ * @return FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::operator/(const FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> &other) const
+{
+	FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> result(this->numberOfValues);
+	divide(*this, other, result);
+	return result;
+}
+/**
+ * @brief Divide every element by one value.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param value
+ * @return FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::operator/(const ValueType &value) const
+{
+	FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> result(this->numberOfValues);
+	divide(*this, value, result);
+	return result;
+}
+/**
+ * @brief Shift every element left.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param amountToShift
+ * @return FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::operator<<(const int amountToShift) const
+{
+	FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> result(this->numberOfValues);
+	shiftLeft(*this, amountToShift, result);
+	return result;
+}
+/**
+ * @brief Shift every element right.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param amountToShift
+ * @return FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::operator>>(const int amountToShift) const
+{
+	FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> result(this->numberOfValues);
+	shiftRight(*this, amountToShift, result);
+	return result;
+}
+/**
+ * @brief Add another array to this one element by element in place.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param other
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::operator+=(const FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> &other)
+{
+	add(*this, other, *this);
+}
+/**
+ * @brief Add one value to every element in place.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param value
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::operator+=(const ValueType &value)
+{
+	add(*this, value, *this);
+}
+/**
+ * @brief Subtract another array from this one element by element in place.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param other
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::operator-=(const FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> &other)
+{
+	subtract(*this, other, *this);
+}
+/**
+ * @brief Subtract one value from every element in place.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param value
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::operator-=(const ValueType &value)
+{
+	subtract(*this, value, *this);
+}
+/**
+ * @brief Multiply this array by another element by element in place.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param other
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::operator*=(const FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> &other)
+{
+	multiply(*this, other, *this);
+}
+/**
+ * @brief Multiply every element by one value in place.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param value
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::operator*=(const ValueType &value)
+{
+	multiply(*this, value, *this);
+}
+/**
+ * @brief Divide this array by another element by element in place.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param other
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::operator/=(const FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> &other)
+{
+	divide(*this, other, *this);
+}
+/**
+ * @brief Divide every element by one value in place.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param value
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::operator/=(const ValueType &value)
+{
+	divide(*this, value, *this);
+}
+/**
+ * @brief Shift every element left in place.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param amountToShift
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::operator<<=(const int amountToShift)
+{
+	shiftLeft(*this, amountToShift, *this);
+}
+/**
+ * @brief Shift every element right in place.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param amountToShift
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointArray<numberOfIntegerBits, numberOfFractionalBits>::operator>>=(const int amountToShift)
+{
+	shiftRight(*this, amountToShift, *this);
+}
+#endif
@@ -0,0 +1,596 @@
+/**
+ * @file FixedPointArrayTest.cpp
+ * @author Robert Connor Luce
+ * @brief Tests for FixedPointArray, FixedPointSimd, FixedPointGemm, FixedPointParallel, FixedPointLUT and FixedPointDivisor classes.
+ */
+#include "FixedPointArray.hpp"
+#include "FixedPointGemm.hpp"
+#include "FixedPointParallel.hpp"
+#include "FixedPointLUT.hpp"
+#include "FixedPointDivisor.hpp"
+#include <numeric>
+#include <vector>
+#include <limits>
+#include <iostream>
+#include <fstream>
+#ifndef TEST_OUTPUT_FILE
+#define TEST_OUTPUT_FILE "FixedPointArrayTestOutput.txt"
+#endif
+std::ofstream file = std::ofstream(TEST_OUTPUT_FILE);
+/**
+ * @brief Convert the elements of a span of fixed-point numbers to a bracketed, comma-separated string.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @return std::string
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+std::string arrayToString(std::span<const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>> values)
+{
+	std::string valuesString = "[";
+	for (std::size_t index = 0; index < values.size(); index++)
+	{
+		valuesString += (index == 0 ? "" : ", ") + values[index].toString();
+	}
+	return valuesString + "]";
+}
+/**
+ * @brief Tests the layout, alignment and element access of FixedPointArray.
+ */
+void testLayoutAndAccess()
+{
+	try
+	{
+		FixedPointArray<16, 16> values = {FixedPointNumber<16, 16>("1.5"), FixedPointNumber<16, 16>("-2.25"), FixedPointNumber<16, 16>(3)};
+		values[2] = FixedPointNumber<16, 16>("0.125");
+		bool isAligned = reinterpret_cast<std::uintptr_t>(values.data()) % FixedPointArray<16, 16>::alignment == 0;
+		std::cout << "Layout and access: " << arrayToString<16, 16>(values) << ", raw " << values.rawData()[1] << ", aligned " << (isAligned ? "true" : "false") << std::endl;
+		file << "Layout and access: " << arrayToString<16, 16>(values) << ", raw " << values.rawData()[1] << ", aligned " << (isAligned ? "true" : "false") << std::endl;
+		std::cout << "Out of range access: ";
+		file << "Out of range access: ";
+		values.at(3);
+		std::cout << "nothing" << std::endl;
+		file << "nothing" << std::endl;
+	}
+	catch(const std::exception& exception)
+	{
+		std::cout << exception.what() << std::endl;
+		file << exception.what() << std::endl;
+	}
+}
+/**
+ * @brief Tests the element-wise arithmetic operators of FixedPointArray.
+ */
+void testElementWiseArithmetic()
+{
+	try
+	{
+		FixedPointArray<16, 16> values1 = {FixedPointNumber<16, 16>("1.5"), FixedPointNumber<16, 16>("-2.25"), FixedPointNumber<16, 16>("10")};
+		FixedPointArray<16, 16> values2 = {FixedPointNumber<16, 16>("0.5"), FixedPointNumber<16, 16>("4"), FixedPointNumber<16, 16>("-3")};
+		std::cout << "Element-wise sum: " << arrayToString<16, 16>(values1 + values2) << std::endl;
+		file << "Element-wise sum: " << arrayToString<16, 16>(values1 + values2) << std::endl;
+		std::cout << "Element-wise difference: " << arrayToString<16, 16>(values1 - values2) << std::endl;
+		file << "Element-wise difference: " << arrayToString<16, 16>(values1 - values2) << std::endl;
+		std::cout << "Element-wise product: " << arrayToString<16, 16>(values1 * values2) << std::endl;
+		file << "Element-wise product: " << arrayToString<16, 16>(values1 * values2) << std::endl;
+		std::cout << "Element-wise quotient: " << arrayToString<16, 16>(values1 / values2) << std::endl;
+		file << "Element-wise quotient: " << arrayToString<16, 16>(values1 / values2) << std::endl;
+	}
+	catch(const std::exception& exception)
+	{
+		std::cerr << exception.what() << std::endl;
+		file << exception.what() << std::endl;
+	}
+}
+/**
+ * @brief Tests broadcasting a scalar across a FixedPointArray.
+ */
+void testScalarBroadcast()
+{
+	try
+	{
+		FixedPointArray<16, 16> values = {FixedPointNumber<16, 16>("1.5"), FixedPointNumber<16, 16>("-2.25"), FixedPointNumber<16, 16>("10")};
+		values *= FixedPointNumber<16, 16>("2");
+		values += FixedPointNumber<16, 16>("0.25");
+		std::cout << "Scalar broadcast: [1.5, -2.25, 10] * 2 + 0.25 = " << arrayToString<16, 16>(values) << std::endl;
+		file << "Scalar broadcast: [1.5, -2.25, 10] * 2 + 0.25 = " << arrayToString<16, 16>(values) << std::endl;
+	}
+	catch(const std::exception& exception)
+	{
+		std::cerr << exception.what() << std::endl;
+		file << exception.what() << std::endl;
+	}
+}
+/**
+ * @brief Tests negation, absolute value and shifts over a span of a FixedPointArray.
+ */
+void testUnaryOperationsOnSpans()
+{
+	try
+	{
+		FixedPointArray<8, 8> values = {FixedPointNumber<8, 8>("1.5"), FixedPointNumber<8, 8>("-2.25"), FixedPointNumber<8, 8>("3"), FixedPointNumber<8, 8>("-4")};
+		std::span<FixedPointNumber<8, 8>> lastTwoValues = std::span<FixedPointNumber<8, 8>>(values).subspan(2);
+		FixedPointArray<8, 8>::negate(lastTwoValues, lastTwoValues);
+		std::cout << "Negate last two: " << arrayToString<8, 8>(values) << std::endl;
+		file << "Negate last two: " << arrayToString<8, 8>(values) << std::endl;
+		std::cout << "Absolute value: " << arrayToString<8, 8>(values.absoluteValue()) << std::endl;
+		file << "Absolute value: " << arrayToString<8, 8>(values.absoluteValue()) << std::endl;
+		std::cout << "Shift left by 2: " << arrayToString<8, 8>(values << 2) << std::endl;
+		file << "Shift left by 2: " << arrayToString<8, 8>(values << 2) << std::endl;
+	}
+	catch(const std::exception& exception)
+	{
+		std::cerr << exception.what() << std::endl;
+		file << exception.what() << std::endl;
+	}
+}
+/**
+ * @brief Tests that bulk operations reject spans of different sizes.
+ */
+void testMismatchedSizes()
+{
+	try
+	{
+		FixedPointArray<16, 16> values1(3);
+		FixedPointArray<16, 16> values2(4);
+		std::cout << "Mismatched sizes: ";
+		file << "Mismatched sizes: ";
+		values1 += values2;
+		std::cout << "nothing" << std::endl;
+		file << "nothing" << std::endl;
+	}
+	catch(const std::exception& exception)
+	{
+		std::cout << exception.what() << std::endl;
+		file << exception.what() << std::endl;
+	}
+}
+/**
+ * @brief Check that every instruction set gives the same results as the scalar reference for one format.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @return true If every kernel matches the scalar reference.
+ * @return false If any kernel differs.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+bool simdKernelsMatchScalar()
+{
+	using Simd = FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>;
+	using StorageType = typename FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::StorageType;
+	const std::size_t numberOfValues = 1000;
+	FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> values1(numberOfValues);
+	FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> values2(numberOfValues);
+	FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> positiveValues(numberOfValues);
+	uint64_t state = 0x9E3779B97F4A7C15ULL;
+	for (std::size_t index = 0; index < numberOfValues; index++)
+	{
+		state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+		values1[index] = FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::fromRawValue(static_cast<StorageType>(state >> 17));
+		values2[index] = FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::fromRawValue(static_cast<StorageType>(state >> 41));
+		StorageType rawValue = values1[index].getRawValue();
+		positiveValues[index] = FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::fromRawValue(static_cast<StorageType>(rawValue > 0 ? rawValue : (~rawValue | 1)));
+	}
+	FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> scalarResult(numberOfValues);
+	FixedPointArray<numberOfIntegerBits, numberOfFractionalBits> vectorResult(numberOfValues);
+	bool isMatching = true;
+	for (FixedPointInstructionSet instructionSet : {FixedPointInstructionSet::Sse41, FixedPointInstructionSet::Avx2, FixedPointInstructionSet::Avx512})
+	{
+		Simd::add(values1, values2, scalarResult, FixedPointInstructionSet::Scalar);
+		Simd::add(values1, values2, vectorResult, instructionSet);
+		isMatching = isMatching && std::equal(scalarResult.begin(), scalarResult.end(), vectorResult.begin());
+		Simd::subtract(values1, values2, scalarResult, FixedPointInstructionSet::Scalar);
+		Simd::subtract(values1, values2, vectorResult, instructionSet);
+		isMatching = isMatching && std::equal(scalarResult.begin(), scalarResult.end(), vectorResult.begin());
+		Simd::multiply(values1, values2, scalarResult, FixedPointInstructionSet::Scalar);
+		Simd::multiply(values1, values2, vectorResult, instructionSet);
+		isMatching = isMatching && std::equal(scalarResult.begin(), scalarResult.end(), vectorResult.begin());
+		Simd::template multiply<FixedPointRounding::Truncate>(values1, values2, scalarResult, FixedPointInstructionSet::Scalar);
+		Simd::template multiply<FixedPointRounding::Truncate>(values1, values2, vectorResult, instructionSet);
+		isMatching = isMatching && std::equal(scalarResult.begin(), scalarResult.end(), vectorResult.begin());
+		Simd::template multiply<FixedPointRounding::Floor>(values1, values2, scalarResult, FixedPointInstructionSet::Scalar);
+		Simd::template multiply<FixedPointRounding::Floor>(values1, values2, vectorResult, instructionSet);
+		isMatching = isMatching && std::equal(scalarResult.begin(), scalarResult.end(), vectorResult.begin());
+		Simd::template multiply<FixedPointRounding::RoundHalfEven>(values1, values2, scalarResult, FixedPointInstructionSet::Scalar);
+		Simd::template multiply<FixedPointRounding::RoundHalfEven>(values1, values2, vectorResult, instructionSet);
+		isMatching = isMatching && std::equal(scalarResult.begin(), scalarResult.end(), vectorResult.begin());
+		for (int amountToShift : {1, 3, numberOfIntegerBits + numberOfFractionalBits})
+		{
+			Simd::template shiftRight<FixedPointRounding::Truncate>(values1, amountToShift, scalarResult, FixedPointInstructionSet::Scalar);
+			Simd::template shiftRight<FixedPointRounding::Truncate>(values1, amountToShift, vectorResult, instructionSet);
+			isMatching = isMatching && std::equal(scalarResult.begin(), scalarResult.end(), vectorResult.begin());
+			Simd::template shiftRight<FixedPointRounding::RoundHalfUp>(values1, amountToShift, scalarResult, FixedPointInstructionSet::Scalar);
+			Simd::template shiftRight<FixedPointRounding::RoundHalfUp>(values1, amountToShift, vectorResult, instructionSet);
+			isMatching = isMatching && std::equal(scalarResult.begin(), scalarResult.end(), vectorResult.begin());
+			Simd::template shiftRight<FixedPointRounding::RoundHalfEven>(values1, amountToShift, scalarResult, FixedPointInstructionSet::Scalar);
+			Simd::template shiftRight<FixedPointRounding::RoundHalfEven>(values1, amountToShift, vectorResult, instructionSet);
+			isMatching = isMatching && std::equal(scalarResult.begin(), scalarResult.end(), vectorResult.begin());
+		}
+		std::vector<float> scalarFloats(numberOfValues);
+		std::vector<float> vectorFloats(numberOfValues);
+		Simd::dequantize(values1, 0.75, scalarFloats, FixedPointInstructionSet::Scalar);
+		Simd::dequantize(values1, 0.75, vectorFloats, instructionSet);
+		isMatching = isMatching && scalarFloats == vectorFloats;
+		Simd::quantize(scalarFloats, 0.3, scalarResult, FixedPointInstructionSet::Scalar);
+		Simd::quantize(scalarFloats, 0.3, vectorResult, instructionSet);
+		isMatching = isMatching && std::equal(scalarResult.begin(), scalarResult.end(), vectorResult.begin());
+		Simd::template quantize<FixedPointRounding::RoundHalfEven>(scalarFloats, 1.5, scalarResult, FixedPointInstructionSet::Scalar);
+		Simd::template quantize<FixedPointRounding::RoundHalfEven>(scalarFloats, 1.5, vectorResult, instructionSet);
+		isMatching = isMatching && std::equal(scalarResult.begin(), scalarResult.end(), vectorResult.begin());
+		Simd::template quantize<FixedPointRounding::Floor>(scalarFloats, 1.5, scalarResult, FixedPointInstructionSet::Scalar);
+		Simd::template quantize<FixedPointRounding::Floor>(scalarFloats, 1.5, vectorResult, instructionSet);
+		isMatching = isMatching && std::equal(scalarResult.begin(), scalarResult.end(), vectorResult.begin());
+		Simd::addSaturated(values1, values2, scalarResult, FixedPointInstructionSet::Scalar);
+		Simd::addSaturated(values1, values2, vectorResult, instructionSet);
+		isMatching = isMatching && std::equal(scalarResult.begin(), scalarResult.end(), vectorResult.begin());
+		Simd::subtractSaturated(values1, values2, scalarResult, FixedPointInstructionSet::Scalar);
+		Simd::subtractSaturated(values1, values2, vectorResult, instructionSet);
+		isMatching = isMatching && std::equal(scalarResult.begin(), scalarResult.end(), vectorResult.begin());
+		FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> scalarMinimum, scalarMaximum, vectorMinimum, vectorMaximum;
+		Simd::minimumAndMaximum(values1, scalarMinimum, scalarMaximum, FixedPointInstructionSet::Scalar);
+		Simd::minimumAndMaximum(values1, vectorMinimum, vectorMaximum, instructionSet);
+		isMatching = isMatching && scalarMinimum == vectorMinimum && scalarMaximum == vectorMaximum;
+		isMatching = isMatching && Simd::indexOf(values1, values1[997], FixedPointInstructionSet::Scalar) == Simd::indexOf(values1, values1[997], instructionSet);
+		isMatching = isMatching && Simd::dot(values1, values2, FixedPointInstructionSet::Scalar) == Simd::dot(values1, values2, instructionSet);
+		isMatching = isMatching && Simd::sum(values1, FixedPointInstructionSet::Scalar) == Simd::sum(values1, instructionSet);
+		Simd::sine(values1, scalarResult, FixedPointInstructionSet::Scalar);
+		Simd::sine(values1, vectorResult, instructionSet);
+		isMatching = isMatching && std::equal(scalarResult.begin(), scalarResult.end(), vectorResult.begin());
+		Simd::cosine(values1, scalarResult, FixedPointInstructionSet::Scalar);
+		Simd::cosine(values1, vectorResult, instructionSet);
+		isMatching = isMatching && std::equal(scalarResult.begin(), scalarResult.end(), vectorResult.begin());
+		Simd::exponential(values1, scalarResult, FixedPointInstructionSet::Scalar);
+		Simd::exponential(values1, vectorResult, instructionSet);
+		isMatching = isMatching && std::equal(scalarResult.begin(), scalarResult.end(), vectorResult.begin());
+		Simd::logarithmBase2(positiveValues, scalarResult, FixedPointInstructionSet::Scalar);
+		Simd::logarithmBase2(positiveValues, vectorResult, instructionSet);
+		isMatching = isMatching && std::equal(scalarResult.begin(), scalarResult.end(), vectorResult.begin());
+		Simd::arcTangent2(values1, values2, scalarResult, FixedPointInstructionSet::Scalar);
+		Simd::arcTangent2(values1, values2, vectorResult, instructionSet);
+		isMatching = isMatching && std::equal(scalarResult.begin(), scalarResult.end(), vectorResult.begin());
+		const FixedPointDivisor<numberOfIntegerBits, numberOfFractionalBits> oddDivisor(FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::fromRawValue(static_cast<StorageType>(values2[0].getRawValue() | 1)));
+		const FixedPointDivisor<numberOfIntegerBits, numberOfFractionalBits> evenDivisor(FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::fromRawValue(static_cast<StorageType>(-6)));
+		for (std::size_t index = 0; index < numberOfValues; index++)
+		{
+			scalarResult[index] = values1[index] / oddDivisor.getDivisor();
+		}
+		oddDivisor.divide(values1, vectorResult, instructionSet);
+		isMatching = isMatching && std::equal(scalarResult.begin(), scalarResult.end(), vectorResult.begin());
+		for (std::size_t index = 0; index < numberOfValues; index++)
+		{
+			scalarResult[index] = values1[index].template divide<FixedPointRounding::RoundHalfEven>(evenDivisor.getDivisor());
+		}
+		evenDivisor.template divide<FixedPointRounding::RoundHalfEven>(values1, vectorResult, instructionSet);
+		isMatching = isMatching && std::equal(scalarResult.begin(), scalarResult.end(), vectorResult.begin());
+	}
+	return isMatching;
+}
+/**
+ * @brief Tests that the SIMD kernels are bit-exact with the scalar reference.
+ */
+void testSimdKernelsMatchScalar()
+{
+	try
+	{
+		std::cout << "SIMD kernels match scalar: <1, 15> " << (simdKernelsMatchScalar<1, 15>() ? "true" : "false") << ", <8, 8> " << (simdKernelsMatchScalar<8, 8>() ? "true" : "false") << ", <16, 16> " << (simdKernelsMatchScalar<16, 16>() ? "true" : "false") << ", <8, 24> " << (simdKernelsMatchScalar<8, 24>() ? "true" : "false") << std::endl;
+		file << "SIMD kernels match scalar: <1, 15> " << (simdKernelsMatchScalar<1, 15>() ? "true" : "false") << ", <8, 8> " << (simdKernelsMatchScalar<8, 8>() ? "true" : "false") << ", <16, 16> " << (simdKernelsMatchScalar<16, 16>() ? "true" : "false") << ", <8, 24> " << (simdKernelsMatchScalar<8, 24>() ? "true" : "false") << std::endl;
+	}
+	catch(const std::exception& exception)
+	{
+		std::cerr << exception.what() << std::endl;
+		file << exception.what() << std::endl;
+	}
+}
+/**
+ * @brief Tests saturating addition, which clamps instead of wrapping.
+ */
+void testSaturatedAddition()
+{
+	try
+	{
+		FixedPointArray<8, 8> values1 = {FixedPointNumber<8, 8>("100"), FixedPointNumber<8, 8>("-100"), FixedPointNumber<8, 8>("1.5")};
+		FixedPointArray<8, 8> values2 = {FixedPointNumber<8, 8>("100"), FixedPointNumber<8, 8>("-100"), FixedPointNumber<8, 8>("2.25")};
+		FixedPointArray<8, 8> result(values1.size());
+		FixedPointSimd<8, 8>::addSaturated(values1, values2, result);
+		std::cout << "Saturated addition: [100, -100, 1.5] + [100, -100, 2.25] = " << arrayToString<8, 8>(result) << ", wrapping gives " << arrayToString<8, 8>(values1 + values2) << std::endl;
+		file << "Saturated addition: [100, -100, 1.5] + [100, -100, 2.25] = " << arrayToString<8, 8>(result) << ", wrapping gives " << arrayToString<8, 8>(values1 + values2) << std::endl;
+	}
+	catch(const std::exception& exception)
+	{
+		std::cerr << exception.what() << std::endl;
+		file << exception.what() << std::endl;
+	}
+}
+/**
+ * @brief Tests quantizing floats with a per-tensor scale and dequantizing them back.
+ */
+void testQuantization()
+{
+	try
+	{
+		std::vector<float> values = {0.5f, -1.25f, 3.0f, 0.1f, std::numeric_limits<float>::quiet_NaN()};
+		double scale = FixedPointArray<1, 7>::quantizationScale(values);
+		FixedPointArray<1, 7> quantizedValues(values.size());
+		FixedPointArray<1, 7>::quantize(values, scale, quantizedValues);
+		std::vector<float> dequantizedValues(values.size());
+		FixedPointArray<1, 7>::dequantize(quantizedValues, scale, dequantizedValues);
+		std::cout << "Quantization: [0.5, -1.25, 3, 0.1, nan] with scale " << scale << " = " << arrayToString<1, 7>(quantizedValues) << " as <1, 7>, dequantized [" << dequantizedValues[0] << ", " << dequantizedValues[1] << ", " << dequantizedValues[2] << ", " << dequantizedValues[3] << ", " << dequantizedValues[4] << "]" << std::endl;
+		file << "Quantization: [0.5, -1.25, 3, 0.1, nan] with scale " << scale << " = " << arrayToString<1, 7>(quantizedValues) << " as <1, 7>, dequantized [" << dequantizedValues[0] << ", " << dequantizedValues[1] << ", " << dequantizedValues[2] << ", " << dequantizedValues[3] << ", " << dequantizedValues[4] << "]" << std::endl;
+	}
+	catch(const std::exception& exception)
+	{
+		std::cerr << exception.what() << std::endl;
+		file << exception.what() << std::endl;
+	}
+}
+/**
+ * @brief Tests the bulk square root, exponential, logarithm and trigonometric functions.
+ */
+void testMathFunctions()
+{
+	try
+	{
+		FixedPointArray<16, 16> values = {FixedPointNumber<16, 16>("0.25"), FixedPointNumber<16, 16>("1"), FixedPointNumber<16, 16>("2"), FixedPointNumber<16, 16>("3.14159"), FixedPointNumber<16, 16>("10")};
+		FixedPointArray<16, 16> abscissas = {FixedPointNumber<16, 16>("1"), FixedPointNumber<16, 16>("-1"), FixedPointNumber<16, 16>("0"), FixedPointNumber<16, 16>("-3.14159"), FixedPointNumber<16, 16>("0.5")};
+		FixedPointArray<16, 16> result(values.size());
+		FixedPointArray<16, 16>::squareRoot(values, result);
+		std::cout << "Square root: " << arrayToString<16, 16>(result) << std::endl;
+		file << "Square root: " << arrayToString<16, 16>(result) << std::endl;
+		FixedPointArray<16, 16>::exponential(values, result);
+		std::cout << "Exponential: " << arrayToString<16, 16>(result) << std::endl;
+		file << "Exponential: " << arrayToString<16, 16>(result) << std::endl;
+		FixedPointArray<16, 16>::logarithmBase2(values, result);
+		std::cout << "Logarithm base 2: " << arrayToString<16, 16>(result) << std::endl;
+		file << "Logarithm base 2: " << arrayToString<16, 16>(result) << std::endl;
+		FixedPointArray<16, 16>::sine(values, result);
+		std::cout << "Sine: " << arrayToString<16, 16>(result) << std::endl;
+		file << "Sine: " << arrayToString<16, 16>(result) << std::endl;
+		FixedPointArray<16, 16>::cosine(values, result);
+		std::cout << "Cosine: " << arrayToString<16, 16>(result) << std::endl;
+		file << "Cosine: " << arrayToString<16, 16>(result) << std::endl;
+		FixedPointArray<16, 16>::arcTangent2(values, abscissas, result);
+		std::cout << "Arc tangent 2: " << arrayToString<16, 16>(result) << std::endl;
+		file << "Arc tangent 2: " << arrayToString<16, 16>(result) << std::endl;
+	}
+	catch(const std::exception& exception)
+	{
+		std::cerr << exception.what() << std::endl;
+		file << exception.what() << std::endl;
+	}
+}
+/**
+ * @brief Logistic sigmoid, usable in constant expressions through the constexpr exponential of FixedPointNumber.
+ * @param value
+ * @return double
+ */
+constexpr double sigmoid(double value)
+{
+	return 1.0 / (1.0 + FixedPointNumber<16, 16>::fromDouble(-value).exponential().toDouble());
+}
+/**
+ * @brief Tests lookup tables of the sigmoid built at compile time, evaluated one by one and over a FixedPointArray.
+ */
+void testLookupTable()
+{
+	try
+	{
+		constexpr FixedPointLUT<8, 8, 6> linearTable(sigmoid, FixedPointNumber<8, 8>(-8), FixedPointNumber<8, 8>(8));
+		constexpr FixedPointLUT<8, 8, 6, FixedPointInterpolation::Quadratic> quadraticTable(sigmoid, FixedPointNumber<8, 8>(-8), FixedPointNumber<8, 8>(8));
+		constexpr FixedPointNumber<8, 8> middleValue = linearTable.evaluate(FixedPointNumber<8, 8>(0));
+		FixedPointArray<8, 8> values = {FixedPointNumber<8, 8>("-10"), FixedPointNumber<8, 8>("-2.5"), FixedPointNumber<8, 8>("0.7"), FixedPointNumber<8, 8>("3.1"), FixedPointNumber<8, 8>("8")};
+		FixedPointArray<8, 8> linearResult(values.size());
+		FixedPointArray<8, 8> quadraticResult(values.size());
+		linearTable.evaluate(values, linearResult);
+		quadraticTable.evaluate(values, quadraticResult);
+		std::cout << "Lookup table: sigmoid(0) = " << middleValue.toString() << " at compile time, sigmoid " << arrayToString<8, 8>(values) << " = " << arrayToString<8, 8>(linearResult) << " (linear), " << arrayToString<8, 8>(quadraticResult) << " (quadratic)" << std::endl;
+		file << "Lookup table: sigmoid(0) = " << middleValue.toString() << " at compile time, sigmoid " << arrayToString<8, 8>(values) << " = " << arrayToString<8, 8>(linearResult) << " (linear), " << arrayToString<8, 8>(quadraticResult) << " (quadratic)" << std::endl;
+		std::cout << "Lookup table domain [0, 3]: ";
+		file << "Lookup table domain [0, 3]: ";
+		FixedPointLUT<8, 8, 6> invalidTable(sigmoid, FixedPointNumber<8, 8>(0), FixedPointNumber<8, 8>(3));
+		std::cout << "nothing, maximum " << invalidTable.maximum().toString() << std::endl;
+		file << "nothing, maximum " << invalidTable.maximum().toString() << std::endl;
+	}
+	catch(const std::exception& exception)
+	{
+		std::cout << exception.what() << std::endl;
+		file << exception.what() << std::endl;
+	}
+}
+/**
+ * @brief Tests a divisor with a precomputed reciprocal against the division operator, and a divisor of zero.
+ */
+void testDivisor()
+{
+	try
+	{
+		constexpr FixedPointNumber<16, 16> oneThird = FixedPointDivisor<16, 16>(FixedPointNumber<16, 16>(3)).divide(FixedPointNumber<16, 16>(1));
+		const FixedPointDivisor<16, 16> divisor(FixedPointNumber<16, 16>("-0.75"));
+		FixedPointArray<16, 16> values = {FixedPointNumber<16, 16>("1"), FixedPointNumber<16, 16>("-2.5"), FixedPointNumber<16, 16>("7"), FixedPointNumber<16, 16>("0.3"), FixedPointNumber<16, 16>("30000")};
+		FixedPointArray<16, 16> result(values.size());
+		divisor.divide(values, result);
+		std::cout << "Divisor: 1 / 3 = " << oneThird.toString() << " at compile time, " << arrayToString<16, 16>(values) << " / -0.75 = " << arrayToString<16, 16>(result) << std::endl;
+		file << "Divisor: 1 / 3 = " << oneThird.toString() << " at compile time, " << arrayToString<16, 16>(values) << " / -0.75 = " << arrayToString<16, 16>(result) << std::endl;
+		std::cout << "Divisor of zero: ";
+		file << "Divisor of zero: ";
+		FixedPointDivisor<16, 16> zeroDivisor(FixedPointNumber<16, 16>(0));
+		std::cout << "nothing, divisor " << zeroDivisor.getDivisor().toString() << std::endl;
+		file << "nothing, divisor " << zeroDivisor.getDivisor().toString() << std::endl;
+	}
+	catch(const std::exception& exception)
+	{
+		std::cout << exception.what() << std::endl;
+		file << exception.what() << std::endl;
+	}
+}
+/**
+ * @brief Tests the minimum, maximum and index reductions over spans.
+ */
+void testMinimumAndMaximum()
+{
+	try
+	{
+		FixedPointArray<16, 16> values = {FixedPointNumber<16, 16>("1.5"), FixedPointNumber<16, 16>("-2.25"), FixedPointNumber<16, 16>("7.75"), FixedPointNumber<16, 16>("-2.25"), FixedPointNumber<16, 16>("7.75"), FixedPointNumber<16, 16>("0")};
+		std::pair<FixedPointNumber<16, 16>, FixedPointNumber<16, 16>> minimumAndMaximum = FixedPointArray<16, 16>::minimumAndMaximum(values);
+		std::cout << "Minimum and maximum: " << arrayToString<16, 16>(values) << " has minimum " << minimumAndMaximum.first.toString() << " at " << FixedPointArray<16, 16>::indexOfMinimum(values) << ", maximum " << minimumAndMaximum.second.toString() << " at " << FixedPointArray<16, 16>::indexOfMaximum(values) << ", 0 at " << FixedPointArray<16, 16>::indexOf(values, FixedPointNumber<16, 16>(0)) << ", 3 at " << FixedPointArray<16, 16>::indexOf(values, FixedPointNumber<16, 16>(3)) << ", empty: ";
+		file << "Minimum and maximum: " << arrayToString<16, 16>(values) << " has minimum " << minimumAndMaximum.first.toString() << " at " << FixedPointArray<16, 16>::indexOfMinimum(values) << ", maximum " << minimumAndMaximum.second.toString() << " at " << FixedPointArray<16, 16>::indexOfMaximum(values) << ", 0 at " << FixedPointArray<16, 16>::indexOf(values, FixedPointNumber<16, 16>(0)) << ", 3 at " << FixedPointArray<16, 16>::indexOf(values, FixedPointNumber<16, 16>(3)) << ", empty: ";
+		FixedPointArray<16, 16>::maximum(FixedPointArray<16, 16>());
+		std::cout << "nothing" << std::endl;
+		file << "nothing" << std::endl;
+	}
+	catch(const std::exception& exception)
+	{
+		std::cout << exception.what() << std::endl;
+		file << exception.what() << std::endl;
+	}
+}
+/**
+ * @brief Tests the wide-accumulator dot product and sum, which round once and do not wrap.
+ */
+void testDotAndSum()
+{
+	try
+	{
+		FixedPointArray<8, 8> values1 = {FixedPointNumber<8, 8>("100"), FixedPointNumber<8, 8>("100"), FixedPointNumber<8, 8>("-60"), FixedPointNumber<8, 8>("0.01")};
+		FixedPointArray<8, 8> values2 = {FixedPointNumber<8, 8>("0.5"), FixedPointNumber<8, 8>("0.75"), FixedPointNumber<8, 8>("2"), FixedPointNumber<8, 8>("0.01")};
+		FixedPointNumber<8, 8> wrappingSum{};
+		for (const FixedPointNumber<8, 8> &value : values1)
+		{
+			wrappingSum += value;
+		}
+		std::cout << "Dot and sum: sum " << FixedPointArray<8, 8>::sum(values1).toString() << " as <8, 8>, " << FixedPointArray<8, 8>::sum<16, 8>(values1).toString() << " as <16, 8>, += gives " << wrappingSum.toString() << ", dot " << FixedPointArray<8, 8>::dot(values1, values2).toString() << ", squared norm " << FixedPointArray<8, 8>::dot<24, 16>(values1, values1).toString() << " as <24, 16>" << std::endl;
+		file << "Dot and sum: sum " << FixedPointArray<8, 8>::sum(values1).toString() << " as <8, 8>, " << FixedPointArray<8, 8>::sum<16, 8>(values1).toString() << " as <16, 8>, += gives " << wrappingSum.toString() << ", dot " << FixedPointArray<8, 8>::dot(values1, values2).toString() << ", squared norm " << FixedPointArray<8, 8>::dot<24, 16>(values1, values1).toString() << " as <24, 16>" << std::endl;
+	}
+	catch(const std::exception& exception)
+	{
+		std::cerr << exception.what() << std::endl;
+		file << exception.what() << std::endl;
+	}
+}
+/**
+ * @brief Tests the matrix multiply with transposed operands, a bias and a requantized result, and checks that every
+ * instruction set gives the same result as the scalar micro-kernel.
+ */
+void testMatrixMultiply()
+{
+	try
+	{
+		FixedPointArray<8, 8> matrixA = {FixedPointNumber<8, 8>("1"), FixedPointNumber<8, 8>("2"), FixedPointNumber<8, 8>("3"), FixedPointNumber<8, 8>("-0.5"), FixedPointNumber<8, 8>("0.25"), FixedPointNumber<8, 8>("100")};
+		FixedPointArray<8, 8> matrixBTransposed = {FixedPointNumber<8, 8>("1"), FixedPointNumber<8, 8>("0"), FixedPointNumber<8, 8>("2"), FixedPointNumber<8, 8>("0.5"), FixedPointNumber<8, 8>("1.5"), FixedPointNumber<8, 8>("2")};
+		FixedPointArray<8, 8> bias = {FixedPointNumber<8, 8>("0.125"), FixedPointNumber<8, 8>("-1")};
+		std::vector<FixedPointNumber<16, 8>> matrixC(4);
+		FixedPointGemm<8, 8>::multiply<16, 8>(2, 2, 3, matrixA, FixedPointTranspose::None, matrixBTransposed, FixedPointTranspose::Transpose, matrixC, bias);
+		const std::size_t size = 37;
+		FixedPointArray<16, 16> values1(size * size);
+		FixedPointArray<16, 16> values2(size * size);
+		uint64_t state = 0x9E3779B97F4A7C15ULL;
+		for (std::size_t index = 0; index < values1.size(); index++)
+		{
+			state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+			values1[index] = FixedPointNumber<16, 16>::fromRawValue(static_cast<int32_t>(state >> 17));
+			values2[index] = FixedPointNumber<16, 16>::fromRawValue(static_cast<int32_t>(state >> 41));
+		}
+		FixedPointArray<16, 16> scalarResult(size * size);
+		FixedPointArray<16, 16> vectorResult(size * size);
+		FixedPointGemm<16, 16>::multiply(size, size, size, values1, FixedPointTranspose::Transpose, values2, FixedPointTranspose::None, scalarResult, {}, FixedPointInstructionSet::Scalar);
+		bool isMatching = true;
+		for (FixedPointInstructionSet instructionSet : {FixedPointInstructionSet::Sse41, FixedPointInstructionSet::Avx2, FixedPointInstructionSet::Avx512})
+		{
+			FixedPointGemm<16, 16>::multiply(size, size, size, values1, FixedPointTranspose::Transpose, values2, FixedPointTranspose::None, vectorResult, {}, instructionSet);
+			isMatching = isMatching && std::equal(scalarResult.begin(), scalarResult.end(), vectorResult.begin());
+		}
+		std::cout << "Matrix multiply: [[1, 2, 3], [-0.5, 0.25, 100]] * [[1, 0, 2], [0.5, 1.5, 2]]^T + [0.125, -1] = " << arrayToString<16, 8>(matrixC) << " as <16, 8>, SIMD matches scalar " << (isMatching ? "true" : "false") << std::endl;
+		file << "Matrix multiply: [[1, 2, 3], [-0.5, 0.25, 100]] * [[1, 0, 2], [0.5, 1.5, 2]]^T + [0.125, -1] = " << arrayToString<16, 8>(matrixC) << " as <16, 8>, SIMD matches scalar " << (isMatching ? "true" : "false") << std::endl;
+	}
+	catch(const std::exception& exception)
+	{
+		std::cerr << exception.what() << std::endl;
+		file << exception.what() << std::endl;
+	}
+}
+/**
+ * @brief Tests the parallel algorithms on pools of one and four threads with a small grain size, and checks that they
+ * give the same results as the sequential standard algorithms.
+ */
+void testParallelAlgorithms()
+{
+	try
+	{
+		FixedPointArray<8, 8> small = {FixedPointNumber<8, 8>("1.5"), FixedPointNumber<8, 8>("-2.25"), FixedPointNumber<8, 8>("7.75"), FixedPointNumber<8, 8>("0.5"), FixedPointNumber<8, 8>("-3")};
+		FixedPointThreadPool singleThreadPool(1);
+		FixedPointArray<8, 8> smallScan(small.size());
+		FixedPointParallel<8, 8>::inclusiveScan(small, smallScan, std::plus<>(), 2, singleThreadPool);
+		std::string smallScanString = arrayToString<8, 8>(smallScan);
+		FixedPointParallel<8, 8>::exclusiveScan(small, smallScan, FixedPointNumber<8, 8>("10"), std::plus<>(), 2, singleThreadPool);
+		std::string smallExclusiveScanString = arrayToString<8, 8>(smallScan);
+		FixedPointParallel<8, 8>::sort(small, 2, singleThreadPool);
+		const std::size_t size = 1000;
+		const std::size_t grainSize = 37;
+		FixedPointArray<16, 16> values(size);
+		uint64_t state = 0x9E3779B97F4A7C15ULL;
+		for (std::size_t index = 0; index < values.size(); index++)
+		{
+			state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+			values[index] = FixedPointNumber<16, 16>::fromRawValue(static_cast<int32_t>(state >> 32));
+		}
+		auto square = [](FixedPointNumber<16, 16> value)
+		{
+			return value * value;
+		};
+		FixedPointArray<16, 16> expectedTransform(size);
+		FixedPointArray<16, 16> expectedInclusiveScan(size);
+		FixedPointArray<16, 16> expectedExclusiveScan(size);
+		FixedPointArray<16, 16> expectedSort = values;
+		std::transform(values.begin(), values.end(), expectedTransform.begin(), square);
+		FixedPointNumber<16, 16> expectedReduce = std::accumulate(values.begin(), values.end(), FixedPointNumber<16, 16>("1"));
+		std::inclusive_scan(values.begin(), values.end(), expectedInclusiveScan.begin());
+		std::exclusive_scan(values.begin(), values.end(), expectedExclusiveScan.begin(), FixedPointNumber<16, 16>("1"));
+		std::sort(expectedSort.begin(), expectedSort.end());
+		bool isMatching = true;
+		for (std::size_t numberOfThreads : {1, 4})
+		{
+			FixedPointThreadPool threadPool(numberOfThreads);
+			FixedPointArray<16, 16> result(size);
+			FixedPointParallel<16, 16>::transform(values, result, square, grainSize, threadPool);
+			isMatching = isMatching && std::equal(result.begin(), result.end(), expectedTransform.begin());
+			isMatching = isMatching && FixedPointParallel<16, 16>::reduce(values, FixedPointNumber<16, 16>("1"), std::plus<>(), grainSize, threadPool) == expectedReduce;
+			FixedPointParallel<16, 16>::inclusiveScan(values, result, std::plus<>(), grainSize, threadPool);
+			isMatching = isMatching && std::equal(result.begin(), result.end(), expectedInclusiveScan.begin());
+			FixedPointParallel<16, 16>::exclusiveScan(values, result, FixedPointNumber<16, 16>("1"), std::plus<>(), grainSize, threadPool);
+			isMatching = isMatching && std::equal(result.begin(), result.end(), expectedExclusiveScan.begin());
+			std::pair<FixedPointNumber<16, 16>, FixedPointNumber<16, 16>> minimumAndMaximum = FixedPointParallel<16, 16>::minimumAndMaximum(values, grainSize, threadPool);
+			isMatching = isMatching && minimumAndMaximum.first == expectedSort[0] && minimumAndMaximum.second == expectedSort[size - 1];
+			result = values;
+			FixedPointParallel<16, 16>::sort(result, grainSize, threadPool);
+			isMatching = isMatching && std::equal(result.begin(), result.end(), expectedSort.begin());
+		}
+		std::cout << "Parallel algorithms: inclusive scan " << smallScanString << ", exclusive scan from 10.0 " << smallExclusiveScanString << ", sorted " << arrayToString<8, 8>(small) << ", 1 and 4 threads match sequential " << (isMatching ? "true" : "false") << std::endl;
+		file << "Parallel algorithms: inclusive scan " << smallScanString << ", exclusive scan from 10.0 " << smallExclusiveScanString << ", sorted " << arrayToString<8, 8>(small) << ", 1 and 4 threads match sequential " << (isMatching ? "true" : "false") << std::endl;
+	}
+	catch(const std::exception& exception)
+	{
+		std::cerr << exception.what() << std::endl;
+		file << exception.what() << std::endl;
+	}
+}
+/**
+ * @brief Main function to run all tests.
+ * @return int
+ */
+int main()
+{
+	testLayoutAndAccess();
+	testElementWiseArithmetic();
+	testScalarBroadcast();
+	testUnaryOperationsOnSpans();
+	testMismatchedSizes();
+	testSimdKernelsMatchScalar();
+	testSaturatedAddition();
+	testQuantization();
+	testMathFunctions();
+	testLookupTable();
+	testDivisor();
+	testMinimumAndMaximum();
+	testDotAndSum();
+	testMatrixMultiply();
+	testParallelAlgorithms();
+	return 0;
+}
@@ -0,0 +1,533 @@
+/**
+ * @file FixedPointDivisor.hpp
+ * @author Robert Connor Luce
+ * @brief Header file for FixedPointDivisor class, a fixed-point divisor with a precomputed multiply-and-shift reciprocal.
+ */
+#include <cstdint>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include "FixedPointNumber.hpp"
+#include "FixedPointSimd.hpp"
+#ifndef FIXEDPOINTDIVISOR_HPP
+#define FIXEDPOINTDIVISOR_HPP
+/**
+ * @brief Class template of a fixed-point divisor that replaces every division by it with a multiply and two shifts.
+ * @details Dividing by a fixed-point number divides the dividend, shifted left by numberOfFractionalBits, by the raw
+ * value of the divisor. Every rounding except Stochastic turns that into the floor of an integer quotient by the
+ * magnitude of the divisor: Floor directly, RoundHalfUp and RoundHalfEven after adding half the divisor, and Truncate
+ * on the magnitude of the dividend. The constructor computes the magic multiplier and shifts that divide by the
+ * magnitude exactly for every dividend of the width of DividendType, following Granlund and Montgomery, "Division by
+ * Invariant Integers using Multiplication", so a division is one widening multiply keeping the high half, a subtract,
+ * an add and two shifts, and RoundHalfEven adds one multiply to detect ties. The quotients are bit-exact with the
+ * scalar divide with the same FixedPointRounding, including the wrapping of quotients outside the range of the
+ * format, and the bulk divide runs in 64-bit lanes with AVX2 and AVX-512 for formats stored in 16-bit or 32-bit
+ * integers whose shifted dividends fit in 64 bits. Stochastic rounding falls back to the scalar divide.
+ * @tparam numberOfIntegerBits Number of bits allocated for the integer part.
+ * @tparam numberOfFractionalBits Number of bits allocated for the fractional part.
+ */
+template<int numberOfIntegerBits, int numberOfFractionalBits>
+class FixedPointDivisor
+{
+public:
+	using ValueType = FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>;
+	using StorageType = typename ValueType::StorageType;
+private:
+	using UnsignedStorageType = typename ValueType::UnsignedStorageType;
+	static constexpr int numberOfBits = numberOfIntegerBits + numberOfFractionalBits;
+	static constexpr int numberOfStorageBits = static_cast<int>(8 * sizeof(StorageType));
+	static constexpr int numberOfDividendBits = numberOfBits + numberOfFractionalBits + 1 < 32 ? 32 : 8 * static_cast<int>(sizeof(typename FixedPointStorage<numberOfBits + numberOfFractionalBits + 1>::SignedType));
+	using DividendType = typename FixedPointStorage<numberOfDividendBits>::SignedType;
+	using UnsignedDividendType = typename FixedPointStorage<numberOfDividendBits>::UnsignedType;
+	using ProductType = typename FixedPointStorage<2 * numberOfDividendBits>::UnsignedType;
+	static constexpr bool hasVectorKernels = (numberOfStorageBits == 16 || numberOfStorageBits == 32) && numberOfFractionalBits >= 0 && numberOfDividendBits <= 64;
+	ValueType divisor;
+	UnsignedDividendType absoluteDivisor;
+	UnsignedDividendType multiplier;
+	int firstShift;
+	int secondShift;
+	bool isNegative;
+	static constexpr UnsignedDividendType multiplyHigh(UnsignedDividendType value1, UnsignedDividendType value2);
+	static constexpr StorageType wrap(UnsignedDividendType value);
+	static FixedPointInstructionSet selectInstructionSet(FixedPointInstructionSet instructionSet);
+	constexpr UnsignedDividendType divideUnsigned(UnsignedDividendType value) const;
+	template<FixedPointRounding rounding>
+	constexpr StorageType divideRaw(StorageType rawValue) const;
+#if FIXEDPOINT_X86_KERNELS
+	static __m256i loadWidenedAvx2(const StorageType* values);
+	static __m256i multiplyHighAvx2(__m256i values, __m256i multipliers);
+	template<FixedPointRounding rounding>
+	std::size_t divideAvx2(const StorageType* values, StorageType* result, std::size_t numberOfValues) const;
+	static __m512i loadWidenedAvx512(const StorageType* values);
+	static __m512i multiplyHighAvx512(__m512i values, __m512i multipliers);
+	template<FixedPointRounding rounding>
+	std::size_t divideAvx512(const StorageType* values, StorageType* result, std::size_t numberOfValues) const;
+#endif
+public:
+	constexpr FixedPointDivisor(const ValueType &divisor);
+	constexpr ValueType getDivisor() const;
+	template<FixedPointRounding rounding = FixedPointRounding::RoundHalfUp>
+	constexpr ValueType divide(const ValueType &dividend) const;
+	template<FixedPointRounding rounding = FixedPointRounding::RoundHalfUp>
+	void divide(std::span<const ValueType> values, std::span<ValueType> result, FixedPointInstructionSet instructionSet = fixedPointDetectInstructionSet()) const;
+};
+/**
+ * @brief Construct a new Fixed Point Divisor object and compute its magic multiplier and shifts.
+ * @details With l the smallest number of bits such that 2^l is at least the magnitude d of the raw divisor and N the
+ * width of DividendType, the multiplier is floor(2^N * (2^l - d) / d) + 1, which fits in N bits, and the shifts are
+ * min(l, 1) and max(l - 1, 0). The one wide division this takes is the last one any quotient by this divisor needs.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param divisor
+ * @throws std::runtime_error If the divisor is zero.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+constexpr FixedPointDivisor<numberOfIntegerBits, numberOfFractionalBits>::FixedPointDivisor(const ValueType &divisor)
+	: divisor(divisor), absoluteDivisor(0), multiplier(0), firstShift(0), secondShift(0), isNegative(divisor.getRawValue() < static_cast<StorageType>(0))
+{
+	const DividendType rawDivisor = static_cast<DividendType>(divisor.getRawValue());
+	if (rawDivisor == static_cast<DividendType>(0))
+	{
+		throw std::runtime_error("Division by zero");
+	}
+	this->absoluteDivisor = static_cast<UnsignedDividendType>(this->isNegative ? static_cast<DividendType>(-rawDivisor) : rawDivisor);
+	const UnsignedDividendType one = static_cast<UnsignedDividendType>(1);
+	int numberOfShiftBits = 0;
+	while (static_cast<UnsignedDividendType>(one << numberOfShiftBits) < this->absoluteDivisor)
+	{
+		numberOfShiftBits++;
+	}
+	ProductType excess = static_cast<ProductType>(static_cast<UnsignedDividendType>(static_cast<UnsignedDividendType>(one << numberOfShiftBits) - this->absoluteDivisor));
+	this->multiplier = static_cast<UnsignedDividendType>(static_cast<ProductType>(static_cast<ProductType>(excess << numberOfDividendBits) / static_cast<ProductType>(this->absoluteDivisor)) + static_cast<ProductType>(1));
+	this->firstShift = numberOfShiftBits < 1 ? numberOfShiftBits : 1;
+	this->secondShift = numberOfShiftBits > 1 ? numberOfShiftBits - 1 : 0;
+}
+/**
+ * @brief Get the divisor this object divides by.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @return ValueType
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+constexpr typename FixedPointDivisor<numberOfIntegerBits, numberOfFractionalBits>::ValueType FixedPointDivisor<numberOfIntegerBits, numberOfFractionalBits>::getDivisor() const
+{
+	return this->divisor;
+}
+/**
+ * @brief Compute the upper half of the double-width product of two unsigned dividends.
+ * @details A native double-width product is used up to 64 bits, 128-bit dividends are split into 64-bit halves, and
+ * wider ones use FixedPointWideInteger::multiplyFull.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param value1
+ * @param value2
+ * @return UnsignedDividendType
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+constexpr typename FixedPointDivisor<numberOfIntegerBits, numberOfFractionalBits>::UnsignedDividendType FixedPointDivisor<numberOfIntegerBits, numberOfFractionalBits>::multiplyHigh(UnsignedDividendType value1, UnsignedDividendType value2)
+{
+	if constexpr (fixedPointIsWideInteger<UnsignedDividendType>)
+	{
+		return static_cast<UnsignedDividendType>(UnsignedDividendType::multiplyFull(value1, value2) >> numberOfDividendBits);
+	}
+	else if constexpr (numberOfDividendBits <= 64)
+	{
+		return static_cast<UnsignedDividendType>(static_cast<ProductType>(static_cast<ProductType>(value1) * static_cast<ProductType>(value2)) >> numberOfDividendBits);
+	}
+	else
+	{
+		const UnsignedDividendType lowMask = static_cast<UnsignedDividendType>(UINT64_MAX);
+		UnsignedDividendType lowProduct = (value1 & lowMask) * (value2 & lowMask);
+		UnsignedDividendType crossProduct1 = (value1 >> 64) * (value2 & lowMask) + (lowProduct >> 64);
+		UnsignedDividendType crossProduct2 = (value1 & lowMask) * (value2 >> 64) + (crossProduct1 & lowMask);
+		return (value1 >> 64) * (value2 >> 64) + (crossProduct1 >> 64) + (crossProduct2 >> 64);
+	}
+}
+/**
+ * @brief Reduce a quotient to the width of the format and sign-extend it into the storage type, as Wrap does.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param value
+ * @return StorageType
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+constexpr typename FixedPointDivisor<numberOfIntegerBits, numberOfFractionalBits>::StorageType FixedPointDivisor<numberOfIntegerBits, numberOfFractionalBits>::wrap(UnsignedDividendType value)
+{
+	UnsignedStorageType narrowedValue = static_cast<UnsignedStorageType>(value);
+	if constexpr (numberOfBits == numberOfStorageBits)
+	{
+		return static_cast<StorageType>(narrowedValue);
+	}
+	else
+	{
+		return static_cast<StorageType>(static_cast<StorageType>(static_cast<UnsignedStorageType>(narrowedValue << (numberOfStorageBits - numberOfBits))) >> (numberOfStorageBits - numberOfBits));
+	}
+}
+/**
+ * @brief Limit a requested instruction set to what the processor and the format support.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param instructionSet
+ * @return FixedPointInstructionSet
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+FixedPointInstructionSet FixedPointDivisor<numberOfIntegerBits, numberOfFractionalBits>::selectInstructionSet(FixedPointInstructionSet instructionSet)
+{
+	if constexpr (!hasVectorKernels)
+	{
+		return FixedPointInstructionSet::Scalar;
+	}
+	FixedPointInstructionSet detectedInstructionSet = fixedPointDetectInstructionSet();
+	return instructionSet < detectedInstructionSet ? instructionSet : detectedInstructionSet;
+}
+/**
+ * @brief Divide an unsigned dividend by the magnitude of the divisor, rounding toward zero.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param value
+ * @return UnsignedDividendType
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+constexpr typename FixedPointDivisor<numberOfIntegerBits, numberOfFractionalBits>::UnsignedDividendType FixedPointDivisor<numberOfIntegerBits, numberOfFractionalBits>::divideUnsigned(UnsignedDividendType value) const
+{
+	UnsignedDividendType highProduct = multiplyHigh(this->multiplier, value);
+	return static_cast<UnsignedDividendType>(static_cast<UnsignedDividendType>(highProduct + static_cast<UnsignedDividendType>(static_cast<UnsignedDividendType>(value - highProduct) >> this->firstShift)) >> this->secondShift);
+}
+/**
+ * @brief Divide a raw value by the divisor with a selectable rounding.
+ * @details The shifted dividend is negated for a negative divisor, so that the quotient is that of the magnitude. The
+ * floor of a negative dividend is taken on its complement, which is non-negative, and complemented back. The
+ * arithmetic is done on unsigned dividends, where it wraps.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam rounding The rounding applied to the quotient; not Stochastic.
+ * @param rawValue
+ * @return StorageType
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <FixedPointRounding rounding>
+constexpr typename FixedPointDivisor<numberOfIntegerBits, numberOfFractionalBits>::StorageType FixedPointDivisor<numberOfIntegerBits, numberOfFractionalBits>::divideRaw(StorageType rawValue) const
+{
+	const UnsignedDividendType zero = static_cast<UnsignedDividendType>(0);
+	const UnsignedDividendType one = static_cast<UnsignedDividendType>(1);
+	UnsignedDividendType scaledValue = static_cast<UnsignedDividendType>(static_cast<UnsignedDividendType>(static_cast<DividendType>(rawValue)) << numberOfFractionalBits);
+	if (this->isNegative)
+	{
+		scaledValue = static_cast<UnsignedDividendType>(zero - scaledValue);
+	}
+	if constexpr (rounding == FixedPointRounding::RoundHalfUp || rounding == FixedPointRounding::RoundHalfEven)
+	{
+		scaledValue = static_cast<UnsignedDividendType>(scaledValue + static_cast<UnsignedDividendType>(this->absoluteDivisor >> 1));
+	}
+	const UnsignedDividendType signMask = static_cast<DividendType>(scaledValue) < static_cast<DividendType>(0) ? static_cast<UnsignedDividendType>(~zero) : zero;
+	if constexpr (rounding == FixedPointRounding::Truncate)
+	{
+		UnsignedDividendType quotient = divideUnsigned(static_cast<UnsignedDividendType>(static_cast<UnsignedDividendType>(scaledValue ^ signMask) - signMask));
+		return wrap(static_cast<UnsignedDividendType>(static_cast<UnsignedDividendType>(quotient ^ signMask) - signMask));
+	}
+	else
+	{
+		UnsignedDividendType quotient = static_cast<UnsignedDividendType>(divideUnsigned(static_cast<UnsignedDividendType>(scaledValue ^ signMask)) ^ signMask);
+		if constexpr (rounding == FixedPointRounding::RoundHalfEven)
+		{
+			if ((this->absoluteDivisor & one) == zero && (quotient & one) != zero && static_cast<UnsignedDividendType>(quotient * this->absoluteDivisor) == scaledValue)
+			{
+				quotient = static_cast<UnsignedDividendType>(quotient - one);
+			}
+		}
+		return wrap(quotient);
+	}
+}
+/**
+ * @brief Divide a fixed-point number by the divisor with a selectable rounding.
+ * @details The result is bit-exact with dividend.divide<rounding>(getDivisor()).
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam rounding The rounding applied to the quotient.
+ * @param dividend
+ * @return ValueType
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <FixedPointRounding rounding>
+constexpr typename FixedPointDivisor<numberOfIntegerBits, numberOfFractionalBits>::ValueType FixedPointDivisor<numberOfIntegerBits, numberOfFractionalBits>::divide(const ValueType &dividend) const
+{
+	if constexpr (rounding == FixedPointRounding::Stochastic)
+	{
+		return dividend.template divide<rounding>(this->divisor);
+	}
+	else
+	{
+		return ValueType::fromRawValue(divideRaw<rounding>(dividend.getRawValue()));
+	}
+}
+/**
+ * @brief Divide every element of a span by the divisor, with the vector kernels where the format has them.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam rounding The rounding applied to every quotient.
+ * @param values
+ * @param result Receives the quotients; may alias the input.
+ * @param instructionSet Most capable instruction set to use; defaults to the best one the processor supports.
+ * @throws std::invalid_argument If the spans have different sizes.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <FixedPointRounding rounding>
+void FixedPointDivisor<numberOfIntegerBits, numberOfFractionalBits>::divide(std::span<const ValueType> values, std::span<ValueType> result, FixedPointInstructionSet instructionSet) const
+{
+	static_assert(sizeof(ValueType) == sizeof(StorageType) && std::is_standard_layout_v<ValueType>, "FixedPointNumber must be layout-compatible with its storage.");
+	if (values.size() != result.size())
+	{
+		throw std::invalid_argument("Fixed-point spans must have the same number of elements.");
+	}
+	std::size_t index = 0;
+#if FIXEDPOINT_X86_KERNELS
+	if constexpr (hasVectorKernels && rounding != FixedPointRounding::Stochastic)
+	{
+		const StorageType* rawInput = reinterpret_cast<const StorageType*>(values.data());
+		StorageType* rawResult = reinterpret_cast<StorageType*>(result.data());
+		switch (selectInstructionSet(instructionSet))
+		{
+		case FixedPointInstructionSet::Avx512:
+			index = divideAvx512<rounding>(rawInput, rawResult, result.size());
+			break;
+		case FixedPointInstructionSet::Avx2:
+			index = divideAvx2<rounding>(rawInput, rawResult, result.size());
+			break;
+		default:
+			break;
+		}
+	}
+#endif
+	for (; index < result.size(); index++)
+	{
+		result[index] = this->divide<rounding>(values[index]);
+	}
+}
+#if FIXEDPOINT_X86_KERNELS
+/**
+ * @brief Load four raw values with AVX2, sign-extended to 64-bit lanes.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @return __m256i
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx2"))) __m256i FixedPointDivisor<numberOfIntegerBits, numberOfFractionalBits>::loadWidenedAvx2(const StorageType* values)
+{
+	if constexpr (numberOfStorageBits == 16)
+	{
+		return _mm256_cvtepi16_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(values)));
+	}
+	else
+	{
+		return _mm256_cvtepi32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(values)));
+	}
+}
+/**
+ * @brief Compute the upper halves of the products of unsigned dividends in 64-bit lanes with AVX2.
+ * @details Dividends of 32 bits take one 32-bit multiply; 64-bit ones are multiplied in 32-bit halves and the cross
+ * products are summed with their carries.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param multipliers
+ * @return __m256i
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx2"))) __m256i FixedPointDivisor<numberOfIntegerBits, numberOfFractionalBits>::multiplyHighAvx2(__m256i values, __m256i multipliers)
+{
+	if constexpr (numberOfDividendBits == 32)
+	{
+		return _mm256_srli_epi64(_mm256_mul_epu32(values, multipliers), 32);
+	}
+	else
+	{
+		const __m256i lowMask = _mm256_set1_epi64x(0xFFFFFFFF);
+		__m256i valuesHigh = _mm256_srli_epi64(values, 32);
+		__m256i multipliersHigh = _mm256_srli_epi64(multipliers, 32);
+		__m256i lowProducts = _mm256_mul_epu32(values, multipliers);
+		__m256i crossProducts1 = _mm256_add_epi64(_mm256_mul_epu32(valuesHigh, multipliers), _mm256_srli_epi64(lowProducts, 32));
+		__m256i crossProducts2 = _mm256_add_epi64(_mm256_mul_epu32(values, multipliersHigh), _mm256_and_si256(crossProducts1, lowMask));
+		return _mm256_add_epi64(_mm256_add_epi64(_mm256_mul_epu32(valuesHigh, multipliersHigh), _mm256_srli_epi64(crossProducts1, 32)), _mm256_srli_epi64(crossProducts2, 32));
+	}
+}
+/**
+ * @brief Divide raw values by the divisor with AVX2, four per iteration in 64-bit lanes, like divideRaw.
+ * @details RoundHalfEven multiplies the quotients back in 32-bit halves, which is exact modulo 2^64 because the
+ * magnitude of the divisor fits in 32 bits. The quotients are narrowed to 32-bit lanes and sign-extended from the
+ * width of the format there.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam rounding The rounding applied to every quotient; not Stochastic.
+ * @param values
+ * @param result
+ * @param numberOfValues
+ * @return std::size_t Number of values divided.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <FixedPointRounding rounding>
+__attribute__((target("avx2"))) std::size_t FixedPointDivisor<numberOfIntegerBits, numberOfFractionalBits>::divideAvx2(const StorageType* values, StorageType* result, std::size_t numberOfValues) const
+{
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i one = _mm256_set1_epi64x(1);
+	const __m256i negateMask = _mm256_set1_epi64x(this->isNegative ? -1 : 0);
+	const __m256i roundingBias = _mm256_set1_epi64x(rounding == FixedPointRounding::RoundHalfUp || rounding == FixedPointRounding::RoundHalfEven ? static_cast<int64_t>(this->absoluteDivisor >> 1) : 0);
+	const __m256i absoluteDivisors = _mm256_set1_epi64x(static_cast<int64_t>(this->absoluteDivisor));
+	const __m256i multipliers = _mm256_set1_epi64x(static_cast<int64_t>(this->multiplier));
+	const __m128i firstShifts = _mm_cvtsi32_si128(this->firstShift);
+	const __m128i secondShifts = _mm_cvtsi32_si128(this->secondShift);
+	const bool hasTies = rounding == FixedPointRounding::RoundHalfEven && (this->absoluteDivisor & 1) == 0;
+	std::size_t index = 0;
+	for (; index + 4 <= numberOfValues; index += 4)
+	{
+		__m256i scaledValues = _mm256_sub_epi64(_mm256_xor_si256(_mm256_slli_epi64(loadWidenedAvx2(values + index), numberOfFractionalBits), negateMask), negateMask);
+		scaledValues = _mm256_add_epi64(scaledValues, roundingBias);
+		__m256i signMasks = _mm256_cmpgt_epi64(zero, scaledValues);
+		__m256i magnitudes = _mm256_xor_si256(scaledValues, signMasks);
+		if constexpr (rounding == FixedPointRounding::Truncate)
+		{
+			magnitudes = _mm256_sub_epi64(magnitudes, signMasks);
+		}
+		__m256i highProducts = multiplyHighAvx2(magnitudes, multipliers);
+		__m256i quotients = _mm256_srl_epi64(_mm256_add_epi64(highProducts, _mm256_srl_epi64(_mm256_sub_epi64(magnitudes, highProducts), firstShifts)), secondShifts);
+		quotients = _mm256_xor_si256(quotients, signMasks);
+		if constexpr (rounding == FixedPointRounding::Truncate)
+		{
+			quotients = _mm256_sub_epi64(quotients, signMasks);
+		}
+		if (hasTies)
+		{
+			__m256i products = _mm256_add_epi64(_mm256_mul_epu32(quotients, absoluteDivisors), _mm256_slli_epi64(_mm256_mul_epu32(_mm256_srli_epi64(quotients, 32), absoluteDivisors), 32));
+			__m256i isTie = _mm256_cmpeq_epi64(products, scaledValues);
+			quotients = _mm256_sub_epi64(quotients, _mm256_and_si256(isTie, _mm256_and_si256(quotients, one)));
+		}
+		__m128i narrowedQuotients = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(quotients, _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6)));
+		if constexpr (numberOfBits < 32)
+		{
+			narrowedQuotients = _mm_srai_epi32(_mm_slli_epi32(narrowedQuotients, 32 - numberOfBits), 32 - numberOfBits);
+		}
+		if constexpr (numberOfStorageBits == 16)
+		{
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(result + index), _mm_shuffle_epi8(narrowedQuotients, _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1)));
+		}
+		else
+		{
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(result + index), narrowedQuotients);
+		}
+	}
+	return index;
+}
+// GCC 12 reports the undefined pass-through operands inside the AVX-512 intrinsics as (maybe-)uninitialized.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+/**
+ * @brief Load eight raw values with AVX-512, sign-extended to 64-bit lanes.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @return __m512i
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx512f,avx512bw"))) __m512i FixedPointDivisor<numberOfIntegerBits, numberOfFractionalBits>::loadWidenedAvx512(const StorageType* values)
+{
+	if constexpr (numberOfStorageBits == 16)
+	{
+		return _mm512_cvtepi16_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(values)));
+	}
+	else
+	{
+		return _mm512_cvtepi32_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(values)));
+	}
+}
+/**
+ * @brief Compute the upper halves of the products of unsigned dividends in 64-bit lanes with AVX-512, as
+ * multiplyHighAvx2 does.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param multipliers
+ * @return __m512i
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx512f,avx512bw"))) __m512i FixedPointDivisor<numberOfIntegerBits, numberOfFractionalBits>::multiplyHighAvx512(__m512i values, __m512i multipliers)
+{
+	if constexpr (numberOfDividendBits == 32)
+	{
+		return _mm512_srli_epi64(_mm512_mul_epu32(values, multipliers), 32);
+	}
+	else
+	{
+		const __m512i lowMask = _mm512_set1_epi64(0xFFFFFFFF);
+		__m512i valuesHigh = _mm512_srli_epi64(values, 32);
+		__m512i multipliersHigh = _mm512_srli_epi64(multipliers, 32);
+		__m512i lowProducts = _mm512_mul_epu32(values, multipliers);
+		__m512i crossProducts1 = _mm512_add_epi64(_mm512_mul_epu32(valuesHigh, multipliers), _mm512_srli_epi64(lowProducts, 32));
+		__m512i crossProducts2 = _mm512_add_epi64(_mm512_mul_epu32(values, multipliersHigh), _mm512_and_si512(crossProducts1, lowMask));
+		return _mm512_add_epi64(_mm512_add_epi64(_mm512_mul_epu32(valuesHigh, multipliersHigh), _mm512_srli_epi64(crossProducts1, 32)), _mm512_srli_epi64(crossProducts2, 32));
+	}
+}
+/**
+ * @brief Divide raw values by the divisor with AVX-512, eight per iteration in 64-bit lanes, as divideAvx2 does.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam rounding The rounding applied to every quotient; not Stochastic.
+ * @param values
+ * @param result
+ * @param numberOfValues
+ * @return std::size_t Number of values divided.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <FixedPointRounding rounding>
+__attribute__((target("avx512f,avx512bw"))) std::size_t FixedPointDivisor<numberOfIntegerBits, numberOfFractionalBits>::divideAvx512(const StorageType* values, StorageType* result, std::size_t numberOfValues) const
+{
+	const __m512i one = _mm512_set1_epi64(1);
+	const __m512i negateMask = _mm512_set1_epi64(this->isNegative ? -1 : 0);
+	const __m512i roundingBias = _mm512_set1_epi64(rounding == FixedPointRounding::RoundHalfUp || rounding == FixedPointRounding::RoundHalfEven ? static_cast<int64_t>(this->absoluteDivisor >> 1) : 0);
+	const __m512i absoluteDivisors = _mm512_set1_epi64(static_cast<int64_t>(this->absoluteDivisor));
+	const __m512i multipliers = _mm512_set1_epi64(static_cast<int64_t>(this->multiplier));
+	const __m128i firstShifts = _mm_cvtsi32_si128(this->firstShift);
+	const __m128i secondShifts = _mm_cvtsi32_si128(this->secondShift);
+	const bool hasTies = rounding == FixedPointRounding::RoundHalfEven && (this->absoluteDivisor & 1) == 0;
+	std::size_t index = 0;
+	for (; index + 8 <= numberOfValues; index += 8)
+	{
+		__m512i scaledValues = _mm512_sub_epi64(_mm512_xor_si512(_mm512_slli_epi64(loadWidenedAvx512(values + index), numberOfFractionalBits), negateMask), negateMask);
+		scaledValues = _mm512_add_epi64(scaledValues, roundingBias);
+		__m512i signMasks = _mm512_srai_epi64(scaledValues, 63);
+		__m512i magnitudes = _mm512_xor_si512(scaledValues, signMasks);
+		if constexpr (rounding == FixedPointRounding::Truncate)
+		{
+			magnitudes = _mm512_sub_epi64(magnitudes, signMasks);
+		}
+		__m512i highProducts = multiplyHighAvx512(magnitudes, multipliers);
+		__m512i quotients = _mm512_srl_epi64(_mm512_add_epi64(highProducts, _mm512_srl_epi64(_mm512_sub_epi64(magnitudes, highProducts), firstShifts)), secondShifts);
+		quotients = _mm512_xor_si512(quotients, signMasks);
+		if constexpr (rounding == FixedPointRounding::Truncate)
+		{
+			quotients = _mm512_sub_epi64(quotients, signMasks);
+		}
+		if (hasTies)
+		{
+			__m512i products = _mm512_add_epi64(_mm512_mul_epu32(quotients, absoluteDivisors), _mm512_slli_epi64(_mm512_mul_epu32(_mm512_srli_epi64(quotients, 32), absoluteDivisors), 32));
+			quotients = _mm512_mask_sub_epi64(quotients, _mm512_cmpeq_epi64_mask(products, scaledValues), quotients, _mm512_and_si512(quotients, one));
+		}
+		if constexpr (numberOfBits < numberOfStorageBits)
+		{
+			quotients = _mm512_srai_epi64(_mm512_slli_epi64(quotients, 64 - numberOfBits), 64 - numberOfBits);
+		}
+		if constexpr (numberOfStorageBits == 16)
+		{
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(result + index), _mm512_cvtepi64_epi16(quotients));
+		}
+		else
+		{
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(result + index), _mm512_cvtepi64_epi32(quotients));
+		}
+	}
+	return index;
+}
+#pragma GCC diagnostic pop
+#endif
+#endif
@@ -0,0 +1,577 @@
+/**
+ * @file FixedPointGemm.hpp
+ * @author Robert Connor Luce
+ * @brief Header file for FixedPointGemm class, a cache-blocked matrix multiply for fixed-point numbers.
+ */
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include "FixedPointNumber.hpp"
+#include "FixedPointSimd.hpp"
+#include "FixedPointThreadPool.hpp"
+#ifndef FIXEDPOINTGEMM_HPP
+#define FIXEDPOINTGEMM_HPP
+/**
+ * @brief Whether a matrix operand is used as stored or transposed.
+ */
+enum class FixedPointTranspose
+{
+	None,		///< Use the matrix as stored.
+	Transpose	///< Use the transpose of the stored matrix.
+};
+/**
+ * @brief Class template of a general matrix multiply C = op(A) * op(B) + bias over fixed-point matrices.
+ * @details Matrices are dense and row-major. op(A) is numberOfRows by innerDimension and op(B) is innerDimension by
+ * numberOfColumns; a transposed operand is stored with its dimensions swapped. The product is computed in the style
+ * of BLIS: B is packed into panels of microTileColumns columns and A into panels of microTileRows rows, block by
+ * block so that the panels stay in cache, and a register-tiled micro-kernel multiplies them. Every output keeps an
+ * exact sum of products in AccumulatorType, the optional bias is added exactly, and the total is rounded once and
+ * saturated into the result format, which may differ from the operand format to requantize the output. Large products
+ * are partitioned over rows or columns across the threads of fixedPointDefaultThreadPool(); the result does not depend
+ * on the partitioning.
+ * @tparam numberOfIntegerBits Number of bits allocated for the integer part of the operands.
+ * @tparam numberOfFractionalBits Number of bits allocated for the fractional part of the operands.
+ */
+template<int numberOfIntegerBits, int numberOfFractionalBits>
+class FixedPointGemm
+{
+public:
+	using ValueType = FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>;
+	using StorageType = typename ValueType::StorageType;
+	using AccumulatorType = typename ValueType::AccumulatorType;
+	static constexpr std::size_t parallelThreshold = std::size_t(1) << 22;
+private:
+	static constexpr int numberOfBits = numberOfIntegerBits + numberOfFractionalBits;
+	static constexpr bool hasVectorKernels = numberOfBits <= 32;
+	using PackedType = std::conditional_t<hasVectorKernels, int32_t, StorageType>;
+	static constexpr std::size_t microTileRows = 4;
+	static constexpr std::size_t microTileColumns = 8;
+	static constexpr std::size_t blockDepth = 256;
+	static constexpr std::size_t blockRows = 64;
+	static constexpr std::size_t blockColumns = 256;
+	struct Operands
+	{
+		const StorageType* matrixA;
+		const StorageType* matrixB;
+		std::size_t numberOfRows;
+		std::size_t numberOfColumns;
+		std::size_t innerDimension;
+		FixedPointTranspose transposeA;
+		FixedPointTranspose transposeB;
+	};
+	static FixedPointInstructionSet selectInstructionSet(FixedPointInstructionSet instructionSet);
+	static void packA(const Operands &operands, std::size_t firstRow, std::size_t numberOfRows, std::size_t firstStep, std::size_t depth, PackedType* packedA);
+	static void packB(const Operands &operands, std::size_t firstStep, std::size_t depth, std::size_t firstColumn, std::size_t numberOfColumns, PackedType* packedB);
+	static void addTile(const int64_t lowSums[microTileRows][microTileColumns], const int64_t highSums[microTileRows][microTileColumns], AccumulatorType* accumulators, std::size_t accumulatorStride, std::size_t numberOfRows, std::size_t numberOfColumns);
+	static void microKernelScalar(std::size_t depth, const PackedType* packedA, const PackedType* packedB, AccumulatorType* accumulators, std::size_t accumulatorStride, std::size_t numberOfRows, std::size_t numberOfColumns);
+#if FIXEDPOINT_X86_KERNELS
+	static void microKernelSse41(std::size_t depth, const PackedType* packedA, const PackedType* packedB, AccumulatorType* accumulators, std::size_t accumulatorStride, std::size_t numberOfRows, std::size_t numberOfColumns);
+	static void microKernelAvx2(std::size_t depth, const PackedType* packedA, const PackedType* packedB, AccumulatorType* accumulators, std::size_t accumulatorStride, std::size_t numberOfRows, std::size_t numberOfColumns);
+	static void microKernelAvx512(std::size_t depth, const PackedType* packedA, const PackedType* packedB, AccumulatorType* accumulators, std::size_t accumulatorStride, std::size_t numberOfRows, std::size_t numberOfColumns);
+#endif
+	template<int resultIntegerBits, int resultFractionalBits, FixedPointRounding rounding>
+	static void multiplyBlock(const Operands &operands, std::size_t firstRow, std::size_t lastRow, std::size_t firstColumn, std::size_t lastColumn, std::span<const ValueType> bias, std::span<FixedPointNumber<resultIntegerBits, resultFractionalBits>> matrixC, FixedPointInstructionSet instructionSet);
+public:
+	template<int resultIntegerBits = numberOfIntegerBits, int resultFractionalBits = numberOfFractionalBits, FixedPointRounding rounding = FixedPointRounding::RoundHalfUp>
+	static void multiply(std::size_t numberOfRows, std::size_t numberOfColumns, std::size_t innerDimension, std::span<const ValueType> matrixA, FixedPointTranspose transposeA, std::span<const ValueType> matrixB, FixedPointTranspose transposeB, std::type_identity_t<std::span<FixedPointNumber<resultIntegerBits, resultFractionalBits>>> matrixC, std::span<const ValueType> bias = {}, FixedPointInstructionSet instructionSet = fixedPointDetectInstructionSet());
+};
+/**
+ * @brief Limit a requested instruction set to what the processor and the format support.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param instructionSet
+ * @return FixedPointInstructionSet
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+FixedPointInstructionSet FixedPointGemm<numberOfIntegerBits, numberOfFractionalBits>::selectInstructionSet(FixedPointInstructionSet instructionSet)
+{
+	if constexpr (!hasVectorKernels)
+	{
+		return FixedPointInstructionSet::Scalar;
+	}
+	FixedPointInstructionSet detectedInstructionSet = fixedPointDetectInstructionSet();
+	return instructionSet < detectedInstructionSet ? instructionSet : detectedInstructionSet;
+}
+/**
+ * @brief Pack a block of op(A) into panels of microTileRows rows, stored step by step and padded with zeros.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param operands
+ * @param firstRow
+ * @param numberOfRows
+ * @param firstStep First index along the inner dimension.
+ * @param depth Number of steps along the inner dimension.
+ * @param packedA Receives ceil(numberOfRows / microTileRows) * microTileRows * depth values.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointGemm<numberOfIntegerBits, numberOfFractionalBits>::packA(const Operands &operands, std::size_t firstRow, std::size_t numberOfRows, std::size_t firstStep, std::size_t depth, PackedType* packedA)
+{
+	for (std::size_t panelRow = 0; panelRow < numberOfRows; panelRow += microTileRows)
+	{
+		for (std::size_t step = 0; step < depth; step++)
+		{
+			for (std::size_t row = 0; row < microTileRows; row++)
+			{
+				std::size_t rowIndex = firstRow + panelRow + row;
+				std::size_t stepIndex = firstStep + step;
+				PackedType value = static_cast<PackedType>(0);
+				if (panelRow + row < numberOfRows)
+				{
+					value = static_cast<PackedType>(operands.transposeA == FixedPointTranspose::None ? operands.matrixA[rowIndex * operands.innerDimension + stepIndex] : operands.matrixA[stepIndex * operands.numberOfRows + rowIndex]);
+				}
+				*packedA++ = value;
+			}
+		}
+	}
+}
+/**
+ * @brief Pack a block of op(B) into panels of microTileColumns columns, stored step by step and padded with zeros.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param operands
+ * @param firstStep First index along the inner dimension.
+ * @param depth Number of steps along the inner dimension.
+ * @param firstColumn
+ * @param numberOfColumns
+ * @param packedB Receives ceil(numberOfColumns / microTileColumns) * microTileColumns * depth values.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointGemm<numberOfIntegerBits, numberOfFractionalBits>::packB(const Operands &operands, std::size_t firstStep, std::size_t depth, std::size_t firstColumn, std::size_t numberOfColumns, PackedType* packedB)
+{
+	for (std::size_t panelColumn = 0; panelColumn < numberOfColumns; panelColumn += microTileColumns)
+	{
+		for (std::size_t step = 0; step < depth; step++)
+		{
+			for (std::size_t column = 0; column < microTileColumns; column++)
+			{
+				std::size_t columnIndex = firstColumn + panelColumn + column;
+				std::size_t stepIndex = firstStep + step;
+				PackedType value = static_cast<PackedType>(0);
+				if (panelColumn + column < numberOfColumns)
+				{
+					value = static_cast<PackedType>(operands.transposeB == FixedPointTranspose::None ? operands.matrixB[stepIndex * operands.numberOfColumns + columnIndex] : operands.matrixB[columnIndex * operands.innerDimension + stepIndex]);
+				}
+				*packedB++ = value;
+			}
+		}
+	}
+}
+/**
+ * @brief Add the lane sums of a vector micro-kernel into the valid part of a tile of accumulators.
+ * @details Formats up to 16 bits keep each sum in lowSums. Wider formats keep the sum of the unsigned low halves of
+ * the products in lowSums and the sum of the signed high halves in highSums.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param lowSums
+ * @param highSums
+ * @param accumulators Top-left accumulator of the tile.
+ * @param accumulatorStride Distance between rows of accumulators.
+ * @param numberOfRows Valid rows of the tile.
+ * @param numberOfColumns Valid columns of the tile.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointGemm<numberOfIntegerBits, numberOfFractionalBits>::addTile(const int64_t lowSums[microTileRows][microTileColumns], const int64_t highSums[microTileRows][microTileColumns], AccumulatorType* accumulators, std::size_t accumulatorStride, std::size_t numberOfRows, std::size_t numberOfColumns)
+{
+	for (std::size_t row = 0; row < numberOfRows; row++)
+	{
+		for (std::size_t column = 0; column < numberOfColumns; column++)
+		{
+			AccumulatorType &accumulator = accumulators[row * accumulatorStride + column];
+			if constexpr (numberOfBits <= 16)
+			{
+				accumulator = static_cast<AccumulatorType>(accumulator + static_cast<AccumulatorType>(lowSums[row][column]));
+			}
+			else
+			{
+				accumulator = static_cast<AccumulatorType>(accumulator + static_cast<AccumulatorType>(static_cast<uint64_t>(lowSums[row][column])) + static_cast<AccumulatorType>(static_cast<AccumulatorType>(highSums[row][column]) << 32));
+			}
+		}
+	}
+}
+/**
+ * @brief Scalar reference micro-kernel, adding the exact product of two packed micro-panels into the accumulators.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param depth Number of packed steps.
+ * @param packedA microTileRows values per step.
+ * @param packedB microTileColumns values per step.
+ * @param accumulators Top-left accumulator of the tile.
+ * @param accumulatorStride Distance between rows of accumulators.
+ * @param numberOfRows Valid rows of the tile.
+ * @param numberOfColumns Valid columns of the tile.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointGemm<numberOfIntegerBits, numberOfFractionalBits>::microKernelScalar(std::size_t depth, const PackedType* packedA, const PackedType* packedB, AccumulatorType* accumulators, std::size_t accumulatorStride, std::size_t numberOfRows, std::size_t numberOfColumns)
+{
+	for (std::size_t row = 0; row < numberOfRows; row++)
+	{
+		for (std::size_t column = 0; column < numberOfColumns; column++)
+		{
+			AccumulatorType sum = static_cast<AccumulatorType>(0);
+			for (std::size_t step = 0; step < depth; step++)
+			{
+				if constexpr (hasVectorKernels)
+				{
+					sum = static_cast<AccumulatorType>(sum + static_cast<AccumulatorType>(static_cast<int64_t>(packedA[step * microTileRows + row]) * static_cast<int64_t>(packedB[step * microTileColumns + column])));
+				}
+				else
+				{
+					sum = static_cast<AccumulatorType>(sum + static_cast<AccumulatorType>(packedA[step * microTileRows + row]) * static_cast<AccumulatorType>(packedB[step * microTileColumns + column]));
+				}
+			}
+			accumulators[row * accumulatorStride + column] = static_cast<AccumulatorType>(accumulators[row * accumulatorStride + column] + sum);
+		}
+	}
+}
+#if FIXEDPOINT_X86_KERNELS
+/**
+ * @brief Multiply a packed micro-panel of A by a packed micro-panel of B with SSE4.1 and add the exact tile into the
+ * accumulators.
+ * @details Each element of B is sign-extended to a 64-bit lane and multiplied by a broadcast element of A with
+ * mul_epi32. Products of formats up to 16 bits fit in 31 bits and are summed directly; wider products are split into
+ * an unsigned low half and a signed high half, which blockDepth bounds far below overflow.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param depth Number of packed steps, at most blockDepth.
+ * @param packedA microTileRows values per step.
+ * @param packedB microTileColumns values per step.
+ * @param accumulators Top-left accumulator of the tile.
+ * @param accumulatorStride Distance between rows of accumulators.
+ * @param numberOfRows Valid rows of the tile.
+ * @param numberOfColumns Valid columns of the tile.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("sse4.1"))) void FixedPointGemm<numberOfIntegerBits, numberOfFractionalBits>::microKernelSse41(std::size_t depth, const PackedType* packedA, const PackedType* packedB, AccumulatorType* accumulators, std::size_t accumulatorStride, std::size_t numberOfRows, std::size_t numberOfColumns)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m128i) / sizeof(int64_t);
+	constexpr std::size_t numberOfVectors = microTileColumns / numberOfLanes;
+	__m128i lowSums[microTileRows][numberOfVectors];
+	__m128i highSums[microTileRows][numberOfVectors];
+	for (std::size_t row = 0; row < microTileRows; row++)
+	{
+		for (std::size_t vector = 0; vector < numberOfVectors; vector++)
+		{
+			lowSums[row][vector] = _mm_setzero_si128();
+			highSums[row][vector] = _mm_setzero_si128();
+		}
+	}
+	const __m128i lowHalfMask = _mm_set1_epi64x(0xFFFFFFFFLL);
+	for (std::size_t step = 0; step < depth; step++)
+	{
+		__m128i vectorsB[numberOfVectors];
+		for (std::size_t vector = 0; vector < numberOfVectors; vector++)
+		{
+			vectorsB[vector] = _mm_cvtepi32_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(packedB + step * microTileColumns + vector * numberOfLanes)));
+		}
+		for (std::size_t row = 0; row < microTileRows; row++)
+		{
+			__m128i vectorA = _mm_set1_epi64x(static_cast<long long>(packedA[step * microTileRows + row]));
+			for (std::size_t vector = 0; vector < numberOfVectors; vector++)
+			{
+				__m128i products = _mm_mul_epi32(vectorA, vectorsB[vector]);
+				if constexpr (numberOfBits <= 16)
+				{
+					lowSums[row][vector] = _mm_add_epi64(lowSums[row][vector], products);
+				}
+				else
+				{
+					lowSums[row][vector] = _mm_add_epi64(lowSums[row][vector], _mm_and_si128(products, lowHalfMask));
+					highSums[row][vector] = _mm_add_epi64(highSums[row][vector], _mm_sub_epi64(_mm_srli_epi64(products, 32), _mm_slli_epi64(_mm_srli_epi64(products, 63), 32)));
+				}
+			}
+		}
+	}
+	alignas(__m128i) int64_t tileLowSums[microTileRows][microTileColumns];
+	alignas(__m128i) int64_t tileHighSums[microTileRows][microTileColumns];
+	for (std::size_t row = 0; row < microTileRows; row++)
+	{
+		for (std::size_t vector = 0; vector < numberOfVectors; vector++)
+		{
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(tileLowSums[row] + vector * numberOfLanes), lowSums[row][vector]);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(tileHighSums[row] + vector * numberOfLanes), highSums[row][vector]);
+		}
+	}
+	addTile(tileLowSums, tileHighSums, accumulators, accumulatorStride, numberOfRows, numberOfColumns);
+}
+/**
+ * @brief Multiply a packed micro-panel of A by a packed micro-panel of B with AVX2 and add the exact tile into the
+ * accumulators.
+ * @details Each element of B is sign-extended to a 64-bit lane and multiplied by a broadcast element of A with
+ * mul_epi32. Products of formats up to 16 bits fit in 31 bits and are summed directly; wider products are split into
+ * an unsigned low half and a signed high half, which blockDepth bounds far below overflow.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param depth Number of packed steps, at most blockDepth.
+ * @param packedA microTileRows values per step.
+ * @param packedB microTileColumns values per step.
+ * @param accumulators Top-left accumulator of the tile.
+ * @param accumulatorStride Distance between rows of accumulators.
+ * @param numberOfRows Valid rows of the tile.
+ * @param numberOfColumns Valid columns of the tile.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx2"))) void FixedPointGemm<numberOfIntegerBits, numberOfFractionalBits>::microKernelAvx2(std::size_t depth, const PackedType* packedA, const PackedType* packedB, AccumulatorType* accumulators, std::size_t accumulatorStride, std::size_t numberOfRows, std::size_t numberOfColumns)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m256i) / sizeof(int64_t);
+	constexpr std::size_t numberOfVectors = microTileColumns / numberOfLanes;
+	__m256i lowSums[microTileRows][numberOfVectors];
+	__m256i highSums[microTileRows][numberOfVectors];
+	for (std::size_t row = 0; row < microTileRows; row++)
+	{
+		for (std::size_t vector = 0; vector < numberOfVectors; vector++)
+		{
+			lowSums[row][vector] = _mm256_setzero_si256();
+			highSums[row][vector] = _mm256_setzero_si256();
+		}
+	}
+	const __m256i lowHalfMask = _mm256_set1_epi64x(0xFFFFFFFFLL);
+	for (std::size_t step = 0; step < depth; step++)
+	{
+		__m256i vectorsB[numberOfVectors];
+		for (std::size_t vector = 0; vector < numberOfVectors; vector++)
+		{
+			vectorsB[vector] = _mm256_cvtepi32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(packedB + step * microTileColumns + vector * numberOfLanes)));
+		}
+		for (std::size_t row = 0; row < microTileRows; row++)
+		{
+			__m256i vectorA = _mm256_set1_epi64x(static_cast<long long>(packedA[step * microTileRows + row]));
+			for (std::size_t vector = 0; vector < numberOfVectors; vector++)
+			{
+				__m256i products = _mm256_mul_epi32(vectorA, vectorsB[vector]);
+				if constexpr (numberOfBits <= 16)
+				{
+					lowSums[row][vector] = _mm256_add_epi64(lowSums[row][vector], products);
+				}
+				else
+				{
+					lowSums[row][vector] = _mm256_add_epi64(lowSums[row][vector], _mm256_and_si256(products, lowHalfMask));
+					highSums[row][vector] = _mm256_add_epi64(highSums[row][vector], _mm256_sub_epi64(_mm256_srli_epi64(products, 32), _mm256_slli_epi64(_mm256_srli_epi64(products, 63), 32)));
+				}
+			}
+		}
+	}
+	alignas(__m256i) int64_t tileLowSums[microTileRows][microTileColumns];
+	alignas(__m256i) int64_t tileHighSums[microTileRows][microTileColumns];
+	for (std::size_t row = 0; row < microTileRows; row++)
+	{
+		for (std::size_t vector = 0; vector < numberOfVectors; vector++)
+		{
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(tileLowSums[row] + vector * numberOfLanes), lowSums[row][vector]);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(tileHighSums[row] + vector * numberOfLanes), highSums[row][vector]);
+		}
+	}
+	addTile(tileLowSums, tileHighSums, accumulators, accumulatorStride, numberOfRows, numberOfColumns);
+}
+// GCC 12 reports the undefined pass-through operands inside the AVX-512 intrinsics as (maybe-)uninitialized.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+/**
+ * @brief Multiply a packed micro-panel of A by a packed micro-panel of B with AVX-512 and add the exact tile into the
+ * accumulators.
+ * @details Each element of B is sign-extended to a 64-bit lane and multiplied by a broadcast element of A with
+ * mul_epi32. Products of formats up to 16 bits fit in 31 bits and are summed directly; wider products are split into
+ * an unsigned low half and a signed high half, which blockDepth bounds far below overflow.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param depth Number of packed steps, at most blockDepth.
+ * @param packedA microTileRows values per step.
+ * @param packedB microTileColumns values per step.
+ * @param accumulators Top-left accumulator of the tile.
+ * @param accumulatorStride Distance between rows of accumulators.
+ * @param numberOfRows Valid rows of the tile.
+ * @param numberOfColumns Valid columns of the tile.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx512f,avx512bw"))) void FixedPointGemm<numberOfIntegerBits, numberOfFractionalBits>::microKernelAvx512(std::size_t depth, const PackedType* packedA, const PackedType* packedB, AccumulatorType* accumulators, std::size_t accumulatorStride, std::size_t numberOfRows, std::size_t numberOfColumns)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m512i) / sizeof(int64_t);
+	constexpr std::size_t numberOfVectors = microTileColumns / numberOfLanes;
+	__m512i lowSums[microTileRows][numberOfVectors];
+	__m512i highSums[microTileRows][numberOfVectors];
+	for (std::size_t row = 0; row < microTileRows; row++)
+	{
+		for (std::size_t vector = 0; vector < numberOfVectors; vector++)
+		{
+			lowSums[row][vector] = _mm512_setzero_si512();
+			highSums[row][vector] = _mm512_setzero_si512();
+		}
+	}
+	const __m512i lowHalfMask = _mm512_set1_epi64(0xFFFFFFFFLL);
+	for (std::size_t step = 0; step < depth; step++)
+	{
+		__m512i vectorsB[numberOfVectors];
+		for (std::size_t vector = 0; vector < numberOfVectors; vector++)
+		{
+			vectorsB[vector] = _mm512_cvtepi32_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(packedB + step * microTileColumns + vector * numberOfLanes)));
+		}
+		for (std::size_t row = 0; row < microTileRows; row++)
+		{
+			__m512i vectorA = _mm512_set1_epi64(static_cast<long long>(packedA[step * microTileRows + row]));
+			for (std::size_t vector = 0; vector < numberOfVectors; vector++)
+			{
+				__m512i products = _mm512_mul_epi32(vectorA, vectorsB[vector]);
+				if constexpr (numberOfBits <= 16)
+				{
+					lowSums[row][vector] = _mm512_add_epi64(lowSums[row][vector], products);
+				}
+				else
+				{
+					lowSums[row][vector] = _mm512_add_epi64(lowSums[row][vector], _mm512_and_si512(products, lowHalfMask));
+					highSums[row][vector] = _mm512_add_epi64(highSums[row][vector], _mm512_sub_epi64(_mm512_srli_epi64(products, 32), _mm512_slli_epi64(_mm512_srli_epi64(products, 63), 32)));
+				}
+			}
+		}
+	}
+	alignas(__m512i) int64_t tileLowSums[microTileRows][microTileColumns];
+	alignas(__m512i) int64_t tileHighSums[microTileRows][microTileColumns];
+	for (std::size_t row = 0; row < microTileRows; row++)
+	{
+		for (std::size_t vector = 0; vector < numberOfVectors; vector++)
+		{
+			_mm512_storeu_si512(tileLowSums[row] + vector * numberOfLanes, lowSums[row][vector]);
+			_mm512_storeu_si512(tileHighSums[row] + vector * numberOfLanes, highSums[row][vector]);
+		}
+	}
+	addTile(tileLowSums, tileHighSums, accumulators, accumulatorStride, numberOfRows, numberOfColumns);
+}
+#pragma GCC diagnostic pop
+#endif
+/**
+ * @brief Compute one rectangular block of C, looping over cache blocks of the columns and the rows, and over the inner
+ * dimension and the micro-tiles within each of them.
+ * @details Each blockRows by blockColumns tile of C keeps its exact sums in one reused buffer of accumulators across
+ * the whole inner dimension, then has the bias added and is rounded into C before the next tile starts, so the scratch
+ * memory does not grow with the size of C. B is repacked for every tile row, which costs one copy per blockRows
+ * multiply-adds.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam resultIntegerBits
+ * @tparam resultFractionalBits
+ * @tparam rounding
+ * @param operands
+ * @param firstRow
+ * @param lastRow One past the last row of the block.
+ * @param firstColumn
+ * @param lastColumn One past the last column of the block.
+ * @param bias Empty, or one value per column of C.
+ * @param matrixC
+ * @param instructionSet
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <int resultIntegerBits, int resultFractionalBits, FixedPointRounding rounding>
+void FixedPointGemm<numberOfIntegerBits, numberOfFractionalBits>::multiplyBlock(const Operands &operands, std::size_t firstRow, std::size_t lastRow, std::size_t firstColumn, std::size_t lastColumn, std::span<const ValueType> bias, std::span<FixedPointNumber<resultIntegerBits, resultFractionalBits>> matrixC, FixedPointInstructionSet instructionSet)
+{
+	const std::size_t accumulatorStride = blockColumns;
+	std::vector<PackedType> packedA(blockRows * blockDepth);
+	std::vector<PackedType> packedB(blockColumns * blockDepth);
+	std::vector<AccumulatorType> accumulators(blockRows * blockColumns);
+	for (std::size_t blockColumn = firstColumn; blockColumn < lastColumn; blockColumn += blockColumns)
+	{
+		std::size_t numberOfBlockColumns = std::min(blockColumns, lastColumn - blockColumn);
+		for (std::size_t blockRow = firstRow; blockRow < lastRow; blockRow += blockRows)
+		{
+			std::size_t numberOfBlockRows = std::min(blockRows, lastRow - blockRow);
+			std::fill(accumulators.begin(), accumulators.end(), static_cast<AccumulatorType>(0));
+			for (std::size_t blockStep = 0; blockStep < operands.innerDimension; blockStep += blockDepth)
+			{
+				std::size_t depth = std::min(blockDepth, operands.innerDimension - blockStep);
+				packB(operands, blockStep, depth, blockColumn, numberOfBlockColumns, packedB.data());
+				packA(operands, blockRow, numberOfBlockRows, blockStep, depth, packedA.data());
+				for (std::size_t tileColumn = 0; tileColumn < numberOfBlockColumns; tileColumn += microTileColumns)
+				{
+					const PackedType* panelB = packedB.data() + tileColumn * depth;
+					for (std::size_t tileRow = 0; tileRow < numberOfBlockRows; tileRow += microTileRows)
+					{
+						const PackedType* panelA = packedA.data() + tileRow * depth;
+						AccumulatorType* tileAccumulators = accumulators.data() + tileRow * accumulatorStride + tileColumn;
+						std::size_t numberOfTileRows = std::min(microTileRows, numberOfBlockRows - tileRow);
+						std::size_t numberOfTileColumns = std::min(microTileColumns, numberOfBlockColumns - tileColumn);
+						switch (instructionSet)
+						{
+#if FIXEDPOINT_X86_KERNELS
+						case FixedPointInstructionSet::Avx512:
+							microKernelAvx512(depth, panelA, panelB, tileAccumulators, accumulatorStride, numberOfTileRows, numberOfTileColumns);
+							break;
+						case FixedPointInstructionSet::Avx2:
+							microKernelAvx2(depth, panelA, panelB, tileAccumulators, accumulatorStride, numberOfTileRows, numberOfTileColumns);
+							break;
+						case FixedPointInstructionSet::Sse41:
+							microKernelSse41(depth, panelA, panelB, tileAccumulators, accumulatorStride, numberOfTileRows, numberOfTileColumns);
+							break;
+#endif
+						default:
+							microKernelScalar(depth, panelA, panelB, tileAccumulators, accumulatorStride, numberOfTileRows, numberOfTileColumns);
+							break;
+						}
+					}
+				}
+			}
+			for (std::size_t row = 0; row < numberOfBlockRows; row++)
+			{
+				for (std::size_t column = 0; column < numberOfBlockColumns; column++)
+				{
+					AccumulatorType accumulator = accumulators[row * accumulatorStride + column];
+					if (!bias.empty())
+					{
+						accumulator = static_cast<AccumulatorType>(accumulator + static_cast<AccumulatorType>(static_cast<AccumulatorType>(bias[blockColumn + column].getRawValue()) << numberOfFractionalBits));
+					}
+					matrixC[(blockRow + row) * operands.numberOfColumns + blockColumn + column] = FixedPointNumber<resultIntegerBits, resultFractionalBits>::template fromScaledInteger<rounding>(accumulator, 2 * numberOfFractionalBits);
+				}
+			}
+		}
+	}
+}
+/**
+ * @brief Multiply two fixed-point matrices, C = op(A) * op(B) + bias, rounding once per output.
+ * @details Throws std::invalid_argument when a span does not match the dimensions.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam resultIntegerBits Number of integer bits of C; defaults to the format of the operands.
+ * @tparam resultFractionalBits Number of fractional bits of C; defaults to the format of the operands.
+ * @tparam rounding The rounding applied once to every output.
+ * @param numberOfRows Rows of op(A) and C.
+ * @param numberOfColumns Columns of op(B) and C.
+ * @param innerDimension Columns of op(A) and rows of op(B).
+ * @param matrixA
+ * @param transposeA
+ * @param matrixB
+ * @param transposeB
+ * @param matrixC Receives the product; must not overlap A or B.
+ * @param bias Empty, or one value per column of C added to every row before rounding.
+ * @param instructionSet Most capable instruction set to use; defaults to the best one the processor supports.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <int resultIntegerBits, int resultFractionalBits, FixedPointRounding rounding>
+void FixedPointGemm<numberOfIntegerBits, numberOfFractionalBits>::multiply(std::size_t numberOfRows, std::size_t numberOfColumns, std::size_t innerDimension, std::span<const ValueType> matrixA, FixedPointTranspose transposeA, std::span<const ValueType> matrixB, FixedPointTranspose transposeB, std::type_identity_t<std::span<FixedPointNumber<resultIntegerBits, resultFractionalBits>>> matrixC, std::span<const ValueType> bias, FixedPointInstructionSet instructionSet)
+{
+	static_assert(sizeof(ValueType) == sizeof(StorageType) && std::is_standard_layout_v<ValueType>, "FixedPointNumber must be layout-compatible with its storage.");
+	if (matrixA.size() != numberOfRows * innerDimension || matrixB.size() != innerDimension * numberOfColumns || matrixC.size() != numberOfRows * numberOfColumns || (!bias.empty() && bias.size() != numberOfColumns))
+	{
+		throw std::invalid_argument("Fixed-point matrix dimensions do not match.");
+	}
+	Operands operands = {reinterpret_cast<const StorageType*>(matrixA.data()), reinterpret_cast<const StorageType*>(matrixB.data()), numberOfRows, numberOfColumns, innerDimension, transposeA, transposeB};
+	FixedPointInstructionSet selectedInstructionSet = selectInstructionSet(instructionSet);
+	bool isSplitByRows = numberOfRows >= numberOfColumns;
+	std::size_t splitDimension = isSplitByRows ? numberOfRows : numberOfColumns;
+	std::size_t numberOfThreads = std::min<std::size_t>(fixedPointDefaultThreadPool().getNumberOfThreads(), numberOfRows * numberOfColumns * innerDimension / parallelThreshold);
+	numberOfThreads = std::max<std::size_t>(std::min(numberOfThreads, splitDimension / microTileColumns), 1);
+	std::size_t chunkSize = (splitDimension + numberOfThreads - 1) / numberOfThreads;
+	auto multiplyChunk = [&](std::size_t firstIndex, std::size_t lastIndex)
+	{
+		std::size_t firstRow = isSplitByRows ? firstIndex : 0;
+		std::size_t lastRow = isSplitByRows ? lastIndex : numberOfRows;
+		std::size_t firstColumn = isSplitByRows ? 0 : firstIndex;
+		std::size_t lastColumn = isSplitByRows ? numberOfColumns : lastIndex;
+		multiplyBlock<resultIntegerBits, resultFractionalBits, rounding>(operands, firstRow, lastRow, firstColumn, lastColumn, bias, matrixC, selectedInstructionSet);
+	};
+	fixedPointDefaultThreadPool().parallelFor(numberOfThreads, [&](std::size_t chunk)
+	{
+		multiplyChunk(std::min(chunk * chunkSize, splitDimension), std::min((chunk + 1) * chunkSize, splitDimension));
+	});
+}
+#endif
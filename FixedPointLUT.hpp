@@ -0,0 +1,211 @@
+/**
+ * @file FixedPointLUT.hpp
+ * @author Robert Connor Luce
+ * @brief Header file for FixedPointLUT class, an interpolated lookup table of a function of fixed-point numbers.
+ */
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <span>
+#include <stdexcept>
+#include "FixedPointNumber.hpp"
+#ifndef FIXEDPOINTLUT_HPP
+#define FIXEDPOINTLUT_HPP
+/**
+ * @brief How a lookup table interpolates between the samples of its function.
+ */
+enum class FixedPointInterpolation
+{
+	Linear,		///< A straight line through the samples at both ends of each segment.
+	Quadratic	///< A parabola through the samples at both ends and the middle of each segment.
+};
+/**
+ * @brief Class template of a lookup table that approximates a function over a closed domain of fixed-point numbers.
+ * @details The domain is split into 2^numberOfIndexBits segments of equal width, and the width of the domain must be a
+ * power of two least significant bits, so that the high bits of the offset of an argument from the start of the domain
+ * index its segment and the low bits are the position within it. Each segment stores the coefficients of its
+ * interpolating polynomial in that position, so an evaluation is one load of the segment followed by one multiply-add
+ * for Linear or two for Quadratic, in integers wide enough to be exact, and one rounding. The constructor samples the
+ * generator in double precision and is constexpr, so a table declared constexpr is computed entirely at compile time.
+ * The interpolation error falls with the square of the segment width for Linear and with its cube for Quadratic, and
+ * the table reproduces every sample at the ends of the segments to within half a least significant bit. Arguments
+ * outside the domain are clamped to it.
+ * @tparam numberOfIntegerBits Number of bits allocated for the integer part.
+ * @tparam numberOfFractionalBits Number of bits allocated for the fractional part.
+ * @tparam numberOfIndexBits Base-2 logarithm of the number of segments.
+ * @tparam interpolation
+ */
+template<int numberOfIntegerBits, int numberOfFractionalBits, int numberOfIndexBits, FixedPointInterpolation interpolation = FixedPointInterpolation::Linear>
+class FixedPointLUT
+{
+public:
+	using ValueType = FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>;
+	using StorageType = typename ValueType::StorageType;
+	static constexpr std::size_t numberOfSegments = std::size_t(1) << numberOfIndexBits;
+private:
+	static constexpr int numberOfBits = numberOfIntegerBits + numberOfFractionalBits;
+	static_assert(numberOfIndexBits >= 0 && numberOfIndexBits < numberOfBits, "A lookup table needs fewer index bits than the format has bits.");
+	static constexpr int numberOfCoefficients = interpolation == FixedPointInterpolation::Linear ? 2 : 3;
+	using CoefficientType = typename FixedPointStorage<numberOfBits + 4>::SignedType;
+	using OffsetType = typename ValueType::WideStorageType;
+	using ProductType = typename FixedPointStorage<interpolation == FixedPointInterpolation::Linear ? 2 * numberOfBits : 2 * numberOfBits + 4>::SignedType;
+	struct Segment
+	{
+		CoefficientType coefficients[numberOfCoefficients];
+	};
+	std::array<Segment, numberOfSegments + 1> segments;
+	OffsetType minimumRawValue;
+	OffsetType domainWidth;
+	int segmentShift;
+public:
+	template<typename Generator>
+	constexpr FixedPointLUT(Generator generator, const ValueType &minimum, const ValueType &maximum);
+	constexpr ValueType minimum() const;
+	constexpr ValueType maximum() const;
+	constexpr ValueType evaluate(const ValueType &value) const;
+	void evaluate(std::span<const ValueType> values, std::span<ValueType> result) const;
+};
+/**
+ * @brief Construct a new Fixed Point LUT object by sampling a function over the domain [minimum, maximum].
+ * @details The generator is called with the argument as a double at both ends of every segment, and for Quadratic at
+ * its middle, and its results are rounded to the coefficients of the interpolating polynomials. The end samples are
+ * rounded and saturated to the format and the coefficients are derived from them, so adjacent segments meet exactly,
+ * and the coefficients are four bits wider than the format so that they cannot overflow. A segment past the end holds
+ * the value at maximum, so that the end of the domain needs no special case when the table is evaluated.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam numberOfIndexBits
+ * @tparam interpolation
+ * @tparam Generator A callable from double to double, usable in constant expressions for a constexpr table.
+ * @param generator
+ * @param minimum
+ * @param maximum
+ * @throws std::invalid_argument If maximum - minimum is not a power of two least significant bits of at least
+ * numberOfSegments.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, int numberOfIndexBits, FixedPointInterpolation interpolation>
+template <typename Generator>
+constexpr FixedPointLUT<numberOfIntegerBits, numberOfFractionalBits, numberOfIndexBits, interpolation>::FixedPointLUT(Generator generator, const ValueType &minimum, const ValueType &maximum)
+	: segments{}, minimumRawValue(static_cast<OffsetType>(minimum.getRawValue())), domainWidth(static_cast<OffsetType>(static_cast<OffsetType>(maximum.getRawValue()) - static_cast<OffsetType>(minimum.getRawValue()))), segmentShift(0)
+{
+	const OffsetType one = static_cast<OffsetType>(1);
+	while (segmentShift + numberOfIndexBits < numberOfBits && static_cast<OffsetType>(one << (segmentShift + numberOfIndexBits)) < this->domainWidth)
+	{
+		segmentShift++;
+	}
+	if (static_cast<OffsetType>(one << (segmentShift + numberOfIndexBits)) != this->domainWidth)
+	{
+		throw std::invalid_argument("Lookup table domain must span a power of two least significant bits, at least one per segment.");
+	}
+	const double leastSignificantBit = ValueType::fromRawValue(static_cast<StorageType>(1)).toDouble();
+	const double segmentWidth = static_cast<double>(one << segmentShift) * leastSignificantBit;
+	const double minimumValue = minimum.toDouble();
+	auto roundedSample = [&](std::size_t index)
+	{
+		return static_cast<CoefficientType>(ValueType::fromDouble(generator(minimumValue + static_cast<double>(index) * segmentWidth)).getRawValue());
+	};
+	CoefficientType startSample = roundedSample(0);
+	for (std::size_t index = 0; index < numberOfSegments; index++)
+	{
+		CoefficientType endSample = roundedSample(index + 1);
+		Segment &segment = this->segments[index];
+		segment.coefficients[0] = startSample;
+		if constexpr (interpolation == FixedPointInterpolation::Linear)
+		{
+			segment.coefficients[1] = static_cast<CoefficientType>(endSample - startSample);
+		}
+		else
+		{
+			double middleSample = generator(minimumValue + (static_cast<double>(index) + 0.5) * segmentWidth);
+			double startValue = static_cast<double>(startSample) * leastSignificantBit;
+			double endValue = static_cast<double>(endSample) * leastSignificantBit;
+			segment.coefficients[1] = static_cast<CoefficientType>(FixedPointNumber<numberOfIntegerBits + 3, numberOfFractionalBits>::fromDouble(4.0 * middleSample - 3.0 * startValue - endValue).getRawValue());
+			segment.coefficients[2] = static_cast<CoefficientType>(endSample - startSample - segment.coefficients[1]);
+		}
+		startSample = endSample;
+	}
+	this->segments[numberOfSegments].coefficients[0] = startSample;
+}
+/**
+ * @brief Get the start of the domain.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam numberOfIndexBits
+ * @tparam interpolation
+ * @return ValueType
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, int numberOfIndexBits, FixedPointInterpolation interpolation>
+constexpr typename FixedPointLUT<numberOfIntegerBits, numberOfFractionalBits, numberOfIndexBits, interpolation>::ValueType FixedPointLUT<numberOfIntegerBits, numberOfFractionalBits, numberOfIndexBits, interpolation>::minimum() const
+{
+	return ValueType::fromRawValue(static_cast<StorageType>(this->minimumRawValue));
+}
+/**
+ * @brief Get the end of the domain.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam numberOfIndexBits
+ * @tparam interpolation
+ * @return ValueType
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, int numberOfIndexBits, FixedPointInterpolation interpolation>
+constexpr typename FixedPointLUT<numberOfIntegerBits, numberOfFractionalBits, numberOfIndexBits, interpolation>::ValueType FixedPointLUT<numberOfIntegerBits, numberOfFractionalBits, numberOfIndexBits, interpolation>::maximum() const
+{
+	return ValueType::fromRawValue(static_cast<StorageType>(this->minimumRawValue + this->domainWidth));
+}
+/**
+ * @brief Evaluate the interpolated function at one argument.
+ * @details The offset of the argument from the start of the domain is clamped to the domain and split into the index
+ * of its segment and the position t within it, in units of 2^-segmentShift of the segment. The polynomial
+ * c0 + t * c1, or c0 + t * (c1 + t * c2) with the inner product rounded once, is evaluated exactly in ProductType and
+ * rounded once to the format, saturating like fromScaledInteger.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam numberOfIndexBits
+ * @tparam interpolation
+ * @param value
+ * @return ValueType
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, int numberOfIndexBits, FixedPointInterpolation interpolation>
+constexpr typename FixedPointLUT<numberOfIntegerBits, numberOfFractionalBits, numberOfIndexBits, interpolation>::ValueType FixedPointLUT<numberOfIntegerBits, numberOfFractionalBits, numberOfIndexBits, interpolation>::evaluate(const ValueType &value) const
+{
+	const OffsetType zero = static_cast<OffsetType>(0);
+	OffsetType offset = static_cast<OffsetType>(static_cast<OffsetType>(value.getRawValue()) - this->minimumRawValue);
+	offset = offset < zero ? zero : (offset > this->domainWidth ? this->domainWidth : offset);
+	const Segment &segment = this->segments[static_cast<std::size_t>(static_cast<OffsetType>(offset >> this->segmentShift))];
+	ProductType position = static_cast<ProductType>(static_cast<OffsetType>(offset & static_cast<OffsetType>((static_cast<OffsetType>(1) << this->segmentShift) - static_cast<OffsetType>(1))));
+	ProductType slope = static_cast<ProductType>(segment.coefficients[1]);
+	if constexpr (interpolation == FixedPointInterpolation::Quadratic)
+	{
+		ProductType curvature = static_cast<ProductType>(static_cast<ProductType>(segment.coefficients[2]) * position);
+		if (this->segmentShift > 0)
+		{
+			curvature = static_cast<ProductType>(static_cast<ProductType>(curvature + static_cast<ProductType>(static_cast<ProductType>(1) << (this->segmentShift - 1))) >> this->segmentShift);
+		}
+		slope = static_cast<ProductType>(slope + curvature);
+	}
+	ProductType scaledValue = static_cast<ProductType>(static_cast<ProductType>(static_cast<ProductType>(segment.coefficients[0]) << this->segmentShift) + static_cast<ProductType>(slope * position));
+	return ValueType::fromScaledInteger(scaledValue, numberOfFractionalBits + this->segmentShift);
+}
+/**
+ * @brief Evaluate the interpolated function at every element of a span.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam numberOfIndexBits
+ * @tparam interpolation
+ * @param values
+ * @param result Receives the function values; may alias the input.
+ * @throws std::invalid_argument If the spans have different sizes.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, int numberOfIndexBits, FixedPointInterpolation interpolation>
+void FixedPointLUT<numberOfIntegerBits, numberOfFractionalBits, numberOfIndexBits, interpolation>::evaluate(std::span<const ValueType> values, std::span<ValueType> result) const
+{
+	if (values.size() != result.size())
+	{
+		throw std::invalid_argument("Fixed-point spans must have the same number of elements.");
+	}
+	for (std::size_t index = 0; index < result.size(); index++)
+	{
+		result[index] = this->evaluate(values[index]);
+	}
+}
+#endif
@@ -4,796 +4,2629 @@
  * @brief Header file for FixedPointNumber class for fixed-point arithmetic.
  */
 #include <cstdint>
-#include <string>
 #include <cmath>
+#include <string>
 #include <iostream>
 #include <bitset>
-#include <sstream>
-#include <iomanip>
+#include <stdexcept>
+#include <type_traits>
+#include <compare>
+#include <charconv>
+#include <string_view>
+#include <span>
+#include <random>
+#include <system_error>
+#include "FixedPointWideInteger.hpp"
 #ifndef FIXEDPOINTNUMBER_HPP
 #define FIXEDPOINTNUMBER_HPP
+/**
+ * @brief Rounding applied when low-order bits are discarded from an exact intermediate result.
+ */
+enum class FixedPointRounding
+{
+	Truncate,		///< Round toward zero.
+	Floor,			///< Round toward negative infinity.
+	RoundHalfUp,	///< Round to nearest, ties toward positive infinity.
+	RoundHalfEven,	///< Round to nearest, ties to the even neighbour.
+	Stochastic		///< Round up with probability equal to the discarded fraction, using a random bit generator.
+};
+/**
+ * @brief Random bit generator used for FixedPointRounding::Stochastic when no generator is supplied, as by the
+ * operators and the string constructor. Each thread has its own generator with the default seed; reseed it for a
+ * different sequence.
+ */
+inline thread_local std::mt19937_64 fixedPointRandomBitGenerator;
+/**
+ * @brief Stateless handle to fixedPointRandomBitGenerator of the calling thread, used as the default generator argument
+ * so that functions which do not round stochastically stay usable in constant expressions.
+ */
+struct FixedPointThreadRandomBitGenerator
+{
+	using result_type = std::mt19937_64::result_type;
+	static constexpr result_type min()
+	{
+		return std::mt19937_64::min();
+	}
+	static constexpr result_type max()
+	{
+		return std::mt19937_64::max();
+	}
+	result_type operator()() const
+	{
+		return fixedPointRandomBitGenerator();
+	}
+};
+/**
+ * @brief What arithmetic does with a result that lies outside the range of the format.
+ * @details The policy is a template parameter, so the checks are resolved at compile time and Wrap compiles to the
+ * same plain two's complement arithmetic as an unchecked integer.
+ */
+enum class FixedPointOverflow
+{
+	Wrap,		///< Keep the low bits of the result, as two's complement integers do.
+	Saturate,	///< Clamp to the largest or smallest representable number.
+	Throw,		///< Throw std::overflow_error.
+	Sticky		///< Clamp like Saturate and set fixedPointOverflowFlag, which stays set until cleared.
+};
+/**
+ * @brief Set by arithmetic on FixedPointOverflow::Sticky numbers whenever a result saturates; never cleared by the
+ * library. Each thread has its own flag.
+ */
+inline thread_local bool fixedPointOverflowFlag = false;
+/**
+ * @brief The decimal digits of 00 to 99 stored as consecutive character pairs, used to format two digits at a time.
+ */
+inline constexpr char fixedPointDigitPairs[201] =
+	"00010203040506070809"
+	"10111213141516171819"
+	"20212223242526272829"
+	"30313233343536373839"
+	"40414243444546474849"
+	"50515253545556575859"
+	"60616263646566676869"
+	"70717273747576777879"
+	"80818283848586878889"
+	"90919293949596979899";
+/**
+ * @brief 1 / (2 * pi) in units of 2^-62, which converts radians to turns.
+ */
+inline constexpr int64_t fixedPointInverseTwoPi = 0x0a2f9836e4e44153;
+/**
+ * @brief pi in units of 2^-60.
+ */
+inline constexpr int64_t fixedPointPi = 0x3243f6a8885a308d;
+/**
+ * @brief log2(e) in units of 2^-62, which converts a natural exponent to a binary one.
+ */
+inline constexpr int64_t fixedPointLog2E = 0x5c551d94ae0bf85e;
+/**
+ * @brief CORDIC rotation angles atan(2^-i) for i = 0 to 60, in units of 2^-62 turns.
+ */
+inline constexpr int64_t fixedPointCordicCircularTurns[61] =
+{
+	0x0800000000000000, 0x04b90147677cc21a, 0x027ece16d7b8e7a3, 0x0144447507776687,
+	0x00a2c350c39626bb, 0x005175f85641189e, 0x0028bd87970a098a, 0x00145f15447510ac,
+	0x000a2f94d1b430ce, 0x000517cbaecc2ace, 0x00028be600246e9f, 0x000145f3052a032e,
+	0x0000a2f98337fb18, 0x0000517cc1b05cbd, 0x000028be60daba44, 0x0000145f306dae9f,
+	0x00000a2f9836e17f, 0x00000517cc1b7205, 0x0000028be60db92b, 0x00000145f306dc9b,
+	0x000000a2f9836e4e, 0x000000517cc1b727, 0x00000028be60db94, 0x000000145f306dca,
+	0x0000000a2f9836e5, 0x0000000517cc1b72, 0x000000028be60db9, 0x0000000145f306dd,
+	0x00000000a2f9836e, 0x00000000517cc1b7, 0x0000000028be60dc, 0x00000000145f306e,
+	0x000000000a2f9837, 0x000000000517cc1b, 0x00000000028be60e, 0x000000000145f307,
+	0x0000000000a2f983, 0x0000000000517cc2, 0x000000000028be61, 0x0000000000145f30,
+	0x00000000000a2f98, 0x00000000000517cc, 0x0000000000028be6, 0x00000000000145f3,
+	0x000000000000a2fa, 0x000000000000517d, 0x00000000000028be, 0x000000000000145f,
+	0x0000000000000a30, 0x0000000000000518, 0x000000000000028c, 0x0000000000000146,
+	0x00000000000000a3, 0x0000000000000051, 0x0000000000000029, 0x0000000000000014,
+	0x000000000000000a, 0x0000000000000005, 0x0000000000000003, 0x0000000000000001,
+	0x0000000000000001
+};
+/**
+ * @brief CORDIC rotation angles atan(2^-i) for i = 0 to 60, in units of 2^-60 radians.
+ */
+inline constexpr int64_t fixedPointCordicCircularRadians[61] =
+{
+	0x0c90fdaa22168c23, 0x076b19c1586ed3da, 0x03eb6ebf25901bac, 0x01fd5ba9aac2f6dc,
+	0x00ffaaddb967ef4e, 0x007ff556eea5d893, 0x003ffeaab776e535, 0x001fffd555bbba97,
+	0x000ffffaaaaddddc, 0x0007ffff55556eef, 0x0003ffffeaaaab77, 0x0001fffffd55555c,
+	0x0000ffffffaaaaab, 0x00007ffffff55555, 0x00003ffffffeaaab, 0x00001fffffffd555,
+	0x00000ffffffffaab, 0x000007ffffffff55, 0x000003ffffffffeb, 0x000001fffffffffd,
+	0x0000010000000000, 0x0000008000000000, 0x0000004000000000, 0x0000002000000000,
+	0x0000001000000000, 0x0000000800000000, 0x0000000400000000, 0x0000000200000000,
+	0x0000000100000000, 0x0000000080000000, 0x0000000040000000, 0x0000000020000000,
+	0x0000000010000000, 0x0000000008000000, 0x0000000004000000, 0x0000000002000000,
+	0x0000000001000000, 0x0000000000800000, 0x0000000000400000, 0x0000000000200000,
+	0x0000000000100000, 0x0000000000080000, 0x0000000000040000, 0x0000000000020000,
+	0x0000000000010000, 0x0000000000008000, 0x0000000000004000, 0x0000000000002000,
+	0x0000000000001000, 0x0000000000000800, 0x0000000000000400, 0x0000000000000200,
+	0x0000000000000100, 0x0000000000000080, 0x0000000000000040, 0x0000000000000020,
+	0x0000000000000010, 0x0000000000000008, 0x0000000000000004, 0x0000000000000002,
+	0x0000000000000001
+};
+/**
+ * @brief CORDIC rotation angles atanh(2^-i) / ln(2) for i = 1 to 61, in units of 2^-61.
+ */
+inline constexpr int64_t fixedPointCordicHyperbolicAngles[61] =
+{
+	0x195c01a39fbd687a, 0x0bca9c6f53897a46, 0x05cd164897727741, 0x02e39fb9198ce62e,
+	0x01717341fb42b2e4, 0x00b8ae142f881dff, 0x005c5598b1fcf6f2, 0x002e2a9e2de52fd6,
+	0x00171549519c6a9f, 0x000b8aa3f023d786, 0x0005c551e0fca349, 0x0002e2a8ed9ba8af,
+	0x0001715476717f3a, 0x0000b8aa3b2d34f9, 0x00005c551d952928, 0x00002e2a8eca666a,
+	0x0000171547652d6f, 0x00000b8aa3b295ff, 0x000005c551d94ae8, 0x000002e2a8eca571,
+	0x00000171547652b8, 0x000000b8aa3b295c, 0x0000005c551d94ae, 0x0000002e2a8eca57,
+	0x000000171547652c, 0x0000000b8aa3b296, 0x00000005c551d94b, 0x00000002e2a8eca5,
+	0x0000000171547653, 0x00000000b8aa3b29, 0x000000005c551d95, 0x000000002e2a8eca,
+	0x0000000017154765, 0x000000000b8aa3b3, 0x0000000005c551d9, 0x0000000002e2a8ed,
+	0x0000000001715476, 0x0000000000b8aa3b, 0x00000000005c551e, 0x00000000002e2a8f,
+	0x0000000000171547, 0x00000000000b8aa4, 0x000000000005c552, 0x000000000002e2a9,
+	0x0000000000017154, 0x000000000000b8aa, 0x0000000000005c55, 0x0000000000002e2b,
+	0x0000000000001715, 0x0000000000000b8b, 0x00000000000005c5, 0x00000000000002e3,
+	0x0000000000000171, 0x00000000000000b9, 0x000000000000005c, 0x000000000000002e,
+	0x0000000000000017, 0x000000000000000c, 0x0000000000000006, 0x0000000000000003,
+	0x0000000000000001
+};
+/**
+ * @brief Scale of a circular CORDIC rotation after n iterations, the product of 1 / sqrt(1 + 2^-2i) for i below n, in
+ * units of 2^-61. It no longer changes after 31 iterations.
+ */
+inline constexpr int64_t fixedPointCordicCircularGains[32] =
+{
+	0x2000000000000000, 0x16a09e667f3bcc91, 0x143d136248490edb, 0x13a261ba6d7a3698,
+	0x137b9141deb3fded, 0x1371dac182eef58d, 0x136f6cfabd961f3d, 0x136ed1869f27e8c3,
+	0x136eaaa970b20ef8, 0x136ea0f222a6d08c, 0x136e9e844efd23e4, 0x136e9de8da104ae7,
+	0x136e9dc1fcd4edcb, 0x136e9db845861416, 0x136e9db5d7b25d82, 0x136e9db53c3d6fda,
+	0x136e9db515603470, 0x136e9db50ba8e596, 0x136e9db5093b11df, 0x136e9db5089f9cf2,
+	0x136e9db50878bfb6, 0x136e9db5086f0867, 0x136e9db5086c9a94, 0x136e9db5086bff1f,
+	0x136e9db5086bd841, 0x136e9db5086bce8a, 0x136e9db5086bcc1c, 0x136e9db5086bcb81,
+	0x136e9db5086bcb5a, 0x136e9db5086bcb50, 0x136e9db5086bcb4e, 0x136e9db5086bcb4d
+};
+/**
+ * @brief Inverse scale of a hyperbolic CORDIC rotation after n iterations, with iterations 4, 13 and 40 repeated, in
+ * units of 2^-61. It no longer changes after 31 iterations.
+ */
+inline constexpr int64_t fixedPointCordicHyperbolicGains[32] =
+{
+	0x2000000000000000, 0x24f34e8b2066389a, 0x262987b2553d219d, 0x2676c2c0bc274b6c,
+	0x269d6020dd044fbc, 0x26a234b4c1afff06, 0x26a369d4e4eb05e7, 0x26a3b71ca06c4f89,
+	0x26a3ca6e8a78107d, 0x26a3cf4304adb8bb, 0x26a3d07823364e4f, 0x26a3d0c56ad8266c,
+	0x26a3d0d8bcc0979f, 0x26a3d0e265b4d039, 0x26a3d0e39ad3575a, 0x26a3d0e3e81af922,
+	0x26a3d0e3fb6ce195, 0x26a3d0e400415bb1, 0x26a3d0e401767a38, 0x26a3d0e401c3c1da,
+	0x26a3d0e401d713c2, 0x26a3d0e401dbe83c, 0x26a3d0e401dd1d5b, 0x26a3d0e401dd6aa3,
+	0x26a3d0e401dd7df5, 0x26a3d0e401dd82c9, 0x26a3d0e401dd83fe, 0x26a3d0e401dd844b,
+	0x26a3d0e401dd845f, 0x26a3d0e401dd8464, 0x26a3d0e401dd8465, 0x26a3d0e401dd8465
+};
+/**
+ * @brief Number of CORDIC iterations the math functions run to resolve a result to a number of bits below the binary
+ * point: four more than the number of bits, up to the 61 bits of the working precision.
+ * @param numberOfResultBits
+ * @return int
+ */
+constexpr int fixedPointCordicIterations(int numberOfResultBits)
+{
+	return numberOfResultBits + 4 < 61 ? numberOfResultBits + 4 : 61;
+}
+/**
+ * @brief Integer storage selected at compile time from the total number of bits of a fixed-point format.
+ * @details Formats of up to 128 bits are stored in native integers, and wider ones in FixedPointWideInteger with as
+ * many 64-bit limbs as they need. AccumulatorType holds the exact sum of products of two raw values, which take
+ * 2 * numberOfBits bits each, with at least 32 guard bits to spare, so sums of billions of products cannot overflow.
+ * @tparam numberOfBits Total number of bits (integer plus fractional) of the format.
+ */
+template<int numberOfBits, bool isMultiLimb = (numberOfBits > 128)>
+struct FixedPointStorage
+{
+#ifdef __SIZEOF_INT128__
+	static_assert(numberOfBits > 0, "FixedPointNumber needs at least 1 total bit.");
+	using SignedType = std::conditional_t<(numberOfBits <= 8), int8_t, std::conditional_t<(numberOfBits <= 16), int16_t, std::conditional_t<(numberOfBits <= 32), int32_t, std::conditional_t<(numberOfBits <= 64), int64_t, FixedPointInt128>>>>;
+	using UnsignedType = std::conditional_t<(numberOfBits <= 8), uint8_t, std::conditional_t<(numberOfBits <= 16), uint16_t, std::conditional_t<(numberOfBits <= 32), uint32_t, std::conditional_t<(numberOfBits <= 64), uint64_t, FixedPointUInt128>>>>;
+	using WideSignedType = std::conditional_t<(numberOfBits <= 8), int16_t, std::conditional_t<(numberOfBits <= 16), int32_t, std::conditional_t<(numberOfBits <= 32), int64_t, std::conditional_t<(numberOfBits <= 64), FixedPointInt128, FixedPointWideInteger<4>>>>>;
+	using AccumulatorType = std::conditional_t<(numberOfBits <= 16), int64_t, std::conditional_t<(numberOfBits <= 32), FixedPointInt128, std::conditional_t<(numberOfBits <= 64), FixedPointWideInteger<3>, FixedPointWideInteger<5>>>>;
+#else
+	static_assert(numberOfBits > 0 && numberOfBits <= 64, "FixedPointNumber supports between 1 and 64 total bits on this compiler.");
+	using SignedType = std::conditional_t<(numberOfBits <= 8), int8_t, std::conditional_t<(numberOfBits <= 16), int16_t, std::conditional_t<(numberOfBits <= 32), int32_t, int64_t>>>;
+	using UnsignedType = std::conditional_t<(numberOfBits <= 8), uint8_t, std::conditional_t<(numberOfBits <= 16), uint16_t, std::conditional_t<(numberOfBits <= 32), uint32_t, uint64_t>>>;
+	using WideSignedType = std::conditional_t<(numberOfBits <= 8), int16_t, std::conditional_t<(numberOfBits <= 16), int32_t, std::conditional_t<(numberOfBits <= 32), int64_t, FixedPointWideInteger<2>>>>;
+	using AccumulatorType = std::conditional_t<(numberOfBits <= 16), int64_t, std::conditional_t<(numberOfBits <= 32), FixedPointWideInteger<2>, FixedPointWideInteger<3>>>;
+#endif
+	static constexpr int numberOfStorageBits = static_cast<int>(8 * sizeof(SignedType));
+};
+/**
+ * @brief Multi-limb storage for formats wider than 128 bits.
+ * @tparam numberOfBits Total number of bits (integer plus fractional) of the format.
+ */
+template<int numberOfBits>
+struct FixedPointStorage<numberOfBits, true>
+{
+	static constexpr int numberOfLimbs = (numberOfBits + 63) / 64;
+	using SignedType = FixedPointWideInteger<numberOfLimbs>;
+	using UnsignedType = FixedPointWideInteger<numberOfLimbs, false>;
+	using WideSignedType = FixedPointWideInteger<2 * numberOfLimbs>;
+	using AccumulatorType = FixedPointWideInteger<2 * numberOfLimbs + 1>;
+	static constexpr int numberOfStorageBits = 64 * numberOfLimbs;
+};
 /**
  * @brief Class template for fixed-point numbers with specified integer and fractional bits.
  * @tparam numberOfIntegerBits Number of bits allocated for the integer part.
  * @tparam numberOfFractionalBits Number of bits allocated for the fractional part.
+ * @tparam overflowPolicy What arithmetic does with a result outside the range of the format; see FixedPointOverflow.
+ * @tparam roundingPolicy How *, /, >>, rescaling and parsing round away low-order bits; see FixedPointRounding.
  */
-template<int numberOfIntegerBits, int numberOfFractionalBits>
+template<int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy = FixedPointOverflow::Wrap, FixedPointRounding roundingPolicy = FixedPointRounding::RoundHalfUp>
 class FixedPointNumber
 {
+public:
+	using StorageType = typename FixedPointStorage<numberOfIntegerBits + numberOfFractionalBits>::SignedType;
+	using UnsignedStorageType = typename FixedPointStorage<numberOfIntegerBits + numberOfFractionalBits>::UnsignedType;
+	using WideStorageType = typename FixedPointStorage<numberOfIntegerBits + numberOfFractionalBits>::WideSignedType;
+	using AccumulatorType = typename FixedPointStorage<numberOfIntegerBits + numberOfFractionalBits>::AccumulatorType;
 private:
-	std::bitset<numberOfIntegerBits + numberOfFractionalBits> bits;
-	int numberOfDecimalPlaces;
-	static int positionOfMostSignificantBit(std::bitset<numberOfIntegerBits + numberOfFractionalBits> bits);
-	static std::bitset<numberOfIntegerBits + numberOfFractionalBits> twosComplement(const std::bitset<numberOfIntegerBits + numberOfFractionalBits> &bits);
-	static std::bitset<numberOfIntegerBits + numberOfFractionalBits> addBitsets(const std::bitset<numberOfIntegerBits + numberOfFractionalBits> &bitSet1, const std::bitset<numberOfIntegerBits + numberOfFractionalBits> &bitSet2, bool carryIn);
-	static std::bitset<numberOfIntegerBits + numberOfFractionalBits> subtractBitsets(const std::bitset<numberOfIntegerBits + numberOfFractionalBits> &bitSet1, const std::bitset<numberOfIntegerBits + numberOfFractionalBits> &bitSet2);
-	static bool isZero(const std::bitset<numberOfIntegerBits + numberOfFractionalBits> &bits);
-	static bool isNegative(const std::bitset<numberOfIntegerBits + numberOfFractionalBits> &bits);
-	static bool isPositive(const std::bitset<numberOfIntegerBits + numberOfFractionalBits> &bits);
-	void setNumberOfDecimalPlaces(int numberOfDecimalPlaces);
-	FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> reciprocal() const;
+	static constexpr int numberOfBits = numberOfIntegerBits + numberOfFractionalBits;
+	static constexpr int numberOfStorageBits = FixedPointStorage<numberOfBits>::numberOfStorageBits;
+	static constexpr UnsignedStorageType bitMask = static_cast<UnsignedStorageType>(static_cast<UnsignedStorageType>(~static_cast<UnsignedStorageType>(0)) >> (numberOfStorageBits - numberOfBits));
+	static constexpr StorageType largestRawValue = static_cast<StorageType>(bitMask >> 1);
+	static constexpr StorageType smallestRawValue = static_cast<StorageType>(~largestRawValue);
+	static constexpr int numberOfSignificantFractionalDigits = numberOfFractionalBits + 1;
+	using FusedStorageType = std::conditional_t<(numberOfIntegerBits >= 1 || 2 * numberOfBits + 1 <= static_cast<int>(8 * sizeof(WideStorageType))), WideStorageType, AccumulatorType>;
+	using MathProductType = std::conditional_t<(numberOfBits <= 64), typename FixedPointStorage<64>::WideSignedType, FixedPointWideInteger<(numberOfBits + 127) / 64>>;
+	using IntegerProductType = std::conditional_t<(numberOfBits <= 32), int64_t, WideStorageType>;
+	static constexpr WideStorageType oneRawValue = static_cast<WideStorageType>(static_cast<WideStorageType>(1) << numberOfFractionalBits);
+#ifdef __SIZEOF_INT128__
+	using DecimalAccumulatorType = std::conditional_t<(numberOfFractionalBits <= 13), int64_t, std::conditional_t<(numberOfFractionalBits <= 28), FixedPointInt128, FixedPointWideInteger<(433 * numberOfFractionalBits / 100 + 6) / 64 + 1>>>;
+#else
+	using DecimalAccumulatorType = std::conditional_t<(numberOfFractionalBits <= 13), int64_t, FixedPointWideInteger<(433 * numberOfFractionalBits / 100 + 6) / 64 + 1>>;
+#endif
+	StorageType rawValue;
+	static constexpr StorageType wrap(UnsignedStorageType value);
+	static constexpr StorageType twosComplement(StorageType value);
+	static constexpr StorageType overflowRawValue(bool isNegativeOverflow);
+	static constexpr StorageType checkOverflow(StorageType wrappedValue, bool isOverflow, bool isNegativeOverflow);
+	template<typename Integer>
+	static constexpr StorageType narrowRawValue(Integer value);
+	static constexpr StorageType addRawValues(StorageType value1, StorageType value2);
+	static constexpr StorageType subtractRawValues(StorageType value1, StorageType value2);
+	static constexpr StorageType remainderRawValues(StorageType value1, StorageType value2);
+	static constexpr WideStorageType multiplyRawValues(StorageType value1, StorageType value2);
+	static constexpr bool isZero(StorageType value);
+	static constexpr bool isNegative(StorageType value);
+	static constexpr bool isPositive(StorageType value);
+	static constexpr StorageType fromBitset(const std::bitset<numberOfIntegerBits + numberOfFractionalBits> &bits);
+	static std::bitset<numberOfIntegerBits + numberOfFractionalBits> toBitset(StorageType value);
+	static constexpr char* writeIntegerDigits(UnsignedStorageType value, char* bufferEnd);
+	static constexpr double powerOfTwo(int exponent);
+	template<typename Integer>
+	static constexpr int bitLength(Integer value);
+	template<typename Integer>
+	static constexpr Integer integerSquareRoot(Integer value);
+	static constexpr void rotateCircular(StorageType angle, int64_t &sine, int64_t &cosine);
+	constexpr int shortestNumberOfDecimalPlaces() const;
+	template<typename Integer>
+	static constexpr bool isRandomFractionBelow(Integer numerator, Integer denominator, std::uint64_t randomBits);
+	template<FixedPointRounding rounding, typename RandomBitGenerator>
+	static constexpr std::uint64_t randomBitsFor(RandomBitGenerator &&generator);
+	template<FixedPointRounding rounding, typename Integer>
+	static constexpr Integer shiftRightRounded(Integer value, int amountToShift, std::uint64_t randomBits = 0);
+	template<FixedPointRounding rounding, typename Integer>
+	static constexpr Integer divideRounded(Integer dividend, Integer divisor, std::uint64_t randomBits = 0);
+	template<int, int, FixedPointOverflow, FixedPointRounding>
+	friend class FixedPointNumber;
 public:
-	FixedPointNumber(std::string valueString = "0");
-	FixedPointNumber(std::bitset<numberOfIntegerBits + numberOfFractionalBits> bits, int numberOfDecimalPlaces = INT_MAX);
-	FixedPointNumber(int integerValue);
-	~FixedPointNumber();
-	static FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> maximum(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> fixedPointNumbers[], int fixedPointNumbersSize);
-	static FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> minimum(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> fixedPointNumbers[], int fixedPointNumbersSize);
+	constexpr FixedPointNumber() = default;
+	constexpr FixedPointNumber(std::string_view valueString);
+	constexpr FixedPointNumber(std::bitset<numberOfIntegerBits + numberOfFractionalBits> bits);
+	constexpr FixedPointNumber(int integerValue);
+	static constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> fromRawValue(StorageType rawValue);
+	template<FixedPointRounding rounding = roundingPolicy, typename Integer, typename RandomBitGenerator = FixedPointThreadRandomBitGenerator>
+	static constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> fromScaledInteger(Integer value, int numberOfFractionalBitsOfValue, RandomBitGenerator &&generator = RandomBitGenerator());
+	template<FixedPointRounding rounding = roundingPolicy, typename RandomBitGenerator = FixedPointThreadRandomBitGenerator>
+	static constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> fromDouble(double value, RandomBitGenerator &&generator = RandomBitGenerator());
+	template<FixedPointRounding rounding = roundingPolicy, typename RandomBitGenerator = FixedPointThreadRandomBitGenerator>
+	static constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> fromFloat(float value, RandomBitGenerator &&generator = RandomBitGenerator());
+	template<FixedPointRounding rounding = roundingPolicy>
+	static constexpr std::from_chars_result fromChars(const char* first, const char* last, FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &value);
+	template<FixedPointRounding rounding = roundingPolicy>
+	static constexpr std::from_chars_result fromChars(std::string_view valueString, FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &value);
+	static constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> maximum(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> fixedPointNumbers[], int fixedPointNumbersSize);
+	static constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> minimum(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> fixedPointNumbers[], int fixedPointNumbersSize);
+	static constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> maximum(std::span<const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>> fixedPointNumbers);
+	static constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> minimum(std::span<const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>> fixedPointNumbers);
+	constexpr std::to_chars_result toChars(char* first, char* last) const;
+	constexpr std::to_chars_result toChars(char* first, char* last, int numberOfDecimalPlaces) const;
 	std::string toString() const;
+	std::string toString(int numberOfDecimalPlaces) const;
 	std::string bitsToString() const;
 	void print() const;
 	void printLine() const;
 	void printBits() const;
 	void printBitsLine() const;
-	int getNumberOfDecimalPlaces() const;
-	FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> absoluteValue() const;
-	FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> operator+(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>& other) const;
-	FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> operator-() const;
-	FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> operator-(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>& other) const;
-	FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> operator*(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>& other) const;
-	FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> operator/(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>& other) const;
-	FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> operator%(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>& other) const;
-	FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> operator<<(const int amountToShift) const;
-	FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> operator>>(const int amountToShift) const;
-	FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> operator~() const;
-	FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> operator&(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other) const;
-	FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> operator|(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other) const;
-	FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> operator^(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other) const;
-	bool operator==(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other) const;
-	bool operator!=(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other) const;
-	bool operator<(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other) const;
-	bool operator<=(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other) const;
-	bool operator>(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other) const;
-	bool operator>=(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other) const;
-	void operator+=(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other);
-	void operator-=(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other);
-	void operator*=(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other);
-	void operator/=(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other);
-	void operator%=(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other);
-	void operator<<=(const int amountToShift);
-	void operator>>=(const int amountToShift);
-	void operator&=(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other);
-	void operator|=(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other);
-	void operator^=(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other);
-	void operator++(int);
-	void operator--(int);
-	bool operator!() const;
-	bool operator&&(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other) const;
-	bool operator||(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other) const;
-	
+	constexpr StorageType getRawValue() const;
+	constexpr double toDouble() const;
+	constexpr float toFloat() const;
+	constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> absoluteValue() const;
+	constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> squareRoot() const;
+	constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> reciprocalSquareRoot() const;
+	constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> exponential() const;
+	constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> logarithmBase2() const;
+	constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> sine() const;
+	constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> cosine() const;
+	constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> arcTangent2(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &x) const;
+	constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> operator+(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>& other) const;
+	constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> operator-() const;
+	constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> operator-(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>& other) const;
+	constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> operator*(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>& other) const;
+	constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> operator*(int integerValue) const;
+	template<FixedPointRounding rounding = roundingPolicy, typename RandomBitGenerator = FixedPointThreadRandomBitGenerator>
+	constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> multiply(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>& other, RandomBitGenerator &&generator = RandomBitGenerator()) const;
+	template<FixedPointRounding rounding = roundingPolicy, typename RandomBitGenerator = FixedPointThreadRandomBitGenerator>
+	constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> fusedMultiplyAdd(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>& other, const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>& addend, RandomBitGenerator &&generator = RandomBitGenerator()) const;
+	template<FixedPointRounding rounding = roundingPolicy, typename RandomBitGenerator = FixedPointThreadRandomBitGenerator>
+	constexpr void multiplyAccumulate(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>& value1, const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>& value2, RandomBitGenerator &&generator = RandomBitGenerator());
+	constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> operator/(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>& other) const;
+	constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> operator/(int integerValue) const;
+	template<FixedPointRounding rounding = roundingPolicy, typename RandomBitGenerator = FixedPointThreadRandomBitGenerator>
+	constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> divide(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>& other, RandomBitGenerator &&generator = RandomBitGenerator()) const;
+	template<FixedPointRounding rounding = roundingPolicy, typename RandomBitGenerator = FixedPointThreadRandomBitGenerator>
+	constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> divide(int integerValue, RandomBitGenerator &&generator = RandomBitGenerator()) const;
+	constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> operator%(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>& other) const;
+	constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> euclideanRemainder(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>& other) const;
+	constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> operator<<(const int amountToShift) const;
+	constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> operator>>(const int amountToShift) const;
+	template<FixedPointRounding rounding = roundingPolicy, typename RandomBitGenerator = FixedPointThreadRandomBitGenerator>
+	constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> shiftRight(int amountToShift, RandomBitGenerator &&generator = RandomBitGenerator()) const;
+	template<int exponent, FixedPointRounding rounding = roundingPolicy, typename RandomBitGenerator = FixedPointThreadRandomBitGenerator>
+	constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> scaleByPowerOfTwo(RandomBitGenerator &&generator = RandomBitGenerator()) const;
+	template<int resultIntegerBits, int resultFractionalBits, FixedPointRounding rounding = roundingPolicy, typename RandomBitGenerator = FixedPointThreadRandomBitGenerator>
+	constexpr FixedPointNumber<resultIntegerBits, resultFractionalBits, overflowPolicy, roundingPolicy> rescale(RandomBitGenerator &&generator = RandomBitGenerator()) const;
+	constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> operator~() const;
+	constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> operator&(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other) const;
+	constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> operator|(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other) const;
+	constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> operator^(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other) const;
+	constexpr bool operator==(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other) const;
+	constexpr std::strong_ordering operator<=>(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other) const;
+	constexpr void operator+=(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other);
+	constexpr void operator-=(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other);
+	constexpr void operator*=(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other);
+	constexpr void operator/=(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other);
+	constexpr void operator*=(int integerValue);
+	constexpr void operator/=(int integerValue);
+	constexpr void operator%=(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other);
+	constexpr void operator<<=(const int amountToShift);
+	constexpr void operator>>=(const int amountToShift);
+	constexpr void operator&=(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other);
+	constexpr void operator|=(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other);
+	constexpr void operator^=(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other);
+	constexpr void operator++(int);
+	constexpr void operator--(int);
+	constexpr bool operator!() const;
+	constexpr bool operator&&(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other) const;
+	constexpr bool operator||(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other) const;
+
 };
 /**
- * @brief Find the position of the most significant bit set to 1.
- * @tparam numberOfIntegerBits 
- * @tparam numberOfFractionalBits 
- * @param bits 
- * @return int 
+ * @brief Reduce an unsigned storage value to the format's width and sign-extend it into the storage type.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param value
+ * @return StorageType
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-int FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::positionOfMostSignificantBit(std::bitset<numberOfIntegerBits + numberOfFractionalBits> bits)
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr typename FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::StorageType FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::wrap(UnsignedStorageType value)
 {
-	for (int bitNumber = numberOfIntegerBits + numberOfFractionalBits - 1; bitNumber >= 0; bitNumber--)
+	if constexpr (numberOfBits == numberOfStorageBits)
 	{
-		if (bits[bitNumber])
-		{
-			return bitNumber;
-		}
+		return static_cast<StorageType>(value);
+	}
+	else
+	{
+		return static_cast<StorageType>(static_cast<StorageType>(static_cast<UnsignedStorageType>(value << (numberOfStorageBits - numberOfBits))) >> (numberOfStorageBits - numberOfBits));
 	}
-	return -1;
 }
 /**
- * @brief Compute the two's complement of a bitset.
- * @tparam numberOfIntegerBits 
- * @tparam numberOfFractionalBits 
- * @param bits 
- * @return std::bitset<numberOfIntegerBits + numberOfFractionalBits> 
+ * @brief Compute the two's complement of a raw value.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param value
+ * @return StorageType
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-std::bitset<numberOfIntegerBits + numberOfFractionalBits> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::twosComplement(const std::bitset<numberOfIntegerBits + numberOfFractionalBits> &bits)
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr typename FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::StorageType FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::twosComplement(StorageType value)
 {
-	std::bitset<numberOfIntegerBits + numberOfFractionalBits> copyBits = bits;
-	copyBits.flip();
-	return addBitsets(copyBits, std::bitset<numberOfIntegerBits + numberOfFractionalBits>(), true);
+	return wrap(static_cast<UnsignedStorageType>(static_cast<UnsignedStorageType>(0) - static_cast<UnsignedStorageType>(value)));
 }
 /**
- * @brief Add two bitsets with an optional carry-in.
- * @tparam numberOfIntegerBits 
- * @tparam numberOfFractionalBits 
- * @param bitSet1 
- * @param bitSet2 
- * @param carryIn 
- * @return std::bitset<numberOfIntegerBits + numberOfFractionalBits> 
+ * @brief Report an overflow as the policy requires and return the bound the result saturates to.
+ * @details Throw throws std::overflow_error and Sticky sets fixedPointOverflowFlag; the others only saturate.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param isNegativeOverflow Whether the exact result lies below the smallest representable number.
+ * @return StorageType
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-std::bitset<numberOfIntegerBits + numberOfFractionalBits> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::addBitsets(const std::bitset<numberOfIntegerBits + numberOfFractionalBits> &bitSet1, const std::bitset<numberOfIntegerBits + numberOfFractionalBits> &bitSet2, bool carryIn)
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr typename FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::StorageType FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::overflowRawValue(bool isNegativeOverflow)
 {
-	std::bitset<numberOfIntegerBits + numberOfFractionalBits> sumBits;
-	bool carry = carryIn;
-	bool sum;
-	for (int bitNumber = 0; bitNumber < numberOfIntegerBits + numberOfFractionalBits; bitNumber++)
+	if constexpr (overflowPolicy == FixedPointOverflow::Throw)
+	{
+		throw std::overflow_error("Fixed-point arithmetic overflow.");
+	}
+	else if constexpr (overflowPolicy == FixedPointOverflow::Sticky)
 	{
-		sum = bitSet1[bitNumber] ^ bitSet2[bitNumber] ^ carry;
-		carry = (bitSet1[bitNumber] && bitSet2[bitNumber]) || (bitSet1[bitNumber] && carry) || (bitSet2[bitNumber] && carry);
-		sumBits[bitNumber] = sum;
+		fixedPointOverflowFlag = true;
 	}
-	return sumBits;
+	return isNegativeOverflow ? smallestRawValue : largestRawValue;
 }
 /**
- * @brief Subtract two bitsets.
- * @tparam numberOfIntegerBits 
- * @tparam numberOfFractionalBits 
- * @param bitSet1 
- * @param bitSet2 
- * @return std::bitset<numberOfIntegerBits + numberOfFractionalBits> 
+ * @brief Apply the overflow policy to a result that has already been wrapped to the width of the format.
+ * @details For Wrap the wrapped value is returned unchanged, so the side-effect-free overflow test is dead code that
+ * the compiler removes. For Saturate the choice is a pair of selects rather than a branch.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param wrappedValue
+ * @param isOverflow Whether the exact result lies outside the range of the format.
+ * @param isNegativeOverflow Whether it lies below the smallest representable number.
+ * @return StorageType
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-std::bitset<numberOfIntegerBits + numberOfFractionalBits> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::subtractBitsets(const std::bitset<numberOfIntegerBits + numberOfFractionalBits> &bitSet1, const std::bitset<numberOfIntegerBits + numberOfFractionalBits> &bitSet2)
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr typename FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::StorageType FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::checkOverflow(StorageType wrappedValue, bool isOverflow, bool isNegativeOverflow)
 {
-	return addBitsets(bitSet1, twosComplement(bitSet2), false);
+	if constexpr (overflowPolicy == FixedPointOverflow::Wrap)
+	{
+		return wrappedValue;
+	}
+	else if constexpr (overflowPolicy == FixedPointOverflow::Saturate)
+	{
+		StorageType saturatedValue = isNegativeOverflow ? smallestRawValue : largestRawValue;
+		return isOverflow ? saturatedValue : wrappedValue;
+	}
+	else
+	{
+		return isOverflow ? overflowRawValue(isNegativeOverflow) : wrappedValue;
+	}
 }
 /**
- * @brief Check if the bitset represents zero.
- * @tparam numberOfIntegerBits 
- * @tparam numberOfFractionalBits 
- * @param bits 
- * @return true 
- * @return false 
+ * @brief Narrow an exact intermediate value, such as a rounded product or quotient, to a raw value of the format.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @tparam Integer A signed native or wide integer type at least as wide as StorageType.
+ * @param value
+ * @return StorageType
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-bool FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::isZero(const std::bitset<numberOfIntegerBits + numberOfFractionalBits> &bits)
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+template <typename Integer>
+constexpr typename FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::StorageType FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::narrowRawValue(Integer value)
 {
-	return bits.none();
+	StorageType wrappedValue = wrap(static_cast<UnsignedStorageType>(value));
+	if constexpr (overflowPolicy == FixedPointOverflow::Wrap)
+	{
+		return wrappedValue;
+	}
+	else
+	{
+		return checkOverflow(wrappedValue, value > static_cast<Integer>(largestRawValue) || value < static_cast<Integer>(smallestRawValue), value < static_cast<Integer>(0));
+	}
 }
 /**
- * @brief Check if the bitset represents a negative number.
- * @tparam numberOfIntegerBits 
- * @tparam numberOfFractionalBits 
- * @param bits 
- * @return true 
- * @return false 
+ * @brief Add two raw values, wrapping modulo the width of the format.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param value1
+ * @param value2
+ * @return StorageType
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-bool FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::isNegative(const std::bitset<numberOfIntegerBits + numberOfFractionalBits> &bits)
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr typename FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::StorageType FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::addRawValues(StorageType value1, StorageType value2)
 {
-	return bits[numberOfIntegerBits + numberOfFractionalBits - 1];
+	return wrap(static_cast<UnsignedStorageType>(static_cast<UnsignedStorageType>(value1) + static_cast<UnsignedStorageType>(value2)));
 }
 /**
- * @brief Check if the bitset represents a positive number.
- * @tparam numberOfIntegerBits 
- * @tparam numberOfFractionalBits 
- * @param bits 
- * @return true 
- * @return false 
+ * @brief Subtract two raw values, wrapping modulo the width of the format.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param value1
+ * @param value2
+ * @return StorageType
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-bool FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::isPositive(const std::bitset<numberOfIntegerBits + numberOfFractionalBits> &bits)
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr typename FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::StorageType FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::subtractRawValues(StorageType value1, StorageType value2)
 {
-	return (!isNegative(bits) && !isZero(bits));
+	return wrap(static_cast<UnsignedStorageType>(static_cast<UnsignedStorageType>(value1) - static_cast<UnsignedStorageType>(value2)));
 }
 /**
- * @brief Set the number of decimal places for the fixed-point number.
- * @tparam numberOfIntegerBits 
- * @tparam numberOfFractionalBits 
- * @param numberOfDecimalPlaces 
+ * @brief Calculate the remainder of two raw values, taking the sign of the first.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param value1
+ * @param value2 Must not be zero.
+ * @return StorageType
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::setNumberOfDecimalPlaces(int numberOfDecimalPlaces)
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr typename FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::StorageType FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::remainderRawValues(StorageType value1, StorageType value2)
 {
-	this->numberOfDecimalPlaces = numberOfDecimalPlaces;
+	if (value2 == static_cast<StorageType>(-1))
+	{
+		return 0;
+	}
+	return static_cast<StorageType>(value1 % value2);
 }
 /**
- * @brief Compute the reciprocal of the fixed-point number using Newton-Raphson method.
- * @tparam numberOfIntegerBits 
- * @tparam numberOfFractionalBits 
- * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> 
+ * @brief Multiply two raw values into their exact double-width product.
+ * @details Native storage widens both operands and multiplies; multi-limb storage forms only the double-width product
+ * of the limbs with FixedPointWideInteger::multiplyFull instead of multiplying sign-extended double-width operands.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param value1
+ * @param value2
+ * @return WideStorageType
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::reciprocal() const
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr typename FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::WideStorageType FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::multiplyRawValues(StorageType value1, StorageType value2)
 {
-	FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> thisValue = *this;
-	thisValue.setNumberOfDecimalPlaces(INT_MAX);
-	FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> currentReciprocal = FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>(1);
-	currentReciprocal.bits >>= positionOfMostSignificantBit(thisValue.bits) - numberOfFractionalBits;
-	FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> previousReciprocal;
-	while (!(thisValue * currentReciprocal == 1) && previousReciprocal != currentReciprocal)
+	if constexpr (fixedPointIsWideInteger<StorageType>)
+	{
+		return StorageType::multiplyFull(value1, value2);
+	}
+	else
 	{
-		previousReciprocal = currentReciprocal;
-		currentReciprocal = currentReciprocal * ((-thisValue * currentReciprocal) + 2);
+		return static_cast<WideStorageType>(static_cast<WideStorageType>(value1) * static_cast<WideStorageType>(value2));
 	}
-	return currentReciprocal;
 }
 /**
- * @brief Construct a new Fixed Point Number object from a string representation.
- * @tparam numberOfIntegerBits 
- * @tparam numberOfFractionalBits 
- * @param valueString 
+ * @brief Check if the raw value represents zero.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param value
+ * @return true
+ * @return false
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr bool FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::isZero(StorageType value)
+{
+	return value == 0;
+}
+/**
+ * @brief Check if the raw value represents a negative number.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param value
+ * @return true
+ * @return false
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr bool FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::isNegative(StorageType value)
+{
+	return value < 0;
+}
+/**
+ * @brief Check if the raw value represents a positive number.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param value
+ * @return true
+ * @return false
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr bool FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::isPositive(StorageType value)
+{
+	return value > 0;
+}
+/**
+ * @brief Convert a bitset into a sign-extended raw value.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param bits
+ * @return StorageType
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr typename FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::StorageType FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::fromBitset(const std::bitset<numberOfIntegerBits + numberOfFractionalBits> &bits)
+{
+	UnsignedStorageType value = 0;
+	for (int bitNumber = numberOfBits - 1; bitNumber >= 0; bitNumber--)
+	{
+		value = static_cast<UnsignedStorageType>((value << 1) | static_cast<UnsignedStorageType>(bits[bitNumber]));
+	}
+	return wrap(value);
+}
+/**
+ * @brief Convert a raw value into a bitset of the format's width.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param value
+ * @return std::bitset<numberOfIntegerBits + numberOfFractionalBits>
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+std::bitset<numberOfIntegerBits + numberOfFractionalBits> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::toBitset(StorageType value)
+{
+	UnsignedStorageType bits = static_cast<UnsignedStorageType>(value) & bitMask;
+	if constexpr (numberOfBits <= 64)
+	{
+		return std::bitset<numberOfIntegerBits + numberOfFractionalBits>(static_cast<unsigned long long>(bits));
+	}
+	else
+	{
+		std::bitset<numberOfIntegerBits + numberOfFractionalBits> bitset;
+		for (int bitNumber = 0; bitNumber < numberOfBits; bitNumber++)
+		{
+			bitset[bitNumber] = static_cast<bool>((bits >> bitNumber) & 1);
+		}
+		return bitset;
+	}
+}
+/**
+ * @brief Check whether a uniform random fraction, randomBits / 2^64, is less than numerator / denominator.
+ * @details The binary digits of the fraction are generated by long division and compared with the random bits from
+ * the most significant end, so the loop usually stops after one or two digits.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @tparam Integer A signed native or wide integer type in which 2 * denominator does not overflow.
+ * @param numerator At least 0 and less than denominator.
+ * @param denominator
+ * @param randomBits
+ * @return true With probability numerator / denominator, to within 2^-64.
+ * @return false
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-inline FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::FixedPointNumber(std::string valueString)
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+template <typename Integer>
+constexpr bool FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::isRandomFractionBelow(Integer numerator, Integer denominator, std::uint64_t randomBits)
 {
-	int decimalPointIndex = valueString.find('.');
-	if (decimalPointIndex == std::string::npos)
+	for (int bitNumber = 63; bitNumber >= 0; bitNumber--)
 	{
-		this->numberOfDecimalPlaces = 0;
+		numerator = static_cast<Integer>(numerator + numerator);
+		bool fractionBit = numerator >= denominator;
+		if (fractionBit)
+		{
+			numerator = static_cast<Integer>(numerator - denominator);
+		}
+		bool randomBit = ((randomBits >> bitNumber) & 1u) != 0;
+		if (fractionBit != randomBit)
+		{
+			return fractionBit;
+		}
+	}
+	return numerator != static_cast<Integer>(0);
+}
+/**
+ * @brief Draw the 64 random bits consumed by one stochastically rounded operation, or return 0 without touching the
+ * generator for the other roundings.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @tparam rounding
+ * @tparam RandomBitGenerator A uniform random bit generator such as std::mt19937_64.
+ * @param generator
+ * @return std::uint64_t
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+template <FixedPointRounding rounding, typename RandomBitGenerator>
+constexpr std::uint64_t FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::randomBitsFor(RandomBitGenerator &&generator)
+{
+	if constexpr (rounding == FixedPointRounding::Stochastic)
+	{
+		return std::uniform_int_distribution<std::uint64_t>()(generator);
 	}
 	else
 	{
-		this->numberOfDecimalPlaces = valueString.length() - decimalPointIndex - 1;
+		static_cast<void>(generator);
+		return 0;
+	}
+}
+/**
+ * @brief Shift an exact intermediate value right, rounding away the discarded bits once.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @tparam rounding The rounding applied to the discarded bits.
+ * @tparam Integer A signed native or wide integer type.
+ * @param value
+ * @param amountToShift Number of bits to discard, at least 0 and less than the width of Integer.
+ * @param randomBits Uniform random bits, used only by FixedPointRounding::Stochastic.
+ * @return Integer
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+template <FixedPointRounding rounding, typename Integer>
+constexpr Integer FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::shiftRightRounded(Integer value, int amountToShift, std::uint64_t randomBits)
+{
+	if (amountToShift == 0)
+	{
+		return value;
 	}
-	double value = std::stod(valueString);
-	bool isNegative = value < 0;
-	double integerPart;
-	double fractionalPart = std::modf(value, &integerPart);
-	if (isNegative)
+	const Integer zero = static_cast<Integer>(0);
+	const Integer one = static_cast<Integer>(1);
+	Integer quotient = static_cast<Integer>(value >> amountToShift);
+	Integer remainder = static_cast<Integer>(value & static_cast<Integer>((one << amountToShift) - one));
+	Integer half = static_cast<Integer>(one << (amountToShift - 1));
+	if constexpr (rounding == FixedPointRounding::Truncate)
 	{
-		integerPart = -integerPart;
-		fractionalPart = -fractionalPart;
+		if (value < zero && remainder != zero)
+		{
+			quotient = static_cast<Integer>(quotient + one);
+		}
 	}
-	for (int bitNumber = numberOfIntegerBits - 1; bitNumber >= 0; bitNumber--)
+	else if constexpr (rounding == FixedPointRounding::RoundHalfUp)
 	{
-		if (integerPart >= std::pow(2, bitNumber))
+		if (remainder >= half)
 		{
-			this->bits.set(numberOfFractionalBits + bitNumber);
-			integerPart -= std::pow(2, bitNumber);
+			quotient = static_cast<Integer>(quotient + one);
 		}
 	}
-	for (int bitNumber = 0; bitNumber < numberOfFractionalBits - 1; bitNumber++)
+	else if constexpr (rounding == FixedPointRounding::RoundHalfEven)
 	{
-		if (fractionalPart >= std::pow(2, -bitNumber - 1))
+		if (remainder > half || (remainder == half && (quotient & one) != zero))
 		{
-			this->bits.set(numberOfFractionalBits - bitNumber - 1);
-			fractionalPart -= std::pow(2.0, -bitNumber - 1);
+			quotient = static_cast<Integer>(quotient + one);
 		}
 	}
-	if (isNegative)
+	else if constexpr (rounding == FixedPointRounding::Stochastic)
 	{
-		this->bits = twosComplement(this->bits);
+		bool isRoundedUp = amountToShift <= 64 ? static_cast<Integer>(randomBits >> (64 - amountToShift)) < remainder : static_cast<Integer>(randomBits) < static_cast<Integer>(remainder >> (amountToShift - 64));
+		if (isRoundedUp)
+		{
+			quotient = static_cast<Integer>(quotient + one);
+		}
 	}
+	return quotient;
 }
 /**
- * @brief Construct a new Fixed Point Number object from a bitset representation.
- * @tparam numberOfIntegerBits 
- * @tparam numberOfFractionalBits 
- * @param bits 
- * @param numberOfDecimalPlaces 
+ * @brief Divide two exact intermediate values, rounding the quotient once.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @tparam rounding The rounding applied to the quotient.
+ * @tparam Integer A signed native or wide integer type.
+ * @param dividend
+ * @param divisor Must not be zero.
+ * @param randomBits Uniform random bits, used only by FixedPointRounding::Stochastic.
+ * @return Integer
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::FixedPointNumber(std::bitset<numberOfIntegerBits + numberOfFractionalBits> bits, int numberOfDecimalPlaces)
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+template <FixedPointRounding rounding, typename Integer>
+constexpr Integer FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::divideRounded(Integer dividend, Integer divisor, std::uint64_t randomBits)
 {
-	this->bits = bits;
-	this->numberOfDecimalPlaces = numberOfDecimalPlaces;
+	const Integer zero = static_cast<Integer>(0);
+	const Integer one = static_cast<Integer>(1);
+	Integer quotient = static_cast<Integer>(dividend / divisor);
+	Integer remainder = static_cast<Integer>(dividend % divisor);
+	if constexpr (rounding == FixedPointRounding::Truncate)
+	{
+		return quotient;
+	}
+	if (remainder == zero)
+	{
+		return quotient;
+	}
+	bool isQuotientNegative = (dividend < zero) != (divisor < zero);
+	Integer towardNegativeInfinity = isQuotientNegative ? static_cast<Integer>(quotient - one) : quotient;
+	if constexpr (rounding == FixedPointRounding::Floor)
+	{
+		return towardNegativeInfinity;
+	}
+	Integer absoluteRemainder = (remainder < zero) ? static_cast<Integer>(zero - remainder) : remainder;
+	Integer absoluteDivisor = (divisor < zero) ? static_cast<Integer>(zero - divisor) : divisor;
+	Integer distanceFromFloor = isQuotientNegative ? static_cast<Integer>(absoluteDivisor - absoluteRemainder) : absoluteRemainder;
+	if constexpr (rounding == FixedPointRounding::Stochastic)
+	{
+		return isRandomFractionBelow(distanceFromFloor, absoluteDivisor, randomBits) ? static_cast<Integer>(towardNegativeInfinity + one) : towardNegativeInfinity;
+	}
+	Integer excess = static_cast<Integer>(distanceFromFloor - static_cast<Integer>(absoluteDivisor - distanceFromFloor));
+	Integer towardPositiveInfinity = static_cast<Integer>(towardNegativeInfinity + one);
+	if (excess < zero)
+	{
+		return towardNegativeInfinity;
+	}
+	if (excess > zero)
+	{
+		return towardPositiveInfinity;
+	}
+	if constexpr (rounding == FixedPointRounding::RoundHalfUp)
+	{
+		return towardPositiveInfinity;
+	}
+	else
+	{
+		return ((towardNegativeInfinity & one) == zero) ? towardNegativeInfinity : towardPositiveInfinity;
+	}
 }
 /**
- * @brief Construct a new Fixed Point Number object from an integer value.
- * @tparam numberOfIntegerBits 
- * @tparam numberOfFractionalBits 
- * @param integerValue 
+ * @brief Construct a new Fixed Point Number object from a string representation.
+ * @details The string must be a complete decimal number; it is rounded to the nearest representable value. A number
+ * outside the range of the format saturates under Saturate and Sticky and throws std::out_of_range otherwise.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param valueString
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::FixedPointNumber(int integerValue)
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::FixedPointNumber(std::string_view valueString)
 {
-	*this = FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>(std::to_string(integerValue));
-	this->numberOfDecimalPlaces = INT_MAX;
+	this->rawValue = 0;
+	std::from_chars_result result = fromChars(valueString.data(), valueString.data() + valueString.size(), *this);
+	if (result.ec == std::errc::result_out_of_range && result.ptr == valueString.data() + valueString.size())
+	{
+		if constexpr (overflowPolicy == FixedPointOverflow::Saturate || overflowPolicy == FixedPointOverflow::Sticky)
+		{
+			this->rawValue = overflowRawValue(valueString.front() == '-');
+			return;
+		}
+		throw std::out_of_range("Fixed-point number string is out of range.");
+	}
+	if (result.ec != std::errc() || result.ptr != valueString.data() + valueString.size())
+	{
+		throw std::invalid_argument("Invalid fixed-point number string.");
+	}
 }
 /**
- * @brief Destroy the Fixed Point Number object.
- * @tparam numberOfIntegerBits 
- * @tparam numberOfFractionalBits 
+ * @brief Construct a new Fixed Point Number object from a bitset representation.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param bits
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::~FixedPointNumber()
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::FixedPointNumber(std::bitset<numberOfIntegerBits + numberOfFractionalBits> bits)
 {
+	this->rawValue = fromBitset(bits);
 }
 /**
- * @brief Find the maximum fixed-point number from an array.
- * @tparam numberOfIntegerBits 
- * @tparam numberOfFractionalBits 
- * @param fixedPointNumbers
- * @param fixedPointNumbersSize
- * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> 
+ * @brief Construct a new Fixed Point Number object from an integer value.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param integerValue
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-inline FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::maximum(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> fixedPointNumbers[], int fixedPointNumbersSize)
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::FixedPointNumber(int integerValue)
 {
-	if (fixedPointNumbersSize == 0)
+	StorageType wrappedValue = 0;
+	if constexpr (numberOfFractionalBits < numberOfStorageBits)
 	{
-		throw std::runtime_error("Cannot determine maximum of an empty array.");
+		wrappedValue = wrap(static_cast<UnsignedStorageType>(static_cast<UnsignedStorageType>(integerValue) << numberOfFractionalBits));
+		this->rawValue = checkOverflow(wrappedValue, (wrappedValue >> numberOfFractionalBits) != integerValue, integerValue < 0);
 	}
-	FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> largestNumber = fixedPointNumbers[0];
-	for (int index = 1; index < fixedPointNumbersSize; index++)
+	else
 	{
-		if (fixedPointNumbers[index] > largestNumber)
-		{
-			largestNumber = fixedPointNumbers[index];
-		}
+		this->rawValue = checkOverflow(wrappedValue, integerValue != 0, integerValue < 0);
 	}
-	return largestNumber;
 }
 /**
- * @brief Find the minimum fixed-point number from an array.
- * @tparam numberOfIntegerBits 
- * @tparam numberOfFractionalBits 
- * @param fixedPointNumbers 
- * @param fixedPointNumbersSize
- * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> 
+ * @brief Construct a fixed-point number directly from its raw two's complement representation.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param rawValue The raw value, scaled by 2^numberOfFractionalBits. Bits above the format's width are discarded.
+ * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::fromRawValue(StorageType rawValue)
+{
+	FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> result;
+	result.rawValue = wrap(static_cast<UnsignedStorageType>(rawValue));
+	return result;
+}
+/**
+ * @brief Create a fixed-point number from an exact integer scaled by 2^-numberOfFractionalBitsOfValue, such as an
+ * accumulated sum of products.
+ * @details Surplus fractional bits are rounded away once, and values outside the range of the format saturate to the
+ * largest or smallest representable number instead of wrapping, even under Wrap; Throw and Sticky report the overflow
+ * as usual.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @tparam rounding The rounding applied to the surplus fractional bits.
+ * @tparam Integer A signed native or wide integer type.
+ * @tparam RandomBitGenerator
+ * @param value
+ * @param numberOfFractionalBitsOfValue At least 0 and less than the width of Integer.
+ * @param generator Source of random bits for FixedPointRounding::Stochastic.
+ * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+template <FixedPointRounding rounding, typename Integer, typename RandomBitGenerator>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::fromScaledInteger(Integer value, int numberOfFractionalBitsOfValue, RandomBitGenerator &&generator)
+{
+	constexpr int numberOfValueBits = static_cast<int>(8 * sizeof(Integer));
+	const Integer one = static_cast<Integer>(1);
+	const Integer smallestValue = static_cast<Integer>(one << (numberOfValueBits - 1));
+	const Integer largestValue = static_cast<Integer>(~smallestValue);
+	if (numberOfFractionalBitsOfValue >= numberOfFractionalBits)
+	{
+		value = shiftRightRounded<rounding>(value, numberOfFractionalBitsOfValue - numberOfFractionalBits, randomBitsFor<rounding>(generator));
+	}
+	else
+	{
+		int amountToShift = numberOfFractionalBits - numberOfFractionalBitsOfValue;
+		if (amountToShift >= numberOfValueBits - 1 ? value != static_cast<Integer>(0) : (value > static_cast<Integer>(largestValue >> amountToShift) || value < static_cast<Integer>(smallestValue >> amountToShift)))
+		{
+			return fromRawValue(overflowRawValue(value < static_cast<Integer>(0)));
+		}
+		value = static_cast<Integer>(value << amountToShift);
+	}
+	if constexpr (numberOfBits < numberOfValueBits)
+	{
+		if (value > static_cast<Integer>(largestRawValue) || value < static_cast<Integer>(smallestRawValue))
+		{
+			return fromRawValue(overflowRawValue(value < static_cast<Integer>(0)));
+		}
+	}
+	return fromRawValue(static_cast<StorageType>(value));
+}
+/**
+ * @brief Convert a double to the nearest representable fixed-point number under the given rounding.
+ * @details The value is scaled by 2^numberOfFractionalBits, which is exact, and split into its integer part and its
+ * fraction, which is also exact, so the result is rounded only once. Values outside the range of the format, including
+ * infinities, saturate to the largest or smallest representable number as in fromScaledInteger, and NaN converts to
+ * zero.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @tparam rounding The rounding applied to the bits of the value below the least significant bit.
+ * @tparam RandomBitGenerator
+ * @param value
+ * @param generator Source of random bits for FixedPointRounding::Stochastic.
+ * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+template <FixedPointRounding rounding, typename RandomBitGenerator>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::fromDouble(double value, RandomBitGenerator &&generator)
+{
+	if (value != value)
+	{
+		return fromRawValue(0);
+	}
+	constexpr double rangeLimit = powerOfTwo(numberOfBits - 1);
+	double scaledValue = value * powerOfTwo(numberOfFractionalBits);
+	if (scaledValue >= rangeLimit || scaledValue < -rangeLimit)
+	{
+		return fromRawValue(overflowRawValue(scaledValue < 0.0));
+	}
+	StorageType truncatedValue = static_cast<StorageType>(scaledValue);
+	double fraction = scaledValue - static_cast<double>(truncatedValue);
+	bool isOdd = (truncatedValue & static_cast<StorageType>(1)) != 0;
+	int adjustment = 0;
+	if constexpr (rounding == FixedPointRounding::Floor)
+	{
+		adjustment = fraction < 0.0 ? -1 : 0;
+	}
+	else if constexpr (rounding == FixedPointRounding::RoundHalfUp)
+	{
+		adjustment = fraction >= 0.5 ? 1 : (fraction < -0.5 ? -1 : 0);
+	}
+	else if constexpr (rounding == FixedPointRounding::RoundHalfEven)
+	{
+		adjustment = (fraction > 0.5 || (fraction == 0.5 && isOdd)) ? 1 : ((fraction < -0.5 || (fraction == -0.5 && isOdd)) ? -1 : 0);
+	}
+	else if constexpr (rounding == FixedPointRounding::Stochastic)
+	{
+		double fractionAboveFloor = fraction < 0.0 ? fraction + 1.0 : fraction;
+		double randomFraction = static_cast<double>(randomBitsFor<rounding>(generator) >> 11) * powerOfTwo(-53);
+		adjustment = (fraction < 0.0 ? -1 : 0) + (fraction != 0.0 && randomFraction < fractionAboveFloor ? 1 : 0);
+	}
+	if (adjustment > 0 && truncatedValue == largestRawValue)
+	{
+		return fromRawValue(overflowRawValue(false));
+	}
+	return fromRawValue(static_cast<StorageType>(truncatedValue + adjustment));
+}
+/**
+ * @brief Convert a float to the nearest representable fixed-point number under the given rounding.
+ * @details Widening to double is exact, so this rounds exactly like fromDouble.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @tparam rounding The rounding applied to the bits of the value below the least significant bit.
+ * @tparam RandomBitGenerator
+ * @param value
+ * @param generator Source of random bits for FixedPointRounding::Stochastic.
+ * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-inline FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::minimum(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> fixedPointNumbers[], int fixedPointNumbersSize)
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+template <FixedPointRounding rounding, typename RandomBitGenerator>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::fromFloat(float value, RandomBitGenerator &&generator)
 {
-		if (fixedPointNumbersSize == 0)
+	return fromDouble<rounding>(static_cast<double>(value), generator);
+}
+/**
+ * @brief Parse a decimal number such as "-12.34" in the manner of std::from_chars, without allocating or using floating point.
+ * @details Accepts an optional sign, integer digits and an optional fractional part, and stops at the first character
+ * that does not belong to the number. The value is rounded once to a representable value: the first
+ * numberOfFractionalBits + 1 fractional digits decide the rounding exactly and any further digits only break ties.
+ * On error value is left unchanged.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @tparam rounding Rounding applied to the digits that fall below the least significant bit.
+ * @param first Pointer to the first character.
+ * @param last Pointer past the last character.
+ * @param value Receives the parsed number.
+ * @return std::from_chars_result Pointer past the number; errc::invalid_argument if there is no number, errc::result_out_of_range if it does not fit the format.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+template <FixedPointRounding rounding>
+constexpr std::from_chars_result FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::fromChars(const char* first, const char* last, FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &value)
+{
+	const char* current = first;
+	bool isValueNegative = false;
+	if (current != last && (*current == '-' || *current == '+'))
+	{
+		isValueNegative = (*current == '-');
+		current++;
+	}
+	constexpr UnsignedStorageType largestMagnitude = static_cast<UnsignedStorageType>(static_cast<UnsignedStorageType>(1) << (numberOfBits - 1));
+	UnsignedStorageType largestIntegerPart = 0;
+	if constexpr (numberOfFractionalBits < numberOfStorageBits)
+	{
+		largestIntegerPart = static_cast<UnsignedStorageType>(largestMagnitude >> numberOfFractionalBits);
+	}
+	bool isOutOfRange = false;
+	int numberOfDigits = 0;
+	UnsignedStorageType integerPart = 0;
+	while (current != last && *current >= '0' && *current <= '9')
+	{
+		UnsignedStorageType digit = static_cast<UnsignedStorageType>(*current - '0');
+		if (digit > largestIntegerPart || integerPart > static_cast<UnsignedStorageType>((largestIntegerPart - digit) / 10u))
+		{
+			isOutOfRange = true;
+		}
+		else
+		{
+			integerPart = static_cast<UnsignedStorageType>(integerPart * 10u + digit);
+		}
+		numberOfDigits++;
+		current++;
+	}
+	int numberOfFractionalDigits = 0;
+	bool hasNonZeroDiscardedDigits = false;
+	DecimalAccumulatorType fractionalDigits = 0;
+	DecimalAccumulatorType fractionalScale = 1;
+	if (current != last && *current == '.')
+	{
+		current++;
+		while (current != last && *current >= '0' && *current <= '9')
+		{
+			if (numberOfFractionalDigits < numberOfSignificantFractionalDigits)
+			{
+				fractionalDigits = fractionalDigits * static_cast<DecimalAccumulatorType>(10) + static_cast<DecimalAccumulatorType>(*current - '0');
+				fractionalScale = fractionalScale * static_cast<DecimalAccumulatorType>(10);
+			}
+			else if (*current != '0')
+			{
+				hasNonZeroDiscardedDigits = true;
+			}
+			numberOfFractionalDigits++;
+			numberOfDigits++;
+			current++;
+		}
+	}
+	if (numberOfDigits == 0)
+	{
+		return {first, std::errc::invalid_argument};
+	}
+	DecimalAccumulatorType scaledFraction = fractionalDigits << numberOfFractionalBits;
+	DecimalAccumulatorType fractionalBits = scaledFraction / fractionalScale;
+	DecimalAccumulatorType twiceRemainder = (scaledFraction - fractionalBits * fractionalScale) << 1;
+	bool isInexact = twiceRemainder != static_cast<DecimalAccumulatorType>(0) || hasNonZeroDiscardedDigits;
+	bool isHalf = twiceRemainder == fractionalScale && !hasNonZeroDiscardedDigits;
+	bool isAboveHalf = twiceRemainder > fractionalScale || (twiceRemainder == fractionalScale && hasNonZeroDiscardedDigits);
+	bool isMagnitudeRoundedUp = false;
+	if constexpr (rounding == FixedPointRounding::Floor)
+	{
+		isMagnitudeRoundedUp = isValueNegative && isInexact;
+	}
+	else if constexpr (rounding == FixedPointRounding::RoundHalfUp)
+	{
+		isMagnitudeRoundedUp = isAboveHalf || (isHalf && !isValueNegative);
+	}
+	else if constexpr (rounding == FixedPointRounding::RoundHalfEven)
+	{
+		bool isLeastSignificantBitSet = (fractionalBits & static_cast<DecimalAccumulatorType>(1)) != static_cast<DecimalAccumulatorType>(0);
+		if constexpr (numberOfFractionalBits == 0)
+		{
+			isLeastSignificantBitSet = (integerPart & 1u) != 0;
+		}
+		isMagnitudeRoundedUp = isAboveHalf || (isHalf && isLeastSignificantBitSet);
+	}
+	else if constexpr (rounding == FixedPointRounding::Stochastic)
+	{
+		isMagnitudeRoundedUp = isInexact && isRandomFractionBelow(static_cast<DecimalAccumulatorType>(twiceRemainder >> 1), fractionalScale, randomBitsFor<rounding>(FixedPointThreadRandomBitGenerator()));
+	}
+	if (isMagnitudeRoundedUp)
+	{
+		fractionalBits = fractionalBits + static_cast<DecimalAccumulatorType>(1);
+	}
+	UnsignedStorageType largestAllowedMagnitude = isValueNegative ? largestMagnitude : static_cast<UnsignedStorageType>(largestMagnitude - 1u);
+	UnsignedStorageType magnitude = 0;
+	if constexpr (numberOfFractionalBits < numberOfStorageBits)
+	{
+		UnsignedStorageType fractionalMagnitude = static_cast<UnsignedStorageType>(fractionalBits);
+		UnsignedStorageType integerMagnitude = static_cast<UnsignedStorageType>(integerPart << numberOfFractionalBits);
+		if (fractionalMagnitude > largestAllowedMagnitude || integerMagnitude > static_cast<UnsignedStorageType>(largestAllowedMagnitude - fractionalMagnitude))
+		{
+			isOutOfRange = true;
+		}
+		magnitude = static_cast<UnsignedStorageType>(integerMagnitude + fractionalMagnitude);
+	}
+	else
+	{
+		if (fractionalBits > static_cast<DecimalAccumulatorType>(largestAllowedMagnitude))
+		{
+			isOutOfRange = true;
+		}
+		magnitude = static_cast<UnsignedStorageType>(fractionalBits);
+	}
+	if (isOutOfRange)
+	{
+		return {current, std::errc::result_out_of_range};
+	}
+	StorageType result = wrap(magnitude);
+	value.rawValue = isValueNegative ? twosComplement(result) : result;
+	return {current, std::errc()};
+}
+/**
+ * @brief Parse a decimal number from a string view in the manner of std::from_chars.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @tparam rounding Rounding applied to the digits that fall below the least significant bit.
+ * @param valueString
+ * @param value Receives the parsed number.
+ * @return std::from_chars_result
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+template <FixedPointRounding rounding>
+constexpr std::from_chars_result FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::fromChars(std::string_view valueString, FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &value)
+{
+	return fromChars<rounding>(valueString.data(), valueString.data() + valueString.size(), value);
+}
+/**
+ * @brief Find the maximum fixed-point number from an array.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param fixedPointNumbers
+ * @param fixedPointNumbersSize
+ * @throws std::runtime_error If fixedPointNumbersSize is not positive.
+ * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::maximum(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> fixedPointNumbers[], int fixedPointNumbersSize)
+{
+	if (fixedPointNumbersSize <= 0)
+	{
+		throw std::runtime_error("Cannot determine maximum of an empty array.");
+	}
+	return maximum(std::span<const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>>(fixedPointNumbers, static_cast<std::size_t>(fixedPointNumbersSize)));
+}
+/**
+ * @brief Find the minimum fixed-point number from an array.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param fixedPointNumbers
+ * @param fixedPointNumbersSize
+ * @throws std::runtime_error If fixedPointNumbersSize is not positive.
+ * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::minimum(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> fixedPointNumbers[], int fixedPointNumbersSize)
+{
+	if (fixedPointNumbersSize <= 0)
 	{
 		throw std::runtime_error("Cannot determine minimum of an empty array.");
 	}
-	FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> smallestNumber = fixedPointNumbers[0];
-	for (int index = 1; index < fixedPointNumbersSize; index++)
+	return minimum(std::span<const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>>(fixedPointNumbers, static_cast<std::size_t>(fixedPointNumbersSize)));
+}
+/**
+ * @brief Find the maximum fixed-point number from a span, comparing raw values.
+ * @details This is the scalar path; FixedPointArray::maximum vectorizes and parallelizes the same search.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param fixedPointNumbers
+ * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::maximum(std::span<const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>> fixedPointNumbers)
+{
+	if (fixedPointNumbers.empty())
+	{
+		throw std::runtime_error("Cannot determine maximum of an empty array.");
+	}
+	StorageType largestRawValue = fixedPointNumbers[0].rawValue;
+	for (std::size_t index = 1; index < fixedPointNumbers.size(); index++)
+	{
+		if (fixedPointNumbers[index].rawValue > largestRawValue)
+		{
+			largestRawValue = fixedPointNumbers[index].rawValue;
+		}
+	}
+	return fromRawValue(largestRawValue);
+}
+/**
+ * @brief Find the minimum fixed-point number from a span, comparing raw values.
+ * @details This is the scalar path; FixedPointArray::minimum vectorizes and parallelizes the same search.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param fixedPointNumbers
+ * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::minimum(std::span<const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>> fixedPointNumbers)
+{
+	if (fixedPointNumbers.empty())
+	{
+		throw std::runtime_error("Cannot determine minimum of an empty array.");
+	}
+	StorageType smallestRawValue = fixedPointNumbers[0].rawValue;
+	for (std::size_t index = 1; index < fixedPointNumbers.size(); index++)
+	{
+		if (fixedPointNumbers[index].rawValue < smallestRawValue)
+		{
+			smallestRawValue = fixedPointNumbers[index].rawValue;
+		}
+	}
+	return fromRawValue(smallestRawValue);
+}
+/**
+ * @brief Write the decimal digits of an unsigned integer backwards, two at a time, ending at bufferEnd.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param value
+ * @param bufferEnd Pointer past the last digit to write.
+ * @return char* Pointer to the first digit written.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr char* FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::writeIntegerDigits(UnsignedStorageType value, char* bufferEnd)
+{
+	char* current = bufferEnd;
+	while (value >= 100u)
+	{
+		int pairIndex = 2 * static_cast<int>(value % 100u);
+		value = static_cast<UnsignedStorageType>(value / 100u);
+		*--current = fixedPointDigitPairs[pairIndex + 1];
+		*--current = fixedPointDigitPairs[pairIndex];
+	}
+	if (value >= 10u)
+	{
+		int pairIndex = 2 * static_cast<int>(value);
+		*--current = fixedPointDigitPairs[pairIndex + 1];
+		*--current = fixedPointDigitPairs[pairIndex];
+	}
+	else
+	{
+		*--current = static_cast<char>('0' + static_cast<int>(value));
+	}
+	return current;
+}
+/**
+ * @brief Compute 2^exponent exactly as a double by repeated doubling or halving, so that it can be used in constant
+ * expressions.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param exponent Between -1074 and 1023.
+ * @return double
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr double FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::powerOfTwo(int exponent)
+{
+	double result = 1.0;
+	for (; exponent > 0; exponent--)
+	{
+		result *= 2.0;
+	}
+	for (; exponent < 0; exponent++)
 	{
-		if (fixedPointNumbers[index] < smallestNumber)
+		result *= 0.5;
+	}
+	return result;
+}
+/**
+ * @brief Count the bits of a non-negative integer up to and including its most significant set bit.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @tparam Integer A signed native or wide integer type.
+ * @param value Must not be negative.
+ * @return int Zero for a value of zero.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+template <typename Integer>
+constexpr int FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::bitLength(Integer value)
+{
+	constexpr int numberOfValueBits = static_cast<int>(8 * sizeof(Integer));
+	const Integer zero = static_cast<Integer>(0);
+	int step = 1;
+	while (2 * step < numberOfValueBits)
+	{
+		step *= 2;
+	}
+	int length = 0;
+	for (; step > 0; step /= 2)
+	{
+		if (static_cast<Integer>(value >> step) != zero)
 		{
-			smallestNumber = fixedPointNumbers[index];
+			value = static_cast<Integer>(value >> step);
+			length += step;
 		}
 	}
-	return smallestNumber;
+	return value != zero ? length + 1 : length;
+}
+/**
+ * @brief Compute the square root of a non-negative integer, rounded down.
+ * @details Native integers of up to 64 bits start from the double-precision square root and correct it by at most one
+ * in either direction. Wider integers start just above the double-precision root and take Newton steps, each doubling
+ * the number of correct bits, until the root stops decreasing. During constant evaluation every type takes the
+ * digit-by-digit method, which settles one bit of the root per iteration.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @tparam Integer A signed native or wide integer type.
+ * @param value Must not be negative.
+ * @return Integer
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+template <typename Integer>
+constexpr Integer FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::integerSquareRoot(Integer value)
+{
+	const Integer zero = static_cast<Integer>(0);
+	const Integer one = static_cast<Integer>(1);
+	if (!std::is_constant_evaluated())
+	{
+		if constexpr (!fixedPointIsWideInteger<Integer> && sizeof(Integer) <= sizeof(int64_t))
+		{
+			Integer root = static_cast<Integer>(std::sqrt(static_cast<double>(value)));
+			if (static_cast<Integer>(root * root) > value)
+			{
+				root = static_cast<Integer>(root - one);
+			}
+			else if (static_cast<Integer>(value - static_cast<Integer>(root * root)) > static_cast<Integer>(2 * root))
+			{
+				root = static_cast<Integer>(root + one);
+			}
+			return root;
+		}
+		else
+		{
+			if (value == zero)
+			{
+				return zero;
+			}
+			Integer root = static_cast<Integer>(static_cast<Integer>(std::sqrt(static_cast<double>(value)) * (1.0 + 0x1.0p-50)) + one);
+			while (true)
+			{
+				Integer nextRoot = static_cast<Integer>(static_cast<Integer>(root + static_cast<Integer>(value / root)) >> 1);
+				if (nextRoot >= root)
+				{
+					return root;
+				}
+				root = nextRoot;
+			}
+		}
+	}
+	Integer remainder = value;
+	Integer root = zero;
+	Integer bit = value > zero ? static_cast<Integer>(one << ((bitLength(value) - 1) & ~1)) : zero;
+	while (bit != zero)
+	{
+		if (remainder >= static_cast<Integer>(root + bit))
+		{
+			remainder = static_cast<Integer>(remainder - static_cast<Integer>(root + bit));
+			root = static_cast<Integer>(static_cast<Integer>(root >> 1) + bit);
+		}
+		else
+		{
+			root = static_cast<Integer>(root >> 1);
+		}
+		bit = static_cast<Integer>(bit >> 2);
+	}
+	return root;
+}
+/**
+ * @brief Compute the sine and cosine of a raw angle in radians with a circular CORDIC rotation.
+ * @details The angle is multiplied by 1 / (2 * pi) into a 64-bit fraction of a turn, which wraps modulo one turn for
+ * free. Angles in the left half-plane are turned by half a turn, which negates both results, so the rotation starts
+ * within a quarter turn of zero. The rotation then runs fixedPointCordicIterations(numberOfFractionalBits) iterations
+ * of shifts and additions from (K, 0), where K cancels the gain of the rotation, so its residual angle is below
+ * 2^-(numberOfFractionalBits + 3) radians. Each iteration applies its direction as a sign mask instead of a branch,
+ * since the direction is data dependent and would be mispredicted half of the time. The argument reduction keeps about
+ * 60 significant bits of the angle, so angles of magnitude above 2^(56 - numberOfFractionalBits) lose accuracy.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param angle
+ * @param sine Receives the sine in units of 2^-61.
+ * @param cosine Receives the cosine in units of 2^-61.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::rotateCircular(StorageType angle, int64_t &sine, int64_t &cosine)
+{
+	constexpr int numberOfIterations = fixedPointCordicIterations(numberOfFractionalBits);
+	MathProductType product = static_cast<MathProductType>(static_cast<MathProductType>(angle) * static_cast<MathProductType>(fixedPointInverseTwoPi));
+	uint64_t turns;
+	if constexpr (numberOfFractionalBits >= 2)
+	{
+		turns = static_cast<uint64_t>(static_cast<MathProductType>(product >> (numberOfFractionalBits - 2)));
+	}
+	else
+	{
+		turns = static_cast<uint64_t>(static_cast<MathProductType>(product << (2 - numberOfFractionalBits)));
+	}
+	bool isReflected = ((turns + (static_cast<uint64_t>(1) << 62)) >> 63) != 0;
+	if (isReflected)
+	{
+		turns ^= static_cast<uint64_t>(1) << 63;
+	}
+	int64_t residualAngle = static_cast<int64_t>(turns) >> 2;
+	int64_t x = fixedPointCordicCircularGains[numberOfIterations < 31 ? numberOfIterations : 31];
+	int64_t y = 0;
+	for (int iteration = 0; iteration < numberOfIterations; iteration++)
+	{
+		int64_t direction = residualAngle >> 63;
+		int64_t shiftedX = ((x >> iteration) ^ direction) - direction;
+		x -= ((y >> iteration) ^ direction) - direction;
+		y += shiftedX;
+		residualAngle -= (fixedPointCordicCircularTurns[iteration] ^ direction) - direction;
+	}
+	sine = isReflected ? -y : y;
+	cosine = isReflected ? -x : x;
+}
+/**
+ * @brief Find the fewest decimal places whose correctly rounded decimal form parses back to the same raw value.
+ * @details After k digits the leftover fraction measures, in units of 10^-k, how far the nearest k-digit decimal lies
+ * from the exact value; it round-trips once that distance is below half a least significant bit, or equal to it when
+ * the raw value is even and ties are parsed to even. Parsing that truncates, floors or rounds stochastically only
+ * round-trips exact decimals, so for those policies the digits stop once the fraction is used up.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @return int
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr int FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::shortestNumberOfDecimalPlaces() const
+{
+	using FractionType = std::conditional_t<(numberOfFractionalBits + 7 <= numberOfStorageBits), UnsignedStorageType, WideStorageType>;
+	UnsignedStorageType magnitude = static_cast<UnsignedStorageType>(this->rawValue);
+	if (isNegative(this->rawValue))
+	{
+		magnitude = static_cast<UnsignedStorageType>(static_cast<UnsignedStorageType>(0) - magnitude);
+	}
+	magnitude &= bitMask;
+	FractionType one = static_cast<FractionType>(static_cast<FractionType>(1) << numberOfFractionalBits);
+	FractionType fractionMask = static_cast<FractionType>(one - static_cast<FractionType>(1));
+	FractionType fraction = static_cast<FractionType>(static_cast<FractionType>(magnitude) & fractionMask);
+	FractionType powerOfTen = 1;
+	bool isRawValueEven = (magnitude & 1u) == 0;
+	int numberOfDecimalPlaces = 0;
+	while (true)
+	{
+		FractionType twiceFraction = static_cast<FractionType>(fraction + fraction);
+		FractionType twiceDistance = twiceFraction >= one ? static_cast<FractionType>((one - fraction) + (one - fraction)) : twiceFraction;
+		bool isNearestRoundedBack = twiceDistance < powerOfTen || (twiceDistance == powerOfTen && isRawValueEven && roundingPolicy == FixedPointRounding::RoundHalfEven);
+		bool isOnlyExactRoundedBack = roundingPolicy == FixedPointRounding::Truncate || roundingPolicy == FixedPointRounding::Floor || roundingPolicy == FixedPointRounding::Stochastic;
+		if (isOnlyExactRoundedBack ? fraction == 0 : isNearestRoundedBack)
+		{
+			return numberOfDecimalPlaces;
+		}
+		fraction = static_cast<FractionType>(static_cast<FractionType>(fraction * static_cast<FractionType>(10)) & fractionMask);
+		powerOfTen = static_cast<FractionType>(powerOfTen * static_cast<FractionType>(10));
+		numberOfDecimalPlaces++;
+	}
+}
+/**
+ * @brief Write the shortest decimal form of the fixed-point number that parses back to the same value.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param first Pointer to the first character of the buffer.
+ * @param last Pointer past the last character of the buffer.
+ * @return std::to_chars_result
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr std::to_chars_result FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::toChars(char* first, char* last) const
+{
+	return this->toChars(first, last, this->shortestNumberOfDecimalPlaces());
+}
+/**
+ * @brief Write the fixed-point number into a character buffer in the manner of std::to_chars, without allocating or using floating point.
+ * @details The decimal digits are produced exactly from the raw value, two at a time, and rounded half away from zero
+ * to the requested number of decimal places. With zero decimal places the value is written as an integer followed by
+ * ".0". Nothing is null-terminated.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param first Pointer to the first character of the buffer.
+ * @param last Pointer past the last character of the buffer.
+ * @param numberOfDecimalPlaces Number of digits to write after the decimal point.
+ * @return std::to_chars_result Pointer past the written characters, or last and errc::value_too_large if the buffer is too small.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr std::to_chars_result FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::toChars(char* first, char* last, int numberOfDecimalPlaces) const
+{
+	using FractionType = std::conditional_t<(numberOfFractionalBits + 7 <= numberOfStorageBits), UnsignedStorageType, WideStorageType>;
+	bool isValueNegative = isNegative(this->rawValue);
+	UnsignedStorageType magnitude = static_cast<UnsignedStorageType>(this->rawValue);
+	if (isValueNegative)
+	{
+		magnitude = static_cast<UnsignedStorageType>(static_cast<UnsignedStorageType>(0) - magnitude);
+	}
+	magnitude &= bitMask;
+	UnsignedStorageType integerPart = 0;
+	FractionType fraction = static_cast<FractionType>(magnitude);
+	FractionType fractionMask = static_cast<FractionType>((static_cast<FractionType>(1) << numberOfFractionalBits) - static_cast<FractionType>(1));
+	if constexpr (numberOfFractionalBits < numberOfStorageBits)
+	{
+		integerPart = static_cast<UnsignedStorageType>(magnitude >> numberOfFractionalBits);
+		fraction = static_cast<FractionType>(fraction & fractionMask);
+	}
+	int numberOfFractionalDigits = numberOfDecimalPlaces > 0 ? numberOfDecimalPlaces : 1;
+	char integerDigits[FixedPointStorage<numberOfBits>::numberOfStorageBits / 3 + 2] = {};
+	char* integerDigitsEnd = integerDigits + sizeof(integerDigits);
+	char* integerDigitsBegin = writeIntegerDigits(integerPart, integerDigitsEnd);
+	int numberOfIntegerDigits = static_cast<int>(integerDigitsEnd - integerDigitsBegin);
+	if (last - first < static_cast<long long>(isValueNegative) + numberOfIntegerDigits + 1 + numberOfFractionalDigits)
+	{
+		return {last, std::errc::value_too_large};
+	}
+	char* fractionalDigits = first + static_cast<int>(isValueNegative) + numberOfIntegerDigits + 1;
+	int numberOfWrittenDigits = 0;
+	while (numberOfWrittenDigits + 2 <= numberOfDecimalPlaces)
+	{
+		fraction = static_cast<FractionType>(fraction * static_cast<FractionType>(100));
+		int pairIndex = 2 * static_cast<int>(fraction >> numberOfFractionalBits);
+		fraction = static_cast<FractionType>(fraction & fractionMask);
+		fractionalDigits[numberOfWrittenDigits++] = fixedPointDigitPairs[pairIndex];
+		fractionalDigits[numberOfWrittenDigits++] = fixedPointDigitPairs[pairIndex + 1];
+	}
+	if (numberOfWrittenDigits < numberOfDecimalPlaces)
+	{
+		fraction = static_cast<FractionType>(fraction * static_cast<FractionType>(10));
+		fractionalDigits[numberOfWrittenDigits++] = static_cast<char>('0' + static_cast<int>(fraction >> numberOfFractionalBits));
+		fraction = static_cast<FractionType>(fraction & fractionMask);
+	}
+	bool isRoundedUp = false;
+	if constexpr (numberOfFractionalBits > 0)
+	{
+		isRoundedUp = (fraction >> (numberOfFractionalBits - 1)) != static_cast<FractionType>(0);
+	}
+	for (int digitNumber = numberOfWrittenDigits - 1; isRoundedUp && digitNumber >= 0; digitNumber--)
+	{
+		isRoundedUp = (fractionalDigits[digitNumber] == '9');
+		fractionalDigits[digitNumber] = isRoundedUp ? '0' : static_cast<char>(fractionalDigits[digitNumber] + 1);
+	}
+	if (numberOfWrittenDigits == 0)
+	{
+		fractionalDigits[numberOfWrittenDigits++] = '0';
+	}
+	if (isRoundedUp)
+	{
+		integerDigitsBegin = writeIntegerDigits(static_cast<UnsignedStorageType>(integerPart + 1u), integerDigitsEnd);
+		numberOfIntegerDigits = static_cast<int>(integerDigitsEnd - integerDigitsBegin);
+		if (last - first < static_cast<long long>(isValueNegative) + numberOfIntegerDigits + 1 + numberOfFractionalDigits)
+		{
+			return {last, std::errc::value_too_large};
+		}
+		fractionalDigits = first + static_cast<int>(isValueNegative) + numberOfIntegerDigits + 1;
+		for (int digitNumber = 0; digitNumber < numberOfFractionalDigits; digitNumber++)
+		{
+			fractionalDigits[digitNumber] = '0';
+		}
+	}
+	char* current = first;
+	if (isValueNegative)
+	{
+		*current++ = '-';
+	}
+	for (const char* digit = integerDigitsBegin; digit != integerDigitsEnd; digit++)
+	{
+		*current++ = *digit;
+	}
+	*current++ = '.';
+	return {current + numberOfFractionalDigits, std::errc()};
+}
+/**
+ * @brief Convert the fixed-point number to the shortest string representation that parses back to the same value.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @return std::string
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+std::string FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::toString() const
+{
+	return this->toString(this->shortestNumberOfDecimalPlaces());
+}
+/**
+ * @brief Convert the fixed-point number to its string representation with a fixed number of decimal places.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param numberOfDecimalPlaces
+ * @return std::string
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+std::string FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::toString(int numberOfDecimalPlaces) const
+{
+	std::string valueString(numberOfStorageBits / 3 + 4 + static_cast<size_t>(numberOfDecimalPlaces > 0 ? numberOfDecimalPlaces : 1), '\0');
+	std::to_chars_result result = this->toChars(valueString.data(), valueString.data() + valueString.size(), numberOfDecimalPlaces);
+	valueString.resize(static_cast<size_t>(result.ptr - valueString.data()));
+	return valueString;
+}
+/**
+ * @brief Convert the fixed-point number's bits to a string representation.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @return std::string
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+inline std::string FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::bitsToString() const
+{
+	return toBitset(this->rawValue).to_string();
+}
+/**
+ * @brief Print the fixed-point number to standard output.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::print() const
+{
+	char buffer[128];
+	std::to_chars_result result = this->toChars(buffer, buffer + sizeof(buffer));
+	if (result.ec == std::errc())
+	{
+		std::cout.write(buffer, result.ptr - buffer);
+	}
+	else
+	{
+		std::cout << this->toString();
+	}
+}
+/**
+ * @brief Print the fixed-point number followed by a newline to standard output.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::printLine() const
+{
+	this->print();
+	std::cout << std::endl;
+}
+/**
+ * @brief Print the bits of the fixed-point number to standard output.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+inline void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::printBits() const
+{
+	std::cout << this->bitsToString();
+}
+/**
+ * @brief Print the bits of the fixed-point number followed by a newline to standard output.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+inline void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::printBitsLine() const
+{
+	std::cout << this->bitsToString() << std::endl;
+}
+/**
+ * @brief Get the raw two's complement representation of the fixed-point number.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @return StorageType The value scaled by 2^numberOfFractionalBits, sign-extended to the storage type.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr typename FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::StorageType FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::getRawValue() const
+{
+	return this->rawValue;
+}
+/**
+ * @brief Convert to double with a single rounding to nearest, ties to even.
+ * @details The raw value is converted, which is exact for formats of up to 53 bits, and scaled by
+ * 2^-numberOfFractionalBits, which is always exact.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @return double
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr double FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::toDouble() const
+{
+	return static_cast<double>(this->rawValue) * powerOfTwo(-numberOfFractionalBits);
+}
+/**
+ * @brief Convert to float with a single rounding to nearest, ties to even.
+ * @details Formats of up to 53 bits go through the exact double; wider ones convert the raw value to float and scale
+ * it, which is exact except for results below 2^-126 in formats with more than 126 fractional bits.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @return float
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr float FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::toFloat() const
+{
+	if constexpr (numberOfBits <= 53)
+	{
+		return static_cast<float>(this->toDouble());
+	}
+	else
+	{
+		return static_cast<float>(this->rawValue) * static_cast<float>(powerOfTwo(-numberOfFractionalBits));
+	}
+}
+/**
+ * @brief Get the absolute value of the fixed-point number.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::absoluteValue() const
+{
+	if (isNegative(this->rawValue))
+	{
+		return -(*this);
+	}
+	else
+	{
+		return *this;
+	}
+}
+/**
+ * @brief Compute the square root of a fixed-point number.
+ * @details The root of the raw value shifted left by numberOfFractionalBits is computed exactly in WideStorageType, so
+ * the result is correctly rounded to nearest; under FixedPointRounding::Truncate and FixedPointRounding::Floor it is
+ * rounded down instead. Latency is one double-precision square root for formats of up to 32 bits and one iteration
+ * per bit of the root for wider ones.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>
+ * @throws std::domain_error If the number is negative.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::squareRoot() const
+{
+	if (isNegative(this->rawValue))
+	{
+		throw std::domain_error("Square root of a negative fixed-point number.");
+	}
+	WideStorageType value = static_cast<WideStorageType>(static_cast<WideStorageType>(this->rawValue) << numberOfFractionalBits);
+	WideStorageType root = integerSquareRoot(value);
+	if constexpr (roundingPolicy != FixedPointRounding::Truncate && roundingPolicy != FixedPointRounding::Floor)
+	{
+		if (static_cast<WideStorageType>(value - static_cast<WideStorageType>(root * root)) > root)
+		{
+			root = static_cast<WideStorageType>(root + static_cast<WideStorageType>(1));
+		}
+	}
+	return fromScaledInteger(root, numberOfFractionalBits);
+}
+/**
+ * @brief Compute the reciprocal of the square root of a fixed-point number.
+ * @details 2^(3 * numberOfFractionalBits) is divided by the raw value and the integer square root of the quotient
+ * taken, which is exactly the rounded-down root of the real quotient, so the result is correctly rounded like
+ * squareRoot. The intermediate takes about 3 * numberOfFractionalBits bits, so formats with up to 20 fractional bits
+ * need one 64-bit division and one double-precision square root.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>
+ * @throws std::domain_error If the number is not positive.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::reciprocalSquareRoot() const
+{
+	if (!isPositive(this->rawValue))
+	{
+		throw std::domain_error("Reciprocal square root of a non-positive fixed-point number.");
+	}
+	constexpr int numberOfReciprocalBits = (3 * numberOfFractionalBits > numberOfBits ? 3 * numberOfFractionalBits : numberOfBits) + 6;
+	using ReciprocalType = std::conditional_t<(numberOfReciprocalBits <= 64), int64_t, std::conditional_t<(numberOfReciprocalBits <= 128), typename FixedPointStorage<64>::WideSignedType, FixedPointWideInteger<(numberOfReciprocalBits + 63) / 64>>>;
+	const ReciprocalType one = static_cast<ReciprocalType>(1);
+	const ReciprocalType numerator = static_cast<ReciprocalType>(one << (3 * numberOfFractionalBits));
+	const ReciprocalType value = static_cast<ReciprocalType>(this->rawValue);
+	ReciprocalType root = integerSquareRoot(static_cast<ReciprocalType>(numerator / value));
+	if constexpr (roundingPolicy != FixedPointRounding::Truncate && roundingPolicy != FixedPointRounding::Floor)
+	{
+		ReciprocalType fourTimesRoot = static_cast<ReciprocalType>(root << 2);
+		if (static_cast<ReciprocalType>(numerator << 2) >= static_cast<ReciprocalType>(value * static_cast<ReciprocalType>(static_cast<ReciprocalType>(fourTimesRoot * root) + fourTimesRoot + one)))
+		{
+			root = static_cast<ReciprocalType>(root + one);
+		}
+	}
+	return fromScaledInteger(root, numberOfFractionalBits);
+}
+/**
+ * @brief Compute e raised to the power of a fixed-point number.
+ * @details The number is multiplied by log2(e) and split into an integer exponent k and a fraction f, and 2^f is
+ * computed by a hyperbolic CORDIC rotation, which gives cosh + sinh = e^z from shifts and additions alone. The rotation
+ * runs fixedPointCordicIterations(numberOfIntegerBits + numberOfFractionalBits) iterations so that the relative error
+ * stays below one least significant bit of the largest results, and the result is rounded once when 2^f is scaled by
+ * 2^k. It is accurate to one least significant bit for formats of up to 56 bits. Results too large for the format
+ * overflow under overflowPolicy, and results below 2^-(numberOfFractionalBits + 1) are zero.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::exponential() const
+{
+	constexpr int numberOfIterations = fixedPointCordicIterations(numberOfBits);
+	MathProductType product = static_cast<MathProductType>(static_cast<MathProductType>(this->rawValue) * static_cast<MathProductType>(fixedPointLog2E));
+	MathProductType wideExponent = static_cast<MathProductType>(product >> (numberOfFractionalBits + 62));
+	if (wideExponent > static_cast<MathProductType>(numberOfIntegerBits))
+	{
+		return fromRawValue(overflowRawValue(false));
+	}
+	if (wideExponent < static_cast<MathProductType>(-(numberOfFractionalBits + 2)))
+	{
+		return fromRawValue(static_cast<StorageType>(0));
+	}
+	int exponent = static_cast<int>(static_cast<int64_t>(wideExponent));
+	int64_t residualAngle = static_cast<int64_t>(static_cast<uint64_t>(static_cast<MathProductType>(product >> (numberOfFractionalBits + 1))) & ((static_cast<uint64_t>(1) << 61) - 1));
+	int64_t x = fixedPointCordicHyperbolicGains[numberOfIterations < 31 ? numberOfIterations : 31];
+	int64_t y = 0;
+	auto rotate = [&](int iteration)
+	{
+		int64_t direction = residualAngle >> 63;
+		int64_t shiftedX = ((x >> iteration) ^ direction) - direction;
+		x += ((y >> iteration) ^ direction) - direction;
+		y += shiftedX;
+		residualAngle -= (fixedPointCordicHyperbolicAngles[iteration - 1] ^ direction) - direction;
+	};
+	for (int iteration = 1; iteration <= numberOfIterations; iteration++)
+	{
+		rotate(iteration);
+		if (iteration == 4 || iteration == 13 || iteration == 40)
+		{
+			rotate(iteration);
+		}
+	}
+	return fromScaledInteger(static_cast<MathProductType>(x + y), 61 - exponent);
+}
+/**
+ * @brief Compute the base-2 logarithm of a fixed-point number.
+ * @details The raw value is normalized to m * 2^e with m in [1, 2), and log2(m) = 2 * atanh((m - 1) / (m + 1)) / ln(2)
+ * is computed by a hyperbolic CORDIC vectoring of (m + 1, m - 1) over
+ * fixedPointCordicIterations(numberOfFractionalBits) iterations, whose residual is below
+ * 2^-(numberOfFractionalBits + 3). The sum e + log2(m) is rounded once, and the error bound is the same as for sine.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>
+ * @throws std::domain_error If the number is not positive.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::logarithmBase2() const
+{
+	if (!isPositive(this->rawValue))
+	{
+		throw std::domain_error("Logarithm of a non-positive fixed-point number.");
+	}
+	constexpr int numberOfIterations = fixedPointCordicIterations(numberOfFractionalBits);
+	int length = bitLength(this->rawValue);
+	int64_t mantissa;
+	if (length <= 62)
+	{
+		mantissa = static_cast<int64_t>(this->rawValue) << (62 - length);
+	}
+	else
+	{
+		mantissa = static_cast<int64_t>(static_cast<StorageType>(this->rawValue >> (length - 62)));
+	}
+	int64_t x = mantissa + (static_cast<int64_t>(1) << 61);
+	int64_t y = mantissa - (static_cast<int64_t>(1) << 61);
+	int64_t halfLogarithm = 0;
+	auto rotate = [&](int iteration)
+	{
+		int64_t direction = ~(y >> 63);
+		int64_t shiftedX = ((x >> iteration) ^ direction) - direction;
+		x += ((y >> iteration) ^ direction) - direction;
+		y += shiftedX;
+		halfLogarithm -= (fixedPointCordicHyperbolicAngles[iteration - 1] ^ direction) - direction;
+	};
+	for (int iteration = 1; iteration <= numberOfIterations; iteration++)
+	{
+		rotate(iteration);
+		if (iteration == 4 || iteration == 13 || iteration == 40)
+		{
+			rotate(iteration);
+		}
+	}
+	MathProductType logarithm = static_cast<MathProductType>(static_cast<MathProductType>(static_cast<MathProductType>(length - 1 - numberOfFractionalBits) << 61) + static_cast<MathProductType>(2 * halfLogarithm));
+	return fromScaledInteger(logarithm, 61);
+}
+/**
+ * @brief Compute the sine of a fixed-point number of radians.
+ * @details See rotateCircular for the algorithm. For formats of up to 56 bits the result is within one least
+ * significant bit; wider formats are limited by the 61-bit working precision to an error of about 2^-58.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::sine() const
+{
+	int64_t sine = 0;
+	int64_t cosine = 0;
+	rotateCircular(this->rawValue, sine, cosine);
+	return fromScaledInteger(static_cast<MathProductType>(sine), 61);
+}
+/**
+ * @brief Compute the cosine of a fixed-point number of radians.
+ * @details See rotateCircular for the algorithm and sine for the accuracy.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::cosine() const
+{
+	int64_t sine = 0;
+	int64_t cosine = 0;
+	rotateCircular(this->rawValue, sine, cosine);
+	return fromScaledInteger(static_cast<MathProductType>(cosine), 61);
 }
 /**
- * @brief Convert the fixed-point number to its string representation.
+ * @brief Compute the angle in radians of the point (x, y), where y is this number, in (-pi, pi].
+ * @details Both coordinates are scaled by the same power of two so that the larger magnitude fills 61 bits, a point in
+ * the left half-plane is turned by half a turn, and a circular CORDIC vectoring over
+ * fixedPointCordicIterations(numberOfFractionalBits) iterations rotates it onto the positive x axis while accumulating
+ * the angle in radians, which is rounded once. The ratio of the coordinates, not their magnitude, determines the
+ * accuracy, so small coordinates lose nothing, and the error bound is the same as for sine. arcTangent2 of (0, 0) is
+ * zero.
  * @tparam numberOfIntegerBits
  * @tparam numberOfFractionalBits
- * @return std::string
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param x
+ * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-std::string FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::toString() const
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::arcTangent2(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &x) const
 {
-	bool isNegative = *this < 0;
-	std::bitset<numberOfIntegerBits + numberOfFractionalBits> absoluteValueBits = this->bits;
-	if (isNegative)
-	{
-		absoluteValueBits = twosComplement(absoluteValueBits);
-	}
-	uint64_t integerPart = 0;
-	for (int bitNumber = numberOfIntegerBits - 1; bitNumber >= 0; bitNumber--)
-	{
-		integerPart += absoluteValueBits[numberOfFractionalBits + bitNumber] * std::pow(2, bitNumber);
-	}
-	double fractionalPart = 0.0;
-	for (int bitNumber = 0; bitNumber < numberOfFractionalBits - 1; bitNumber++)
+	constexpr int numberOfIterations = fixedPointCordicIterations(numberOfFractionalBits);
+	const WideStorageType zero = static_cast<WideStorageType>(0);
+	WideStorageType abscissa = static_cast<WideStorageType>(x.rawValue);
+	WideStorageType ordinate = static_cast<WideStorageType>(this->rawValue);
+	if (abscissa == zero && ordinate == zero)
 	{
-		fractionalPart += absoluteValueBits[numberOfFractionalBits - bitNumber - 1] * std::pow(2, -bitNumber - 1);
+		return fromRawValue(static_cast<StorageType>(0));
 	}
-	int numberOfDecimalPlaces = (this->numberOfDecimalPlaces == INT_MAX ? 0 : this->numberOfDecimalPlaces);
-	double scale = std::pow(10.0, numberOfDecimalPlaces);
-	uint64_t fractionalDigits = static_cast<uint64_t>(std::round(fractionalPart * scale));
-	if (numberOfDecimalPlaces > 0 && fractionalDigits >= static_cast<uint64_t>(scale))
+	int64_t angle = 0;
+	if (abscissa < zero)
 	{
-		integerPart += 1;
-		fractionalDigits = 0;
+		angle = ordinate < zero ? -fixedPointPi : fixedPointPi;
+		abscissa = static_cast<WideStorageType>(zero - abscissa);
+		ordinate = static_cast<WideStorageType>(zero - ordinate);
 	}
-	std::ostringstream outputStringStream;
-	if (isNegative)
+	WideStorageType magnitude = ordinate < zero ? static_cast<WideStorageType>(zero - ordinate) : ordinate;
+	int length = bitLength(abscissa > magnitude ? abscissa : magnitude);
+	int64_t scaledX;
+	int64_t scaledY;
+	if (length <= 61)
 	{
-		outputStringStream << '-';
+		scaledX = static_cast<int64_t>(abscissa) << (61 - length);
+		scaledY = static_cast<int64_t>(ordinate) * (static_cast<int64_t>(1) << (61 - length));
 	}
-	outputStringStream << integerPart;
-	if (numberOfDecimalPlaces > 0)
+	else
 	{
-		outputStringStream << '.' << std::setw(numberOfDecimalPlaces) << std::setfill('0') << fractionalDigits;
+		scaledX = static_cast<int64_t>(static_cast<WideStorageType>(abscissa >> (length - 61)));
+		scaledY = static_cast<int64_t>(static_cast<WideStorageType>(ordinate >> (length - 61)));
 	}
-	else
+	for (int iteration = 0; iteration < numberOfIterations; iteration++)
 	{
-		outputStringStream << ".0";
+		int64_t direction = scaledY >> 63;
+		int64_t shiftedX = ((scaledX >> iteration) ^ direction) - direction;
+		scaledX += ((scaledY >> iteration) ^ direction) - direction;
+		scaledY -= shiftedX;
+		angle += (fixedPointCordicCircularRadians[iteration] ^ direction) - direction;
 	}
-	return outputStringStream.str();
+	return fromScaledInteger(static_cast<MathProductType>(angle), 60);
 }
 /**
- * @brief Convert the fixed-point number's bits to a string representation.
+ * @brief Add two fixed-point numbers.
+ * @details The sum is computed with wrapping integer arithmetic; it overflowed exactly when both operands have the same
+ * sign and the wrapped sum has the other one, in which case overflowPolicy decides the result.
  * @tparam numberOfIntegerBits
  * @tparam numberOfFractionalBits
- * @return std::string
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param other The other fixed-point number to add.
+ * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> The sum of the two fixed-point numbers.
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-inline std::string FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::bitsToString() const
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::operator+(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other) const
 {
-	return this->bits.to_string();
+	StorageType sum = addRawValues(this->rawValue, other.rawValue);
+	return fromRawValue(checkOverflow(sum, isNegative(static_cast<StorageType>((this->rawValue ^ sum) & (other.rawValue ^ sum))), isNegative(this->rawValue)));
 }
 /**
- * @brief Print the fixed-point number to standard output.
+ * @brief Negate the fixed-point number.
  * @tparam numberOfIntegerBits
  * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> The negated fixed-point number.
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::print() const
-{
-	std::cout << this->toString();
-}
-/**
- * @brief Print the fixed-point number followed by a newline to standard output.
- * @tparam numberOfIntegerBits 
- * @tparam numberOfFractionalBits 
- */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::printLine() const
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::operator-() const
 {
-	this->print();
-	std::cout << std::endl;
+	return fromRawValue(checkOverflow(twosComplement(this->rawValue), this->rawValue == smallestRawValue, false));
 }
 /**
- * @brief Print the bits of the fixed-point number to standard output.
+ * @brief Subtract another fixed-point number from this one.
  * @tparam numberOfIntegerBits
  * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param other The other fixed-point number to subtract.
+ * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> The result of the subtraction.
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-inline void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::printBits() const
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::operator-(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other) const
 {
-	std::cout << this->bitsToString();
+	StorageType difference = subtractRawValues(this->rawValue, other.rawValue);
+	return fromRawValue(checkOverflow(difference, isNegative(static_cast<StorageType>((this->rawValue ^ other.rawValue) & (this->rawValue ^ difference))), isNegative(this->rawValue)));
 }
 /**
- * @brief Print the bits of the fixed-point number followed by a newline to standard output.
+ * @brief Multiply two fixed-point numbers, rounding the exact product with roundingPolicy.
  * @tparam numberOfIntegerBits
  * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param other
+ * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-inline void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::printBitsLine() const
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::operator*(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other) const
 {
-	std::cout << this->bitsToString() << std::endl;
+	return this->multiply(other);
 }
 /**
- * @brief Get the number of decimal places for the fixed-point number.
+ * @brief Multiply the fixed-point number by an integer.
+ * @details The raw value is multiplied by the integer exactly in IntegerProductType, which has room for any product, so
+ * there is no rescaling shift and no rounding; the product is narrowed according to overflowPolicy. Unlike multiplying
+ * by FixedPointNumber(integerValue), this is exact even when the integer is outside the range of the format.
  * @tparam numberOfIntegerBits
  * @tparam numberOfFractionalBits
- * @return int
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param integerValue
+ * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-int FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::getNumberOfDecimalPlaces() const
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::operator*(int integerValue) const
 {
-	return this->numberOfDecimalPlaces;
+	IntegerProductType product = static_cast<IntegerProductType>(static_cast<IntegerProductType>(this->rawValue) * static_cast<IntegerProductType>(integerValue));
+	return fromRawValue(narrowRawValue(product));
 }
 /**
- * @brief Get the absolute value of the fixed-point number.
- * @tparam numberOfIntegerBits 
- * @tparam numberOfFractionalBits 
- * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> 
+ * @brief Multiply two fixed-point numbers with a selectable rounding.
+ * @details The product is formed exactly in the double-width WideStorageType, shifted right by numberOfFractionalBits
+ * and rounded once, then narrowed to the format according to overflowPolicy.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @tparam rounding The rounding applied to the discarded fractional bits of the product.
+ * @tparam RandomBitGenerator
+ * @param other
+ * @param generator Source of random bits for FixedPointRounding::Stochastic.
+ * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::absoluteValue() const
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+template <FixedPointRounding rounding, typename RandomBitGenerator>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::multiply(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other, RandomBitGenerator &&generator) const
 {
-	if (*this < 0)
-	{
-		return -(*this);
-	}
-	else
-	{
-		return *this;
-	}
+	WideStorageType product = multiplyRawValues(this->rawValue, other.rawValue);
+	WideStorageType roundedProduct = shiftRightRounded<rounding>(product, numberOfFractionalBits, randomBitsFor<rounding>(generator));
+	return fromRawValue(narrowRawValue(roundedProduct));
 }
 /**
- * @brief Add two fixed-point numbers.
+ * @brief Multiply by another fixed-point number and add a third, rounding once.
+ * @details The product is formed exactly and the addend is aligned to it, so this * other + addend is exact until the
+ * single rounding by numberOfFractionalBits; the sum is then narrowed according to overflowPolicy. The intermediate is
+ * WideStorageType, which has room for the sum whenever there is at least one integer bit, and AccumulatorType
+ * otherwise.
  * @tparam numberOfIntegerBits
  * @tparam numberOfFractionalBits
- * @param other The other fixed-point number to add.
- * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> The sum of the two fixed-point numbers.
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @tparam rounding The rounding applied to the discarded fractional bits of the sum.
+ * @tparam RandomBitGenerator
+ * @param other
+ * @param addend
+ * @param generator Source of random bits for FixedPointRounding::Stochastic.
+ * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator+(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other) const
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+template <FixedPointRounding rounding, typename RandomBitGenerator>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::fusedMultiplyAdd(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other, const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &addend, RandomBitGenerator &&generator) const
 {
-	std::bitset<numberOfIntegerBits + numberOfFractionalBits> sumBits = addBitsets(this->bits, other.bits, false);
-	return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>(sumBits, std::min(this->numberOfDecimalPlaces, other.numberOfDecimalPlaces));
+	FusedStorageType product = static_cast<FusedStorageType>(multiplyRawValues(this->rawValue, other.rawValue));
+	FusedStorageType alignedAddend = static_cast<FusedStorageType>(static_cast<FusedStorageType>(addend.rawValue) << numberOfFractionalBits);
+	FusedStorageType roundedSum = shiftRightRounded<rounding>(static_cast<FusedStorageType>(product + alignedAddend), numberOfFractionalBits, randomBitsFor<rounding>(generator));
+	return fromRawValue(narrowRawValue(roundedSum));
 }
 /**
- * @brief Negate the fixed-point number.
- * @tparam numberOfIntegerBits 
- * @tparam numberOfFractionalBits 
- * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> The negated fixed-point number.
+ * @brief Add the product of two fixed-point numbers to this one, rounding once, as in acc += value1 * value2.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @tparam rounding The rounding applied to the discarded fractional bits of the sum.
+ * @tparam RandomBitGenerator
+ * @param value1
+ * @param value2
+ * @param generator Source of random bits for FixedPointRounding::Stochastic.
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator-() const
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+template <FixedPointRounding rounding, typename RandomBitGenerator>
+constexpr void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::multiplyAccumulate(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &value1, const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &value2, RandomBitGenerator &&generator)
 {
-	return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>(twosComplement(this->bits), this->numberOfDecimalPlaces);
+	*this = value1.template fusedMultiplyAdd<rounding>(value2, *this, generator);
 }
 /**
- * @brief Subtract another fixed-point number from this one.
- * @tparam numberOfIntegerBits 
- * @tparam numberOfFractionalBits 
- * @param other The other fixed-point number to subtract.
- * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> The result of the subtraction.
+ * @brief Divide this fixed-point number by another, rounding the quotient with roundingPolicy.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param other The divisor fixed-point number.
+ * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> The result of the division.
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator-(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other) const
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::operator/(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other) const
 {
-	return *this + (-other);
+	return this->divide(other);
 }
 /**
- * @brief Multiply two fixed-point numbers.
- * @tparam numberOfIntegerBits 
- * @tparam numberOfFractionalBits 
- * @param other 
- * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> 
+ * @brief Divide this fixed-point number by another with a selectable rounding.
+ * @details The dividend is widened and shifted left by numberOfFractionalBits, divided by the divisor with a single
+ * integer division and rounded once using the remainder, so the latency does not depend on the operands. When the
+ * shifted dividend fills the wide type, the one quotient that does not fit it, the smallest number divided by minus
+ * one least significant bit, is handled before dividing. Division by zero throws std::runtime_error.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @tparam rounding The rounding applied to the quotient.
+ * @tparam RandomBitGenerator
+ * @param other The divisor fixed-point number.
+ * @param generator Source of random bits for FixedPointRounding::Stochastic.
+ * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> The result of the division.
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator*(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other) const
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+template <FixedPointRounding rounding, typename RandomBitGenerator>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::divide(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other, RandomBitGenerator &&generator) const
 {
-	std::bitset<numberOfIntegerBits + numberOfFractionalBits> productBits;
-	std::bitset<numberOfIntegerBits + numberOfFractionalBits> thisBits = this->bits;
-	std::bitset<numberOfIntegerBits + numberOfFractionalBits> otherBits = other.bits;
-	bool productIsNegative = false;
-	if (isNegative(thisBits) && isPositive(otherBits))
-	{
-		thisBits = twosComplement(thisBits);
-		productIsNegative = true;
-	}
-	else if (isPositive(thisBits) && isNegative(otherBits))
-	{
-		otherBits = twosComplement(otherBits);
-		productIsNegative = true;
-	}
-	else if (isNegative(thisBits) && isNegative(otherBits))
+	if (isZero(other.rawValue))
 	{
-		thisBits = twosComplement(thisBits);
-		otherBits = twosComplement(otherBits);
+		throw std::runtime_error("Division by zero");
 	}
-	for (int bitNumber = 0; bitNumber < numberOfFractionalBits; bitNumber++)
+	if constexpr (numberOfBits + numberOfFractionalBits >= 8 * static_cast<int>(sizeof(WideStorageType)))
 	{
-		if (otherBits[bitNumber])
+		if (this->rawValue == smallestRawValue && other.rawValue == static_cast<StorageType>(-1))
 		{
-			std::bitset<numberOfIntegerBits + numberOfFractionalBits> shiftedBits = thisBits >> (numberOfFractionalBits - bitNumber);
-			productBits = addBitsets(productBits, shiftedBits, false);
+			return fromRawValue(checkOverflow(0, true, false));
 		}
 	}
-	for (int bitNumber = numberOfFractionalBits; bitNumber < numberOfIntegerBits + numberOfFractionalBits; bitNumber++)
+	WideStorageType dividend = static_cast<WideStorageType>(static_cast<WideStorageType>(this->rawValue) << numberOfFractionalBits);
+	WideStorageType quotient = divideRounded<rounding>(dividend, static_cast<WideStorageType>(other.rawValue), randomBitsFor<rounding>(generator));
+	return fromRawValue(narrowRawValue(quotient));
+}
+/**
+ * @brief Divide the fixed-point number by an integer.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param integerValue The divisor; zero throws std::runtime_error.
+ * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::operator/(int integerValue) const
+{
+	return this->divide(integerValue);
+}
+/**
+ * @brief Divide the fixed-point number by an integer with a selectable rounding.
+ * @details The raw value is divided by the integer directly, without the shift by numberOfFractionalBits that dividing
+ * by a fixed-point number needs, and the quotient is rounded once using the remainder. Only the smallest number divided
+ * by minus one can overflow, and it is narrowed according to overflowPolicy. Division by zero throws
+ * std::runtime_error.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @tparam rounding The rounding applied to the quotient.
+ * @tparam RandomBitGenerator
+ * @param integerValue The divisor.
+ * @param generator Source of random bits for FixedPointRounding::Stochastic.
+ * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+template <FixedPointRounding rounding, typename RandomBitGenerator>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::divide(int integerValue, RandomBitGenerator &&generator) const
+{
+	if (integerValue == 0)
 	{
-		if (otherBits[bitNumber])
-		{
-			std::bitset<numberOfIntegerBits + numberOfFractionalBits> shiftedBits = thisBits << (bitNumber - numberOfFractionalBits);
-			productBits = addBitsets(productBits, shiftedBits, false);
-		}
+		throw std::runtime_error("Division by zero");
 	}
-	if (productIsNegative)
+	IntegerProductType quotient = divideRounded<rounding>(static_cast<IntegerProductType>(this->rawValue), static_cast<IntegerProductType>(integerValue), randomBitsFor<rounding>(generator));
+	return fromRawValue(narrowRawValue(quotient));
+}
+/**
+ * @brief Calculate the remainder of division between two fixed-point numbers.
+ * @details Like std::fmod, the remainder has the sign of this number and a magnitude less than that of the divisor.
+ * Both operands share the same scale, so this is a single integer remainder of the raw values. Division by zero throws
+ * std::runtime_error.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param other The divisor fixed-point number.
+ * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> The remainder after division.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::operator%(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other) const
+{
+	if (isZero(other.rawValue))
 	{
-		productBits = twosComplement(productBits);
+		throw std::runtime_error("Division by zero");
 	}
-	return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>(productBits, std::min(this->numberOfDecimalPlaces, other.numberOfDecimalPlaces));
+	return fromRawValue(remainderRawValues(this->rawValue, other.rawValue));
 }
 /**
- * @brief Divide this fixed-point number by another.
- * @tparam numberOfIntegerBits 
- * @tparam numberOfFractionalBits 
+ * @brief Calculate the Euclidean remainder of division between two fixed-point numbers.
+ * @details The remainder is never negative and is less than the magnitude of the divisor, whatever the signs of the
+ * operands, which makes it suitable for wrapping a phase into [0, period). Division by zero throws std::runtime_error.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
  * @param other The divisor fixed-point number.
- * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> The result of the division.
+ * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> The remainder after division.
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator/(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other) const
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::euclideanRemainder(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other) const
 {
-	FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> dividend = *this;
-	FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> divisor = other;
-	if (other == 0)
+	if (isZero(other.rawValue))
 	{
 		throw std::runtime_error("Division by zero");
 	}
-	bool isQuotientNegative = false;
-	if (((dividend > 0) && (divisor < 0)) || ((dividend < 0) && (divisor > 0)))
+	StorageType remainder = remainderRawValues(this->rawValue, other.rawValue);
+	if (isNegative(remainder))
 	{
-		isQuotientNegative = true;
+		remainder = isNegative(other.rawValue) ? subtractRawValues(remainder, other.rawValue) : addRawValues(remainder, other.rawValue);
 	}
-	else
+	return fromRawValue(remainder);
+}
+/**
+ * @brief Shift the fixed-point number to the left by a specified amount.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param amountToShift The number of bits to shift left.
+ * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> The shifted fixed-point number.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::operator<<(const int amountToShift) const
+{
+	FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> shiftedValue = *this;
+	if (amountToShift < 0 || amountToShift >= numberOfBits)
 	{
-		isQuotientNegative = false;
+		shiftedValue.rawValue = 0;
 	}
-	dividend = dividend.absoluteValue();
-	divisor = divisor.absoluteValue();
-	FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> quotient = dividend * divisor.reciprocal();
-	quotient.setNumberOfDecimalPlaces(std::min(dividend.getNumberOfDecimalPlaces(), divisor.getNumberOfDecimalPlaces()));
-	if (isQuotientNegative)
+	else
 	{
-		quotient = -quotient;
+		shiftedValue.rawValue = wrap(static_cast<UnsignedStorageType>(static_cast<UnsignedStorageType>(this->rawValue) << amountToShift));
 	}
-	return quotient;
+	shiftedValue.rawValue = checkOverflow(shiftedValue.rawValue, amountToShift < 0 || amountToShift >= numberOfBits ? !isZero(this->rawValue) : (shiftedValue.rawValue >> amountToShift) != this->rawValue, isNegative(this->rawValue));
+	return shiftedValue;
 }
 /**
- * @brief Calculate the remainder of division between two fixed-point numbers.
- * @tparam numberOfIntegerBits 
- * @tparam numberOfFractionalBits 
- * @param other The divisor fixed-point number.
- * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> The remainder after division.
+ * @brief Shift the fixed-point number to the right by a specified amount, dividing it by 2^amountToShift and rounding
+ * with roundingPolicy.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param amountToShift The number of bits to shift right.
+ * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> The shifted fixed-point number.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::operator>>(const int amountToShift) const
+{
+	return this->shiftRight(amountToShift);
+}
+/**
+ * @brief Shift the fixed-point number to the right with a selectable rounding.
+ * @details This is an arithmetic shift: the sign is kept and the value is divided by 2^amountToShift, then the
+ * discarded bits are rounded once. Floor gives the plain arithmetic shift. The result always fits the format. A
+ * negative amount gives zero.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @tparam rounding The rounding applied to the discarded bits.
+ * @tparam RandomBitGenerator
+ * @param amountToShift The number of bits to shift right.
+ * @param generator Source of random bits for FixedPointRounding::Stochastic.
+ * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator%(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other) const
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+template <FixedPointRounding rounding, typename RandomBitGenerator>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::shiftRight(int amountToShift, RandomBitGenerator &&generator) const
 {
-	FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> remainder = *this;
-	while (remainder >= other)
+	constexpr int numberOfWideBits = static_cast<int>(8 * sizeof(WideStorageType));
+	if (amountToShift < 0)
 	{
-		remainder -= other;
+		return fromRawValue(0);
 	}
-	return remainder;
+	int clampedAmountToShift = amountToShift < numberOfWideBits - 1 ? amountToShift : numberOfWideBits - 1;
+	WideStorageType shiftedValue = shiftRightRounded<rounding>(static_cast<WideStorageType>(this->rawValue), clampedAmountToShift, randomBitsFor<rounding>(generator));
+	return fromRawValue(static_cast<StorageType>(shiftedValue));
 }
 /**
- * @brief Shift the fixed-point number to the right by a specified amount.
- * @tparam numberOfIntegerBits 
- * @tparam numberOfFractionalBits 
- * @param amountToShift The number of bits to shift right.
- * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> The shifted fixed-point number.
+ * @brief Multiply the fixed-point number by 2^exponent for an exponent known at compile time.
+ * @details A non-negative exponent is a left shift whose overflow is handled by overflowPolicy, like operator<<, and a
+ * negative one is an arithmetic right shift rounded once, like shiftRight. The direction and the out-of-range cases are
+ * resolved at compile time, so the scaling is a single shift with its overflow check.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @tparam exponent
+ * @tparam rounding The rounding applied to the discarded bits of a right shift.
+ * @tparam RandomBitGenerator
+ * @param generator Source of random bits for FixedPointRounding::Stochastic.
+ * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator<<(const int amountToShift) const
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+template <int exponent, FixedPointRounding rounding, typename RandomBitGenerator>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::scaleByPowerOfTwo(RandomBitGenerator &&generator) const
 {
-	FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> shiftedValue = *this;
-	shiftedValue.bits <<= amountToShift;
-	return shiftedValue;
+	if constexpr (exponent >= numberOfBits)
+	{
+		return fromRawValue(checkOverflow(0, !isZero(this->rawValue), isNegative(this->rawValue)));
+	}
+	else if constexpr (exponent >= 0)
+	{
+		StorageType shiftedValue = wrap(static_cast<UnsignedStorageType>(static_cast<UnsignedStorageType>(this->rawValue) << exponent));
+		return fromRawValue(checkOverflow(shiftedValue, (shiftedValue >> exponent) != this->rawValue, isNegative(this->rawValue)));
+	}
+	else
+	{
+		constexpr int numberOfWideBits = static_cast<int>(8 * sizeof(WideStorageType));
+		constexpr int amountToShift = -exponent < numberOfWideBits - 1 ? -exponent : numberOfWideBits - 1;
+		return fromRawValue(static_cast<StorageType>(shiftRightRounded<rounding>(static_cast<WideStorageType>(this->rawValue), amountToShift, randomBitsFor<rounding>(generator))));
+	}
 }
 /**
- * @brief Shift the fixed-point number to the left by a specified amount.
+ * @brief Convert the fixed-point number to another format with the same policies.
+ * @details Gaining fractional bits is a left shift and losing them is one rounded right shift, both done in the wider
+ * of the two wide storage types, so the only loss is the rounding of dropped fractional bits. A value that does not fit
+ * the integer bits of the new format is handled by overflowPolicy.
  * @tparam numberOfIntegerBits
  * @tparam numberOfFractionalBits
- * @param amountToShift The number of bits to shift left.
- * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> The shifted fixed-point number.
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @tparam resultIntegerBits Number of integer bits of the new format.
+ * @tparam resultFractionalBits Number of fractional bits of the new format.
+ * @tparam rounding The rounding applied to dropped fractional bits.
+ * @tparam RandomBitGenerator
+ * @param generator Source of random bits for FixedPointRounding::Stochastic.
+ * @return FixedPointNumber<resultIntegerBits, resultFractionalBits, overflowPolicy, roundingPolicy>
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator>>(const int amountToShift) const
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+template <int resultIntegerBits, int resultFractionalBits, FixedPointRounding rounding, typename RandomBitGenerator>
+constexpr FixedPointNumber<resultIntegerBits, resultFractionalBits, overflowPolicy, roundingPolicy> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::rescale(RandomBitGenerator &&generator) const
 {
-	FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> shiftedValue = *this;
-	shiftedValue.bits >>= amountToShift;
-	return shiftedValue;
+	using ResultType = FixedPointNumber<resultIntegerBits, resultFractionalBits, overflowPolicy, roundingPolicy>;
+	using IntermediateType = std::conditional_t<(sizeof(typename ResultType::WideStorageType) > sizeof(WideStorageType)), typename ResultType::WideStorageType, WideStorageType>;
+	IntermediateType value = static_cast<IntermediateType>(this->rawValue);
+	if constexpr (resultFractionalBits >= numberOfFractionalBits)
+	{
+		static_cast<void>(generator);
+		value = static_cast<IntermediateType>(value << (resultFractionalBits - numberOfFractionalBits));
+	}
+	else
+	{
+		value = shiftRightRounded<rounding>(value, numberOfFractionalBits - resultFractionalBits, randomBitsFor<rounding>(generator));
+	}
+	return ResultType::fromRawValue(ResultType::narrowRawValue(value));
 }
 /**
  * @brief Bitwise NOT operation on the fixed-point number.
- * @tparam numberOfIntegerBits 
- * @tparam numberOfFractionalBits 
- * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> 
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator~() const
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::operator~() const
 {
-	FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> result = *this;
-	result.bits.flip();
+	FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> result = *this;
+	result.rawValue = static_cast<StorageType>(~this->rawValue);
 	return result;
 }
 /**
  * @brief Bitwise AND operation on the fixed-point number.
- * @tparam numberOfIntegerBits 
- * @tparam numberOfFractionalBits 
- * @param other 
- * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> 
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param other
+ * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator&(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other) const
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::operator&(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other) const
 {
-	FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> result = *this;
-	result.bits &= other.bits;
+	FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> result = *this;
+	result.rawValue = static_cast<StorageType>(this->rawValue & other.rawValue);
 	return result;
 }
 /**
  * @brief Bitwise OR operation on the fixed-point number.
- * @tparam numberOfIntegerBits 
- * @tparam numberOfFractionalBits 
- * @param other 
- * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> 
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param other
+ * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator|(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other) const
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::operator|(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other) const
 {
-	FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> result = *this;
-	result.bits |= other.bits;
+	FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> result = *this;
+	result.rawValue = static_cast<StorageType>(this->rawValue | other.rawValue);
 	return result;
 }
 /**
  * @brief Bitwise XOR operation on the fixed-point number.
- * @tparam numberOfIntegerBits 
- * @tparam numberOfFractionalBits 
- * @param other 
- * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> 
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param other
+ * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator^(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other) const
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::operator^(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other) const
 {
-	FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> result = *this;
-	result.bits ^= other.bits;
+	FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> result = *this;
+	result.rawValue = static_cast<StorageType>(this->rawValue ^ other.rawValue);
 	return result;
 }
 /**
  * @brief Check if two fixed-point numbers are equal.
  * @tparam numberOfIntegerBits
  * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
  * @param other The other fixed-point number to compare.
  * @return true If the two numbers are equal.
  * @return false If the two numbers are not equal.
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-bool FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator==(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other) const
-{
-	FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> difference = *this - other;
-	return isZero(difference.bits);
-}
-/**
- * @brief Check if two fixed-point numbers are not equal.
- * @tparam numberOfIntegerBits 
- * @tparam numberOfFractionalBits 
- * @param other The other fixed-point number to compare.
- * @return true If the two numbers are not equal.
- * @return false If the two numbers are equal.
- */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-bool FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator!=(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other) const
-{
-	return !(*this == other);
-}
-/**
- * @brief Check if this fixed-point number is less than another.
- * @tparam numberOfIntegerBits 
- * @tparam numberOfFractionalBits 
- * @param other The other fixed-point number to compare.
- * @return true If this number is less than the other.
- * @return false If this number is not less than the other.
- */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-bool FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator<(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other) const
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr bool FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::operator==(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other) const
 {
-	FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> difference = *this - other;
-	return isNegative(difference.bits);
+	return this->rawValue == other.rawValue;
 }
 /**
- * @brief Check if this fixed-point number is less than or equal to another.
- * @tparam numberOfIntegerBits 
- * @tparam numberOfFractionalBits 
- * @param other The other fixed-point number to compare.
- * @return true If this number is less than or equal to the other.
- * @return false If this number is greater than the other.
- */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-bool FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator<=(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other) const
-{
-	return (*this < other) || (*this == other);
-}
-/**
- * @brief Check if this fixed-point number is greater than another.
- * @tparam numberOfIntegerBits 
- * @tparam numberOfFractionalBits 
- * @param other The other fixed-point number to compare.
- * @return true If this number is greater than the other.
- * @return false If this number is not greater than the other.
- */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-bool FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator>(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other) const
-{
-	return !(*this <= other);
-}
-/**
- * @brief Check if this fixed-point number is greater than or equal to another.
- * @tparam numberOfIntegerBits 
- * @tparam numberOfFractionalBits 
+ * @brief Three-way comparison of two fixed-point numbers on their raw signed values.
+ * @details The relational operators are derived from this, so every comparison is a single signed integer compare
+ * that is correct across the full range of the format.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
  * @param other The other fixed-point number to compare.
- * @return true If this number is greater than or equal to the other.
- * @return false If this number is less than the other.
+ * @return std::strong_ordering
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-bool FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator>=(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other) const
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr std::strong_ordering FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::operator<=>(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other) const
 {
-	return !(*this < other);
+	return this->rawValue <=> other.rawValue;
 }
 /**
  * @brief Add another fixed-point number to this one in place.
  * @tparam numberOfIntegerBits 
  * @tparam numberOfFractionalBits 
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
  * @param other The other fixed-point number to add.
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator+=(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other)
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::operator+=(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other)
 {
 	*this = *this + other;
 }
@@ -801,21 +2634,25 @@ void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator+=(c
  * @brief Subtract another fixed-point number from this one in place.
  * @tparam numberOfIntegerBits 
  * @tparam numberOfFractionalBits 
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
  * @param other The other fixed-point number to subtract.
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator-=(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other)
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::operator-=(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other)
 {
-	*this += -other;
+	*this = *this - other;
 }
 /**
  * @brief Multiply this fixed-point number by another in place.
  * @tparam numberOfIntegerBits 
  * @tparam numberOfFractionalBits 
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
  * @param other The other fixed-point number to multiply by.
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator*=(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other)
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::operator*=(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other)
 {
 	*this = *this * other;
 }
@@ -823,21 +2660,51 @@ void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator*=(c
  * @brief Divide this fixed-point number by another in place.
  * @tparam numberOfIntegerBits 
  * @tparam numberOfFractionalBits 
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
  * @param other The other fixed-point number to divide by.
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator/=(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other)
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::operator/=(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other)
 {
 	*this = *this / other;
 }
+/**
+ * @brief Multiply this fixed-point number by an integer in place.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param integerValue The integer to multiply by.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::operator*=(int integerValue)
+{
+	*this = *this * integerValue;
+}
+/**
+ * @brief Divide this fixed-point number by an integer in place.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param integerValue The integer to divide by.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::operator/=(int integerValue)
+{
+	*this = *this / integerValue;
+}
 /**
  * @brief Calculate the remainder of division between this fixed-point number and another in place.
  * @tparam numberOfIntegerBits 
  * @tparam numberOfFractionalBits 
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
  * @param other The other fixed-point number to divide by.
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator%=(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other)
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::operator%=(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other)
 {
 	*this = *this % other;
 }
@@ -845,10 +2712,12 @@ void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator%=(c
  * @brief Shift this fixed-point number to the left by a specified amount in place.
  * @tparam numberOfIntegerBits 
  * @tparam numberOfFractionalBits 
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
  * @param amountToShift 
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator<<=(const int amountToShift)
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::operator<<=(const int amountToShift)
 {
 	*this = *this << amountToShift;
 }
@@ -856,10 +2725,12 @@ void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator<<=(
  * @brief Shift this fixed-point number to the right by a specified amount in place.
  * @tparam numberOfIntegerBits 
  * @tparam numberOfFractionalBits 
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
  * @param amountToShift 
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator>>=(const int amountToShift)
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::operator>>=(const int amountToShift)
 {
 	*this = *this >> amountToShift;
 }
@@ -867,10 +2738,12 @@ void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator>>=(
  * @brief Bitwise AND operation in place on this fixed-point number.
  * @tparam numberOfIntegerBits 
  * @tparam numberOfFractionalBits 
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
  * @param other 
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator&=(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other)
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::operator&=(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other)
 {
 	*this = *this & other;
 }
@@ -878,10 +2751,12 @@ void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator&=(c
  * @brief Bitwise OR operation in place on this fixed-point number.
  * @tparam numberOfIntegerBits 
  * @tparam numberOfFractionalBits 
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
  * @param other 
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator|=(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other)
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::operator|=(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other)
 {
 	*this = *this | other;
 }
@@ -889,69 +2764,252 @@ void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator|=(c
  * @brief Bitwise XOR operation in place on this fixed-point number.
  * @tparam numberOfIntegerBits 
  * @tparam numberOfFractionalBits 
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
  * @param other 
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator^=(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other)
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::operator^=(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other)
 {
 	*this = *this ^ other;
 }
 /**
  * @brief Increment the fixed-point number by one.
+ * @details The raw value of one is a compile-time constant added in WideStorageType, so one need not be representable
+ * in the format; a sum outside the range is handled by overflowPolicy.
  * @tparam numberOfIntegerBits
  * @tparam numberOfFractionalBits
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator++(int)
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::operator++(int)
 {
-	*this += FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>(1);
+	this->rawValue = narrowRawValue(static_cast<WideStorageType>(static_cast<WideStorageType>(this->rawValue) + oneRawValue));
 }
 /**
  * @brief Decrement the fixed-point number by one.
+ * @details Subtracts the same constant as operator++.
  * @tparam numberOfIntegerBits 
  * @tparam numberOfFractionalBits 
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator--(int)
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr void FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::operator--(int)
 {
-	*this -= FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>(1);
+	this->rawValue = narrowRawValue(static_cast<WideStorageType>(static_cast<WideStorageType>(this->rawValue) - oneRawValue));
 }
 /**
  * @brief Logical NOT operation on the fixed-point number.
  * @tparam numberOfIntegerBits 
  * @tparam numberOfFractionalBits 
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
  * @return true 
  * @return false 
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-bool FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator!() const
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr bool FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::operator!() const
 {
-	return (*this == 0);
+	return isZero(this->rawValue);
 }
 /**
  * @brief Logical AND operation on the fixed-point number.
  * @tparam numberOfIntegerBits 
  * @tparam numberOfFractionalBits 
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
  * @param other 
  * @return true 
  * @return false 
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-bool FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator&&(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other) const
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr bool FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::operator&&(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other) const
 {
-	return ((*this != 0) && (other != 0));
+	return (!isZero(this->rawValue) && !isZero(other.rawValue));
 }
 /**
  * @brief Logical OR operation on the fixed-point number.
  * @tparam numberOfIntegerBits 
  * @tparam numberOfFractionalBits 
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
  * @param other 
  * @return true 
  * @return false 
  */
-template <int numberOfIntegerBits, int numberOfFractionalBits>
-bool FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>::operator||(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> &other) const
+template <int numberOfIntegerBits, int numberOfFractionalBits, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+constexpr bool FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy>::operator||(const FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits, overflowPolicy, roundingPolicy> &other) const
+{
+	return (!isZero(this->rawValue) || !isZero(other.rawValue));
+}
+/**
+ * @brief Add two fixed-point numbers of different formats exactly.
+ * @details The result has the larger number of fractional bits and one integer bit more than the larger number of
+ * integer bits, so it can hold every sum; both operands are aligned with a left shift and added as integers. Operands
+ * of the same format use the member operator, which keeps the format.
+ * @tparam integerBits1
+ * @tparam fractionalBits1
+ * @tparam integerBits2
+ * @tparam fractionalBits2
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param value1
+ * @param value2
+ * @return FixedPointNumber<(integerBits1 > integerBits2 ? integerBits1 : integerBits2) + 1, (fractionalBits1 > fractionalBits2 ? fractionalBits1 : fractionalBits2), overflowPolicy, roundingPolicy>
+ */
+template <int integerBits1, int fractionalBits1, int integerBits2, int fractionalBits2, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+requires (integerBits1 != integerBits2 || fractionalBits1 != fractionalBits2)
+constexpr FixedPointNumber<(integerBits1 > integerBits2 ? integerBits1 : integerBits2) + 1, (fractionalBits1 > fractionalBits2 ? fractionalBits1 : fractionalBits2), overflowPolicy, roundingPolicy> operator+(const FixedPointNumber<integerBits1, fractionalBits1, overflowPolicy, roundingPolicy> &value1, const FixedPointNumber<integerBits2, fractionalBits2, overflowPolicy, roundingPolicy> &value2)
+{
+	constexpr int resultIntegerBits = (integerBits1 > integerBits2 ? integerBits1 : integerBits2) + 1;
+	constexpr int resultFractionalBits = fractionalBits1 > fractionalBits2 ? fractionalBits1 : fractionalBits2;
+	using ResultType = FixedPointNumber<resultIntegerBits, resultFractionalBits, overflowPolicy, roundingPolicy>;
+	using ResultStorageType = typename ResultType::StorageType;
+	ResultStorageType alignedValue1 = value1.template rescale<resultIntegerBits, resultFractionalBits>().getRawValue();
+	ResultStorageType alignedValue2 = value2.template rescale<resultIntegerBits, resultFractionalBits>().getRawValue();
+	return ResultType::fromRawValue(static_cast<ResultStorageType>(alignedValue1 + alignedValue2));
+}
+/**
+ * @brief Subtract two fixed-point numbers of different formats exactly.
+ * @details The result format is the one of the mixed-format operator+.
+ * @tparam integerBits1
+ * @tparam fractionalBits1
+ * @tparam integerBits2
+ * @tparam fractionalBits2
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param value1
+ * @param value2
+ * @return FixedPointNumber<(integerBits1 > integerBits2 ? integerBits1 : integerBits2) + 1, (fractionalBits1 > fractionalBits2 ? fractionalBits1 : fractionalBits2), overflowPolicy, roundingPolicy>
+ */
+template <int integerBits1, int fractionalBits1, int integerBits2, int fractionalBits2, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+requires (integerBits1 != integerBits2 || fractionalBits1 != fractionalBits2)
+constexpr FixedPointNumber<(integerBits1 > integerBits2 ? integerBits1 : integerBits2) + 1, (fractionalBits1 > fractionalBits2 ? fractionalBits1 : fractionalBits2), overflowPolicy, roundingPolicy> operator-(const FixedPointNumber<integerBits1, fractionalBits1, overflowPolicy, roundingPolicy> &value1, const FixedPointNumber<integerBits2, fractionalBits2, overflowPolicy, roundingPolicy> &value2)
+{
+	constexpr int resultIntegerBits = (integerBits1 > integerBits2 ? integerBits1 : integerBits2) + 1;
+	constexpr int resultFractionalBits = fractionalBits1 > fractionalBits2 ? fractionalBits1 : fractionalBits2;
+	using ResultType = FixedPointNumber<resultIntegerBits, resultFractionalBits, overflowPolicy, roundingPolicy>;
+	using ResultStorageType = typename ResultType::StorageType;
+	ResultStorageType alignedValue1 = value1.template rescale<resultIntegerBits, resultFractionalBits>().getRawValue();
+	ResultStorageType alignedValue2 = value2.template rescale<resultIntegerBits, resultFractionalBits>().getRawValue();
+	return ResultType::fromRawValue(static_cast<ResultStorageType>(alignedValue1 - alignedValue2));
+}
+/**
+ * @brief Multiply two fixed-point numbers of different formats exactly.
+ * @details The result has integerBits1 + integerBits2 integer bits and fractionalBits1 + fractionalBits2 fractional
+ * bits, so the product of the raw values is the raw result with nothing to round and nothing that can overflow.
+ * Operands of the same format use the member operator, which rounds back to the format.
+ * @tparam integerBits1
+ * @tparam fractionalBits1
+ * @tparam integerBits2
+ * @tparam fractionalBits2
+ * @tparam overflowPolicy
+ * @tparam roundingPolicy
+ * @param value1
+ * @param value2
+ * @return FixedPointNumber<integerBits1 + integerBits2, fractionalBits1 + fractionalBits2, overflowPolicy, roundingPolicy>
+ */
+template <int integerBits1, int fractionalBits1, int integerBits2, int fractionalBits2, FixedPointOverflow overflowPolicy, FixedPointRounding roundingPolicy>
+requires (integerBits1 != integerBits2 || fractionalBits1 != fractionalBits2)
+constexpr FixedPointNumber<integerBits1 + integerBits2, fractionalBits1 + fractionalBits2, overflowPolicy, roundingPolicy> operator*(const FixedPointNumber<integerBits1, fractionalBits1, overflowPolicy, roundingPolicy> &value1, const FixedPointNumber<integerBits2, fractionalBits2, overflowPolicy, roundingPolicy> &value2)
+{
+	using ResultType = FixedPointNumber<integerBits1 + integerBits2, fractionalBits1 + fractionalBits2, overflowPolicy, roundingPolicy>;
+	using ResultStorageType = typename ResultType::StorageType;
+	return ResultType::fromRawValue(static_cast<ResultStorageType>(static_cast<ResultStorageType>(value1.getRawValue()) * static_cast<ResultStorageType>(value2.getRawValue())));
+}
+/**
+ * @brief Build a fixed-point number from the characters of a numeric literal at compile time.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam characters The characters of the literal, e.g. '1', '.', '2', '5'.
+ * @return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits, char... characters>
+consteval FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits> fixedPointLiteral()
+{
+	const char literal[] = {characters...};
+	return FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>(std::string_view(literal, sizeof...(characters)));
+}
+/**
+ * @brief User-defined literal for FixedPointNumber<1, 15>, e.g. 1.25_q1_15.
+ * @tparam characters
+ * @return FixedPointNumber<1, 15>
+ */
+template <char... characters>
+consteval FixedPointNumber<1, 15> operator""_q1_15()
+{
+	return fixedPointLiteral<1, 15, characters...>();
+}
+/**
+ * @brief User-defined literal for FixedPointNumber<1, 31>, e.g. 1.25_q1_31.
+ * @tparam characters
+ * @return FixedPointNumber<1, 31>
+ */
+template <char... characters>
+consteval FixedPointNumber<1, 31> operator""_q1_31()
+{
+	return fixedPointLiteral<1, 31, characters...>();
+}
+/**
+ * @brief User-defined literal for FixedPointNumber<4, 12>, e.g. 1.25_q4_12.
+ * @tparam characters
+ * @return FixedPointNumber<4, 12>
+ */
+template <char... characters>
+consteval FixedPointNumber<4, 12> operator""_q4_12()
+{
+	return fixedPointLiteral<4, 12, characters...>();
+}
+/**
+ * @brief User-defined literal for FixedPointNumber<8, 8>, e.g. 1.25_q8_8.
+ * @tparam characters
+ * @return FixedPointNumber<8, 8>
+ */
+template <char... characters>
+consteval FixedPointNumber<8, 8> operator""_q8_8()
+{
+	return fixedPointLiteral<8, 8, characters...>();
+}
+/**
+ * @brief User-defined literal for FixedPointNumber<8, 24>, e.g. 1.25_q8_24.
+ * @tparam characters
+ * @return FixedPointNumber<8, 24>
+ */
+template <char... characters>
+consteval FixedPointNumber<8, 24> operator""_q8_24()
+{
+	return fixedPointLiteral<8, 24, characters...>();
+}
+/**
+ * @brief User-defined literal for FixedPointNumber<16, 16>, e.g. 1.25_q16_16.
+ * @tparam characters
+ * @return FixedPointNumber<16, 16>
+ */
+template <char... characters>
+consteval FixedPointNumber<16, 16> operator""_q16_16()
+{
+	return fixedPointLiteral<16, 16, characters...>();
+}
+/**
+ * @brief User-defined literal for FixedPointNumber<24, 8>, e.g. 1.25_q24_8.
+ * @tparam characters
+ * @return FixedPointNumber<24, 8>
+ */
+template <char... characters>
+consteval FixedPointNumber<24, 8> operator""_q24_8()
+{
+	return fixedPointLiteral<24, 8, characters...>();
+}
+/**
+ * @brief User-defined literal for FixedPointNumber<32, 32>, e.g. 1.25_q32_32.
+ * @tparam characters
+ * @return FixedPointNumber<32, 32>
+ */
+template <char... characters>
+consteval FixedPointNumber<32, 32> operator""_q32_32()
 {
-	return ((*this != 0) || (other != 0));
+	return fixedPointLiteral<32, 32, characters...>();
 }
-#endif
\ No newline at end of file
+#endif
@@ -6,6 +6,9 @@
 #include "FixedPointNumber.hpp"
 #include <iostream>
 #include <fstream>
+#include <random>
+#include <limits>
+#include <vector>
 #ifndef TEST_OUTPUT_FILE
 #define TEST_OUTPUT_FILE "FixedPointNumberTestOutput.txt"
 #endif
@@ -17,7 +20,13 @@ void testDefaultConstructor()
 {
 	try
 	{
-		FixedPointNumber<8, 8> number;
+		static_assert(sizeof(FixedPointNumber<8, 8>) == sizeof(int16_t), "FixedPointNumber must be as wide as its storage.");
+		static_assert(std::is_trivially_copyable_v<FixedPointNumber<8, 8>>, "FixedPointNumber must be trivially copyable.");
+		static_assert(std::is_trivially_default_constructible_v<FixedPointNumber<8, 8>>, "FixedPointNumber must be trivially default constructible.");
+		static_assert(sizeof(FixedPointNumber<128, 128>) == 4 * sizeof(uint64_t), "FixedPointNumber must be as wide as its storage.");
+		static_assert(std::is_trivially_copyable_v<FixedPointNumber<128, 128>>, "FixedPointNumber must be trivially copyable.");
+		static_assert(std::is_trivially_default_constructible_v<FixedPointNumber<128, 128>>, "FixedPointNumber must be trivially default constructible.");
+		FixedPointNumber<8, 8> number{};
 		std::cout << "Default constructor: " << number.toString() << std::endl;
 		file << "Default constructor: " << number.toString() << std::endl;
 	}
@@ -61,6 +70,29 @@ void testNegativeStringConstructor()
 		file << exception.what() << std::endl;
 	}
 }
+/**
+ * @brief Tests parsing with FixedPointNumber::fromChars, including rounding and error reporting.
+ */
+void testFromChars()
+{
+	try
+	{
+		const std::string_view inputs[] = {"0.001953125", "-1.5e3", "127.999", "128", "abc"};
+		for (std::string_view input : inputs)
+		{
+			FixedPointNumber<8, 8> number(0);
+			std::from_chars_result result = FixedPointNumber<8, 8>::fromChars<FixedPointRounding::RoundHalfEven>(input, number);
+			std::string status = result.ec == std::errc() ? "ok" : (result.ec == std::errc::result_out_of_range ? "out of range" : "invalid");
+			std::cout << "From chars: \"" << input << "\" -> " << status << ", parsed " << (result.ptr - input.data()) << " characters, bits " << number.bitsToString() << std::endl;
+			file << "From chars: \"" << input << "\" -> " << status << ", parsed " << (result.ptr - input.data()) << " characters, bits " << number.bitsToString() << std::endl;
+		}
+	}
+	catch(const std::exception& exception)
+	{
+		std::cerr << exception.what() << std::endl;
+		file << exception.what() << std::endl;
+	}
+}
 /**
  * @brief Tests the integer constructor of FixedPointNumber.
  */
@@ -78,6 +110,51 @@ void testIntegerConstructor()
 		file << exception.what() << std::endl;
 	}
 }
+/**
+ * @brief Tests the user-defined literals and constant evaluation of FixedPointNumber.
+ */
+void testUserDefinedLiterals()
+{
+	try
+	{
+		constexpr FixedPointNumber<8, 8> number1 = 1.25_q8_8;
+		constexpr FixedPointNumber<8, 8> number2 = 3.5_q8_8;
+		constexpr FixedPointNumber<8, 8> product = number1 * number2;
+		static_assert(product == FixedPointNumber<8, 8>("4.375"), "Literals must be evaluated at compile time.");
+		std::cout << "User-defined literals: 1.25_q8_8 * 3.5_q8_8 = " << product.bitsToString() << std::endl;
+		file << "User-defined literals: 1.25_q8_8 * 3.5_q8_8 = " << product.bitsToString() << std::endl;
+	}
+	catch(const std::exception& exception)
+	{
+		std::cerr << exception.what() << std::endl;
+		file << exception.what() << std::endl;
+	}
+}
+/**
+ * @brief Tests formatting with FixedPointNumber::toChars, including rounding and a buffer that is too small.
+ */
+void testToChars()
+{
+	try
+	{
+		FixedPointNumber<16, 16> number("-3.14159");
+		char buffer[32];
+		for (int numberOfDecimalPlaces : {0, 2, 4, 16})
+		{
+			std::to_chars_result result = number.toChars(buffer, buffer + sizeof(buffer), numberOfDecimalPlaces);
+			std::cout << "To chars with " << numberOfDecimalPlaces << " decimal places: " << std::string(buffer, result.ptr) << std::endl;
+			file << "To chars with " << numberOfDecimalPlaces << " decimal places: " << std::string(buffer, result.ptr) << std::endl;
+		}
+		std::to_chars_result result = number.toChars(buffer, buffer + 4);
+		std::cout << "To chars into 4 characters: " << (result.ec == std::errc::value_too_large ? "value too large" : "ok") << std::endl;
+		file << "To chars into 4 characters: " << (result.ec == std::errc::value_too_large ? "value too large" : "ok") << std::endl;
+	}
+	catch(const std::exception& exception)
+	{
+		std::cerr << exception.what() << std::endl;
+		file << exception.what() << std::endl;
+	}
+}
 /**
  * @brief Tests the maximum static method of FixedPointNumber.
  */
@@ -89,6 +166,11 @@ void testMaximum()
 		FixedPointNumber<8, 8> maximumNumber = FixedPointNumber<8, 8>::maximum(numbers, 4);
 		std::cout << "Maximum: The maximum of the array, " << numbers->toString() << ",  is " << maximumNumber.toString() << std::endl;
 		file << "Maximum: The maximum of the array, " << numbers->toString() << ",  is " << maximumNumber.toString() << std::endl;
+		std::cout << "Maximum of a negative size: ";
+		file << "Maximum of a negative size: ";
+		FixedPointNumber<8, 8> invalidNumber = FixedPointNumber<8, 8>::maximum(numbers, -1);
+		std::cout << "nothing, result " << invalidNumber.toString() << std::endl;
+		file << "nothing, result " << invalidNumber.toString() << std::endl;
 	}
 	catch(const std::exception& exception)
 	{
@@ -108,6 +190,11 @@ void testMinimum()
 		FixedPointNumber<8, 8> minimumNumber = FixedPointNumber<8, 8>::minimum(numbers, 4);
 		std::cout << "Minimum: The minimum of the array, " << numbers->toString() << ",  is " << minimumNumber.toString() << std::endl;
 		file << "Minimum: The minimum of the array, " << numbers->toString() << ",  is " << minimumNumber.toString() << std::endl;
+		std::cout << "Minimum of a negative size: ";
+		file << "Minimum of a negative size: ";
+		FixedPointNumber<8, 8> invalidNumber = FixedPointNumber<8, 8>::minimum(numbers, -1);
+		std::cout << "nothing, result " << invalidNumber.toString() << std::endl;
+		file << "nothing, result " << invalidNumber.toString() << std::endl;
 	}
 	catch(const std::exception& exception)
 	{
@@ -117,15 +204,15 @@ void testMinimum()
 	
 }
 /**
- * @brief Tests the getNumberOfDecimalPlaces method of FixedPointNumber.
+ * @brief Tests toString with a fixed number of decimal places.
  */
-void testGetNumberOfDecimalPlaces()
+void testToStringWithDecimalPlaces()
 {
 	try
 	{
 		FixedPointNumber<8, 8> number("12.340");
-		std::cout << "getNumberOfDecimalPlaces: Number of Decimal Places of (\"12.340\") is " << number.getNumberOfDecimalPlaces() << std::endl;
-		file << "getNumberOfDecimalPlaces: Number of Decimal Places of (\"12.340\") is " << number.getNumberOfDecimalPlaces() << std::endl;
+		std::cout << "toString with decimal places: (\"12.340\") with 3 decimal places is " << number.toString(3) << std::endl;
+		file << "toString with decimal places: (\"12.340\") with 3 decimal places is " << number.toString(3) << std::endl;
 	}
 	catch(const std::exception& exception)
 	{
@@ -282,6 +369,32 @@ void testNegativeMultiplication()
 		file << exception.what() << std::endl;
 	}
 }
+/**
+ * @brief Tests the multiply method of FixedPointNumber with each rounding.
+ */
+void testMultiplyWithRounding()
+{
+	try
+	{
+		FixedPointNumber<8, 8> number1("-0.0078125");
+		FixedPointNumber<8, 8> number2("0.25");
+		std::cout << "Multiply with rounding: " << number1.bitsToString() << " * " << number2.bitsToString() << " = "
+			<< number1.multiply<FixedPointRounding::Truncate>(number2).bitsToString() << " (truncate), "
+			<< number1.multiply<FixedPointRounding::Floor>(number2).bitsToString() << " (floor), "
+			<< number1.multiply<FixedPointRounding::RoundHalfUp>(number2).bitsToString() << " (round half up), "
+			<< number1.multiply<FixedPointRounding::RoundHalfEven>(number2).bitsToString() << " (round half even)" << std::endl;
+		file << "Multiply with rounding: " << number1.bitsToString() << " * " << number2.bitsToString() << " = "
+			<< number1.multiply<FixedPointRounding::Truncate>(number2).bitsToString() << " (truncate), "
+			<< number1.multiply<FixedPointRounding::Floor>(number2).bitsToString() << " (floor), "
+			<< number1.multiply<FixedPointRounding::RoundHalfUp>(number2).bitsToString() << " (round half up), "
+			<< number1.multiply<FixedPointRounding::RoundHalfEven>(number2).bitsToString() << " (round half even)" << std::endl;
+	}
+	catch(const std::exception& exception)
+	{
+		std::cerr << exception.what() << std::endl;
+		file << exception.what() << std::endl;
+	}
+}
 /**
  * @brief Tests the division operator of FixedPointNumber.
  */
@@ -301,6 +414,337 @@ void testDivisionOperator()
 		file << exception.what() << std::endl;
 	}
 }
+/**
+ * @brief Tests the divide method of FixedPointNumber with each rounding.
+ */
+void testDivideWithRounding()
+{
+	try
+	{
+		FixedPointNumber<8, 8> number1("-1.0");
+		FixedPointNumber<8, 8> number2("3.0");
+		std::cout << "Divide with rounding: " << number1.bitsToString() << " / " << number2.bitsToString() << " = "
+			<< number1.divide<FixedPointRounding::Truncate>(number2).bitsToString() << " (truncate), "
+			<< number1.divide<FixedPointRounding::Floor>(number2).bitsToString() << " (floor), "
+			<< number1.divide<FixedPointRounding::RoundHalfUp>(number2).bitsToString() << " (round half up), "
+			<< number1.divide<FixedPointRounding::RoundHalfEven>(number2).bitsToString() << " (round half even)" << std::endl;
+		file << "Divide with rounding: " << number1.bitsToString() << " / " << number2.bitsToString() << " = "
+			<< number1.divide<FixedPointRounding::Truncate>(number2).bitsToString() << " (truncate), "
+			<< number1.divide<FixedPointRounding::Floor>(number2).bitsToString() << " (floor), "
+			<< number1.divide<FixedPointRounding::RoundHalfUp>(number2).bitsToString() << " (round half up), "
+			<< number1.divide<FixedPointRounding::RoundHalfEven>(number2).bitsToString() << " (round half even)" << std::endl;
+	}
+	catch(const std::exception& exception)
+	{
+		std::cerr << exception.what() << std::endl;
+		file << exception.what() << std::endl;
+	}
+}
+/**
+ * @brief Tests that dividing a FixedPointNumber by zero throws.
+ */
+void testDivisionByZero()
+{
+	try
+	{
+		FixedPointNumber<8, 8> number1("1.0");
+		FixedPointNumber<8, 8> number2("0.0");
+		std::cout << "Division by zero: " << number1.toString() << " / " << number2.toString() << " throws: ";
+		file << "Division by zero: " << number1.toString() << " / " << number2.toString() << " throws: ";
+		FixedPointNumber<8, 8> quotient = number1 / number2;
+		std::cout << "nothing, result " << quotient.toString() << std::endl;
+		file << "nothing, result " << quotient.toString() << std::endl;
+	}
+	catch(const std::exception& exception)
+	{
+		std::cout << exception.what() << std::endl;
+		file << exception.what() << std::endl;
+	}
+}
+/**
+ * @brief Tests multiplying and dividing by integers, scaling by powers of two and incrementing a format without one.
+ */
+void testIntegerOperands()
+{
+	try
+	{
+		FixedPointNumber<8, 8> number("5.5");
+		FixedPointNumber<1, 15> fraction("0.3");
+		FixedPointNumber<1, 15, FixedPointOverflow::Saturate> saturatingFraction("-0.5");
+		saturatingFraction++;
+		FixedPointNumber<32, 32> wideNumber("-12345.75");
+		bool isWideMatching = wideNumber * 100000 == wideNumber * FixedPointNumber<32, 32>(100000) && wideNumber / 7 == wideNumber / FixedPointNumber<32, 32>(7);
+		std::cout << "Integer operands: " << wideNumber.toString() << " * 100000 = " << (wideNumber * 100000).toString() << ", " << wideNumber.toString() << " / 7 = " << (wideNumber / 7).toString() << " as <32, 32>, " << (isWideMatching ? "matching" : "not matching") << " fixed-point operands" << std::endl;
+		file << "Integer operands: " << wideNumber.toString() << " * 100000 = " << (wideNumber * 100000).toString() << ", " << wideNumber.toString() << " / 7 = " << (wideNumber / 7).toString() << " as <32, 32>, " << (isWideMatching ? "matching" : "not matching") << " fixed-point operands" << std::endl;
+		std::cout << "Integer operands: " << number.toString() << " * 3 = " << (number * 3).toString() << ", " << number.toString() << " / -4 = " << (number / -4).toString() << ", " << fraction.toString() << " * 3 = " << (fraction * 3).toString() << ", " << number.toString() << " * 2^3 = " << number.scaleByPowerOfTwo<3>().toString() << ", " << number.toString() << " * 2^-2 = " << number.scaleByPowerOfTwo<-2>().toString() << ", -0.5++ = " << saturatingFraction.toString() << " as <1, 15> saturating, " << number.toString() << " / 0 throws: ";
+		file << "Integer operands: " << number.toString() << " * 3 = " << (number * 3).toString() << ", " << number.toString() << " / -4 = " << (number / -4).toString() << ", " << fraction.toString() << " * 3 = " << (fraction * 3).toString() << ", " << number.toString() << " * 2^3 = " << number.scaleByPowerOfTwo<3>().toString() << ", " << number.toString() << " * 2^-2 = " << number.scaleByPowerOfTwo<-2>().toString() << ", -0.5++ = " << saturatingFraction.toString() << " as <1, 15> saturating, " << number.toString() << " / 0 throws: ";
+		FixedPointNumber<8, 8> quotient = number / 0;
+		std::cout << "nothing, result " << quotient.toString() << std::endl;
+		file << "nothing, result " << quotient.toString() << std::endl;
+	}
+	catch(const std::exception& exception)
+	{
+		std::cout << exception.what() << std::endl;
+		file << exception.what() << std::endl;
+	}
+}
+/**
+ * @brief Tests each overflow policy of FixedPointNumber on an addition that does not fit the format.
+ */
+void testOverflowPolicies()
+{
+	try
+	{
+		FixedPointNumber<8, 8, FixedPointOverflow::Wrap> wrapped = FixedPointNumber<8, 8, FixedPointOverflow::Wrap>(100) + FixedPointNumber<8, 8, FixedPointOverflow::Wrap>(100);
+		FixedPointNumber<8, 8, FixedPointOverflow::Saturate> saturated = FixedPointNumber<8, 8, FixedPointOverflow::Saturate>(100) + FixedPointNumber<8, 8, FixedPointOverflow::Saturate>(100);
+		FixedPointNumber<8, 8, FixedPointOverflow::Saturate> saturatedProduct = FixedPointNumber<8, 8, FixedPointOverflow::Saturate>("-20") * FixedPointNumber<8, 8, FixedPointOverflow::Saturate>("10");
+		FixedPointNumber<8, 8, FixedPointOverflow::Saturate> saturatedString("300");
+		fixedPointOverflowFlag = false;
+		FixedPointNumber<8, 8, FixedPointOverflow::Sticky> sticky = FixedPointNumber<8, 8, FixedPointOverflow::Sticky>(100) + FixedPointNumber<8, 8, FixedPointOverflow::Sticky>(100);
+		bool isStickyFlagSet = fixedPointOverflowFlag;
+		sticky -= FixedPointNumber<8, 8, FixedPointOverflow::Sticky>(1);
+		bool isStickyFlagStillSet = fixedPointOverflowFlag;
+		fixedPointOverflowFlag = false;
+		std::cout << "Overflow policies: 100 + 100 = " << wrapped.toString() << " (wrap), " << saturated.toString() << " (saturate), "
+			<< sticky.toString() << " after - 1 with flag " << (isStickyFlagSet && isStickyFlagStillSet ? "set" : "clear") << " (sticky), -20 * 10 = " << saturatedProduct.toString()
+			<< " and \"300\" = " << saturatedString.toString() << " (saturate), throw: ";
+		file << "Overflow policies: 100 + 100 = " << wrapped.toString() << " (wrap), " << saturated.toString() << " (saturate), "
+			<< sticky.toString() << " after - 1 with flag " << (isStickyFlagSet && isStickyFlagStillSet ? "set" : "clear") << " (sticky), -20 * 10 = " << saturatedProduct.toString()
+			<< " and \"300\" = " << saturatedString.toString() << " (saturate), throw: ";
+		FixedPointNumber<8, 8, FixedPointOverflow::Throw> thrown = FixedPointNumber<8, 8, FixedPointOverflow::Throw>(100) + FixedPointNumber<8, 8, FixedPointOverflow::Throw>(100);
+		std::cout << "nothing, result " << thrown.toString() << std::endl;
+		file << "nothing, result " << thrown.toString() << std::endl;
+	}
+	catch(const std::exception& exception)
+	{
+		std::cout << exception.what() << std::endl;
+		file << exception.what() << std::endl;
+	}
+}
+/**
+ * @brief Tests each rounding policy of FixedPointNumber on a right shift, and stochastic rounding of a product with a
+ * supplied generator.
+ */
+void testRoundingPolicies()
+{
+	try
+	{
+		FixedPointNumber<8, 0, FixedPointOverflow::Wrap, FixedPointRounding::Truncate> truncated = FixedPointNumber<8, 0, FixedPointOverflow::Wrap, FixedPointRounding::Truncate>(-6) >> 2;
+		FixedPointNumber<8, 0, FixedPointOverflow::Wrap, FixedPointRounding::Floor> floored = FixedPointNumber<8, 0, FixedPointOverflow::Wrap, FixedPointRounding::Floor>(-6) >> 2;
+		FixedPointNumber<8, 0, FixedPointOverflow::Wrap, FixedPointRounding::RoundHalfUp> roundedHalfUp = FixedPointNumber<8, 0, FixedPointOverflow::Wrap, FixedPointRounding::RoundHalfUp>(-6) >> 2;
+		FixedPointNumber<8, 0, FixedPointOverflow::Wrap, FixedPointRounding::RoundHalfEven> roundedHalfEven = FixedPointNumber<8, 0, FixedPointOverflow::Wrap, FixedPointRounding::RoundHalfEven>(-6) >> 2;
+		std::mt19937_64 generator(2024);
+		FixedPointNumber<8, 8, FixedPointOverflow::Wrap, FixedPointRounding::Stochastic> half("0.5");
+		FixedPointNumber<8, 8, FixedPointOverflow::Wrap, FixedPointRounding::Stochastic> leastSignificantBit = FixedPointNumber<8, 8, FixedPointOverflow::Wrap, FixedPointRounding::Stochastic>::fromRawValue(1);
+		int numberOfRoundsUp = 0;
+		for (int sample = 0; sample < 10000; sample++)
+		{
+			numberOfRoundsUp += half.multiply(leastSignificantBit, generator).getRawValue();
+		}
+		std::cout << "Rounding policies: -6 >> 2 = " << truncated.toString() << " (truncate), " << floored.toString() << " (floor), "
+			<< roundedHalfUp.toString() << " (round half up), " << roundedHalfEven.toString() << " (round half even), 0.5 * 2^-8 rounded up "
+			<< numberOfRoundsUp << " of 10000 times (stochastic)" << std::endl;
+		file << "Rounding policies: -6 >> 2 = " << truncated.toString() << " (truncate), " << floored.toString() << " (floor), "
+			<< roundedHalfUp.toString() << " (round half up), " << roundedHalfEven.toString() << " (round half even), 0.5 * 2^-8 rounded up "
+			<< numberOfRoundsUp << " of 10000 times (stochastic)" << std::endl;
+	}
+	catch(const std::exception& exception)
+	{
+		std::cerr << exception.what() << std::endl;
+		file << exception.what() << std::endl;
+	}
+}
+/**
+ * @brief Tests arithmetic between different formats, whose result format is computed at compile time, and rescaling.
+ */
+void testMixedFormatArithmetic()
+{
+	try
+	{
+		FixedPointNumber<8, 8> coefficient("-3.25");
+		FixedPointNumber<16, 16> sample("100.125");
+		FixedPointNumber<24, 24> product = coefficient * sample;
+		FixedPointNumber<17, 16> sum = coefficient + sample;
+		FixedPointNumber<8, 8> rescaledSample = sample.rescale<8, 8>();
+		FixedPointNumber<16, 16> rescaledCoefficient = coefficient.rescale<16, 16>();
+		std::cout << "Mixed formats: -3.25 (Q8.8) * 100.125 (Q16.16) = " << product.toString() << " (Q24.24), sum " << sum.toString()
+			<< " (Q17.16), rescaled to Q8.8 " << rescaledSample.toString() << " and Q16.16 " << rescaledCoefficient.toString() << std::endl;
+		file << "Mixed formats: -3.25 (Q8.8) * 100.125 (Q16.16) = " << product.toString() << " (Q24.24), sum " << sum.toString()
+			<< " (Q17.16), rescaled to Q8.8 " << rescaledSample.toString() << " and Q16.16 " << rescaledCoefficient.toString() << std::endl;
+	}
+	catch(const std::exception& exception)
+	{
+		std::cerr << exception.what() << std::endl;
+		file << exception.what() << std::endl;
+	}
+}
+/**
+ * @brief Tests fusedMultiplyAdd and multiplyAccumulate, which round a * b + c once instead of twice.
+ */
+void testFusedMultiplyAdd()
+{
+	try
+	{
+		using HalfEvenNumber = FixedPointNumber<8, 8, FixedPointOverflow::Wrap, FixedPointRounding::RoundHalfEven>;
+		HalfEvenNumber value1 = HalfEvenNumber::fromRawValue(3);
+		HalfEvenNumber value2("0.5");
+		HalfEvenNumber addend = HalfEvenNumber::fromRawValue(-1);
+		HalfEvenNumber separate = value1 * value2 + addend;
+		HalfEvenNumber fused = value1.fusedMultiplyAdd(value2, addend);
+		FixedPointNumber<16, 16> accumulator("1.5");
+		accumulator.multiplyAccumulate(FixedPointNumber<16, 16>("2.25"), FixedPointNumber<16, 16>("-4.0"));
+		std::cout << "Fused multiply-add: 3 LSB * 0.5 - 1 LSB = " << separate.bitsToString() << " rounded twice, " << fused.bitsToString()
+			<< " rounded once; 1.5 + 2.25 * -4.0 = " << accumulator.toString() << std::endl;
+		file << "Fused multiply-add: 3 LSB * 0.5 - 1 LSB = " << separate.bitsToString() << " rounded twice, " << fused.bitsToString()
+			<< " rounded once; 1.5 + 2.25 * -4.0 = " << accumulator.toString() << std::endl;
+	}
+	catch(const std::exception& exception)
+	{
+		std::cerr << exception.what() << std::endl;
+		file << exception.what() << std::endl;
+	}
+}
+/**
+ * @brief Tests conversion to and from double and float.
+ */
+void testFloatingPointConversion()
+{
+	try
+	{
+		FixedPointNumber<8, 8> nearest = FixedPointNumber<8, 8>::fromDouble(-2.71828);
+		FixedPointNumber<8, 8> truncated = FixedPointNumber<8, 8>::fromDouble<FixedPointRounding::Truncate>(-2.71828);
+		FixedPointNumber<8, 8> floored = FixedPointNumber<8, 8>::fromDouble<FixedPointRounding::Floor>(-2.71828);
+		FixedPointNumber<8, 8> tieUp = FixedPointNumber<8, 8>::fromDouble(2.5 / 256.0);
+		FixedPointNumber<8, 8> tieEven = FixedPointNumber<8, 8>::fromDouble<FixedPointRounding::RoundHalfEven>(2.5 / 256.0);
+		FixedPointNumber<8, 8> saturated = FixedPointNumber<8, 8>::fromFloat(1.0e9f);
+		FixedPointNumber<8, 8> notANumber = FixedPointNumber<8, 8>::fromDouble(std::numeric_limits<double>::quiet_NaN());
+		FixedPointNumber<16, 16> value("-1234.5678");
+		std::cout << "Floating-point conversion: -2.71828 = " << nearest.toString() << " (round half up), " << truncated.toString() << " (truncate), " << floored.toString()
+			<< " (floor); 2.5 LSB = " << tieUp.getRawValue() << " LSB (round half up), " << tieEven.getRawValue() << " LSB (round half even); 1e9 = " << saturated.toString()
+			<< ", NaN = " << notANumber.toString() << "; -1234.5678 (Q16.16) = " << value.toDouble() << " as double, " << value.toFloat() << " as float" << std::endl;
+		file << "Floating-point conversion: -2.71828 = " << nearest.toString() << " (round half up), " << truncated.toString() << " (truncate), " << floored.toString()
+			<< " (floor); 2.5 LSB = " << tieUp.getRawValue() << " LSB (round half up), " << tieEven.getRawValue() << " LSB (round half even); 1e9 = " << saturated.toString()
+			<< ", NaN = " << notANumber.toString() << "; -1234.5678 (Q16.16) = " << value.toDouble() << " as double, " << value.toFloat() << " as float" << std::endl;
+	}
+	catch(const std::exception& exception)
+	{
+		std::cerr << exception.what() << std::endl;
+		file << exception.what() << std::endl;
+	}
+}
+/**
+ * @brief Tests a Q128.128 format, whose 256-bit storage is a multi-limb wide integer.
+ */
+void testWideStorage()
+{
+	try
+	{
+		FixedPointNumber<128, 128> number1("12345678901234567890123456789.000000000000000000000000000000000001");
+		FixedPointNumber<128, 128> number2("-3.25");
+		FixedPointNumber<128, 128> product = number1 * number2;
+		FixedPointNumber<128, 128> quotient = number1 / number2;
+		std::cout << "Wide storage: " << number1.toString() << " * " << number2.toString() << " = " << product.toString() << ", / = " << quotient.toString() << std::endl;
+		file << "Wide storage: " << number1.toString() << " * " << number2.toString() << " = " << product.toString() << ", / = " << quotient.toString() << std::endl;
+	}
+	catch(const std::exception& exception)
+	{
+		std::cerr << exception.what() << std::endl;
+		file << exception.what() << std::endl;
+	}
+}
+/**
+ * @brief Check that the Karatsuba product of multiplyFull matches the schoolbook product of the operands extended to
+ * twice as many limbs, for all-ones, mixed-sign and pseudo-random operands.
+ * @tparam numberOfLimbs Number of limbs of each operand, at least FixedPointWideInteger::karatsubaThreshold.
+ * @return true If every product matches.
+ * @return false If any product differs.
+ */
+template <int numberOfLimbs>
+bool karatsubaMatchesSchoolbook()
+{
+	using Operand = FixedPointWideInteger<numberOfLimbs>;
+	using Product = FixedPointWideInteger<2 * numberOfLimbs>;
+	static_assert(numberOfLimbs >= Operand::karatsubaThreshold, "The operands must be wide enough to take the Karatsuba path.");
+	const Operand allOnes = ~Operand{};
+	const Operand largest = allOnes >> 1;
+	std::vector<Operand> operands = {allOnes, largest, -largest, ~largest, Operand(1), Operand(-3)};
+	uint64_t state = 0x9E3779B97F4A7C15ULL;
+	for (int operandNumber = 0; operandNumber < 8; operandNumber++)
+	{
+		Operand operand{};
+		for (int limbNumber = 0; limbNumber < numberOfLimbs; limbNumber++)
+		{
+			state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+			operand = (operand << 64) | Operand(operandNumber % 2 == 0 && limbNumber % 3 == 0 ? ~static_cast<uint64_t>(0) : state);
+		}
+		operands.push_back(operand);
+		operands.push_back(-operand);
+	}
+	bool isMatching = true;
+	for (const Operand &operand1 : operands)
+	{
+		for (const Operand &operand2 : operands)
+		{
+			isMatching = isMatching && Operand::multiplyFull(operand1, operand2) == Product(operand1) * Product(operand2);
+		}
+	}
+	return isMatching;
+}
+/**
+ * @brief Tests the Karatsuba path of FixedPointWideInteger::multiplyFull on 1024-bit and 2048-bit operands, directly
+ * and through the product of a 1024-bit format.
+ */
+void testKaratsubaMultiplication()
+{
+	try
+	{
+		using UnsignedOperand = FixedPointWideInteger<16, false>;
+		using UnsignedProduct = FixedPointWideInteger<32, false>;
+		bool isAllOnesSquareMatching = UnsignedOperand::multiplyFull(~UnsignedOperand{}, ~UnsignedOperand{}) == UnsignedProduct(1) - (UnsignedProduct(1) << 1025);
+		bool isMatching = karatsubaMatchesSchoolbook<16>() && karatsubaMatchesSchoolbook<32>();
+		FixedPointNumber<512, 512> number1("-1.5");
+		FixedPointNumber<512, 512> number2("2.25");
+		FixedPointNumber<512, 512> product = number1 * number2;
+		bool isProductMatching = product == FixedPointNumber<512, 512>("-3.375") && number1 * number1 == FixedPointNumber<512, 512>("2.25");
+		std::cout << "Karatsuba multiplication: 1024-bit and 2048-bit products " << (isMatching ? "matching" : "not matching") << " schoolbook, (2^1024 - 1)^2 "
+			<< (isAllOnesSquareMatching ? "matching" : "not matching") << " 2^2048 - 2^1025 + 1, -1.5 * 2.25 " << (isProductMatching ? "matching" : "not matching") << " -3.375 as <512, 512>" << std::endl;
+		file << "Karatsuba multiplication: 1024-bit and 2048-bit products " << (isMatching ? "matching" : "not matching") << " schoolbook, (2^1024 - 1)^2 "
+			<< (isAllOnesSquareMatching ? "matching" : "not matching") << " 2^2048 - 2^1025 + 1, -1.5 * 2.25 " << (isProductMatching ? "matching" : "not matching") << " -3.375 as <512, 512>" << std::endl;
+	}
+	catch(const std::exception& exception)
+	{
+		std::cerr << exception.what() << std::endl;
+		file << exception.what() << std::endl;
+	}
+}
+/**
+ * @brief Tests squareRoot, reciprocalSquareRoot, exponential, logarithmBase2, sine, cosine and arcTangent2.
+ */
+void testMathFunctions()
+{
+	try
+	{
+		FixedPointNumber<16, 16> two("2");
+		FixedPointNumber<16, 16> angle("0.5");
+		FixedPointNumber<16, 16> minusOne("-1");
+		std::cout << "Math functions: sqrt(2) = " << two.squareRoot().toString() << ", 1/sqrt(2) = " << two.reciprocalSquareRoot().toString() << ", exp(0.5) = " << angle.exponential().toString()
+			<< ", log2(2) = " << two.logarithmBase2().toString() << ", sin(0.5) = " << angle.sine().toString() << ", cos(0.5) = " << angle.cosine().toString()
+			<< ", atan2(0.5, -1) = " << angle.arcTangent2(minusOne).toString() << std::endl;
+		file << "Math functions: sqrt(2) = " << two.squareRoot().toString() << ", 1/sqrt(2) = " << two.reciprocalSquareRoot().toString() << ", exp(0.5) = " << angle.exponential().toString()
+			<< ", log2(2) = " << two.logarithmBase2().toString() << ", sin(0.5) = " << angle.sine().toString() << ", cos(0.5) = " << angle.cosine().toString()
+			<< ", atan2(0.5, -1) = " << angle.arcTangent2(minusOne).toString() << std::endl;
+		std::cout << "Math functions: sqrt(" << minusOne.toString() << ") throws: ";
+		file << "Math functions: sqrt(" << minusOne.toString() << ") throws: ";
+		FixedPointNumber<16, 16> root = minusOne.squareRoot();
+		std::cout << "nothing, result " << root.toString() << std::endl;
+		file << "nothing, result " << root.toString() << std::endl;
+	}
+	catch(const std::exception& exception)
+	{
+		std::cout << exception.what() << std::endl;
+		file << exception.what() << std::endl;
+	}
+}
 /**
  * @brief Tests the modulo operator of FixedPointNumber.
  */
@@ -320,6 +764,26 @@ void testModuloOperator()
 		file << exception.what() << std::endl;
 	}
 }
+/**
+ * @brief Tests the modulo operator and euclideanRemainder method of FixedPointNumber with a negative dividend.
+ */
+void testNegativeModulo()
+{
+	try
+	{
+		FixedPointNumber<8, 8> number1("-10.5");
+		FixedPointNumber<8, 8> number2("3.0");
+		FixedPointNumber<8, 8> remainder = number1 % number2;
+		FixedPointNumber<8, 8> euclideanRemainder = number1.euclideanRemainder(number2);
+		std::cout << "Negative modulo: " << number1.toString() << " % " << number2.toString() << " = " << remainder.toString() << ", Euclidean remainder = " << euclideanRemainder.toString() << std::endl;
+		file << "Negative modulo: " << number1.toString() << " % " << number2.toString() << " = " << remainder.toString() << ", Euclidean remainder = " << euclideanRemainder.toString() << std::endl;
+	}
+	catch(const std::exception& exception)
+	{
+		std::cerr << exception.what() << std::endl;
+		file << exception.what() << std::endl;
+	}
+}
 /**
  * @brief Tests the bitwise left shift operator of FixedPointNumber.
  */
@@ -589,6 +1053,26 @@ void testGreaterThanOrEqualToOperator()
 		file << exception.what() << std::endl;
 	}
 }
+/**
+ * @brief Tests the three-way comparison of FixedPointNumber at the ends of its range.
+ */
+void testThreeWayComparison()
+{
+	try
+	{
+		FixedPointNumber<8, 0> smallest(-128);
+		FixedPointNumber<8, 0> largest(127);
+		std::strong_ordering ordering = smallest <=> largest;
+		std::string orderingString = ordering < 0 ? "less" : (ordering > 0 ? "greater" : "equal");
+		std::cout << "Three-way comparison: " << smallest.toString() << " <=> " << largest.toString() << " is " << orderingString << ", " << smallest.toString() << " < " << largest.toString() << " is " << (smallest < largest ? "true" : "false") << std::endl;
+		file << "Three-way comparison: " << smallest.toString() << " <=> " << largest.toString() << " is " << orderingString << ", " << smallest.toString() << " < " << largest.toString() << " is " << (smallest < largest ? "true" : "false") << std::endl;
+	}
+	catch(const std::exception& exception)
+	{
+		std::cerr << exception.what() << std::endl;
+		file << exception.what() << std::endl;
+	}
+}
 /**
  * @brief Tests the plus-equals operator of FixedPointNumber.
  */
@@ -924,10 +1408,13 @@ int main()
 	testDefaultConstructor();
 	testPositiveStringConstructor();
 	testNegativeStringConstructor();
+	testFromChars();
 	testIntegerConstructor();
+	testUserDefinedLiterals();
+	testToChars();
 	testMaximum();
 	testMinimum();
-	testGetNumberOfDecimalPlaces();
+	testToStringWithDecimalPlaces();
 	testAbsoluteValue();
 	testUnaryNegationAndZero();
 	testAdditionOperator();
@@ -936,14 +1423,28 @@ int main()
 	testFractionalRounding();
 	testMultiplicationOperator();
 	testNegativeMultiplication();
+	testMultiplyWithRounding();
 	testDivisionOperator();
+	testDivideWithRounding();
+	testDivisionByZero();
+	testIntegerOperands();
+	testOverflowPolicies();
+	testRoundingPolicies();
+	testMixedFormatArithmetic();
+	testFusedMultiplyAdd();
+	testFloatingPointConversion();
+	testWideStorage();
+	testKaratsubaMultiplication();
+	testMathFunctions();
 	testModuloOperator();
+	testNegativeModulo();
 	testEqualityOperator();
 	testInequalityOperator();
 	testLessThanOperator();
 	testLessThanOrEqualToOperator();
 	testGreaterThanOperator();
 	testGreaterThanOrEqualToOperator();
+	testThreeWayComparison();
 	testPlusEqualsOperator();
 	testMinusEqualsOperator();
 	testMultiplicationEqualsOperator();
@@ -0,0 +1,342 @@
+/**
+ * @file FixedPointParallel.hpp
+ * @author Robert Connor Luce
+ * @brief Header file for FixedPointParallel class, parallel bulk algorithms over spans of fixed-point numbers.
+ */
+#include <cstddef>
+#include <algorithm>
+#include <functional>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include "FixedPointNumber.hpp"
+#include "FixedPointSimd.hpp"
+#include "FixedPointThreadPool.hpp"
+#ifndef FIXEDPOINTPARALLEL_HPP
+#define FIXEDPOINTPARALLEL_HPP
+/**
+ * @brief Number of elements per chunk used by the parallel algorithms when no grain size is given.
+ */
+inline constexpr std::size_t fixedPointDefaultGrainSize = std::size_t(1) << 16;
+/**
+ * @brief Class template of parallel transform, reduce, scan, sort and minimum/maximum over spans of fixed-point
+ * numbers, run on a FixedPointThreadPool.
+ * @details The input is cut into chunks of grainSize elements, and every chunk is one task. Chunk boundaries depend
+ * only on the number of elements and the grain size, and partial results are combined in chunk order, so every result
+ * is bit-identical whatever the number of threads, including for operations that are not associative. For the
+ * fixed-point operators, which wrap and are therefore associative, reduce and the scans also match a sequential loop.
+ * @tparam numberOfIntegerBits Number of bits allocated for the integer part.
+ * @tparam numberOfFractionalBits Number of bits allocated for the fractional part.
+ */
+template<int numberOfIntegerBits, int numberOfFractionalBits>
+class FixedPointParallel
+{
+public:
+	using ValueType = FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>;
+private:
+	static std::size_t numberOfChunksFor(std::size_t numberOfValues, std::size_t grainSize);
+	static void checkSizes(std::size_t size1, std::size_t size2);
+public:
+	template<typename UnaryOperation>
+	static void transform(std::span<const ValueType> values, std::span<ValueType> result, UnaryOperation operation, std::size_t grainSize = fixedPointDefaultGrainSize, FixedPointThreadPool &threadPool = fixedPointDefaultThreadPool());
+	template<typename BinaryOperation>
+	static void transform(std::span<const ValueType> values1, std::span<const ValueType> values2, std::span<ValueType> result, BinaryOperation operation, std::size_t grainSize = fixedPointDefaultGrainSize, FixedPointThreadPool &threadPool = fixedPointDefaultThreadPool());
+	template<typename BinaryOperation = std::plus<>>
+	static ValueType reduce(std::span<const ValueType> values, ValueType initialValue = ValueType{}, BinaryOperation operation = BinaryOperation(), std::size_t grainSize = fixedPointDefaultGrainSize, FixedPointThreadPool &threadPool = fixedPointDefaultThreadPool());
+	template<typename BinaryOperation = std::plus<>>
+	static void inclusiveScan(std::span<const ValueType> values, std::span<ValueType> result, BinaryOperation operation = BinaryOperation(), std::size_t grainSize = fixedPointDefaultGrainSize, FixedPointThreadPool &threadPool = fixedPointDefaultThreadPool());
+	template<typename BinaryOperation = std::plus<>>
+	static void exclusiveScan(std::span<const ValueType> values, std::span<ValueType> result, ValueType initialValue = ValueType{}, BinaryOperation operation = BinaryOperation(), std::size_t grainSize = fixedPointDefaultGrainSize, FixedPointThreadPool &threadPool = fixedPointDefaultThreadPool());
+	static void sort(std::span<ValueType> values, std::size_t grainSize = fixedPointDefaultGrainSize, FixedPointThreadPool &threadPool = fixedPointDefaultThreadPool());
+	static std::pair<ValueType, ValueType> minimumAndMaximum(std::span<const ValueType> values, std::size_t grainSize = fixedPointDefaultGrainSize, FixedPointThreadPool &threadPool = fixedPointDefaultThreadPool());
+};
+/**
+ * @brief Get the number of chunks of grainSize elements needed to cover a number of values.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param numberOfValues
+ * @param grainSize Must not be zero.
+ * @return std::size_t
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+std::size_t FixedPointParallel<numberOfIntegerBits, numberOfFractionalBits>::numberOfChunksFor(std::size_t numberOfValues, std::size_t grainSize)
+{
+	if (grainSize == 0)
+	{
+		throw std::invalid_argument("Grain size must be greater than zero.");
+	}
+	return (numberOfValues + grainSize - 1) / grainSize;
+}
+/**
+ * @brief Check that an input and an output of an algorithm have the same number of elements.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param size1
+ * @param size2
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointParallel<numberOfIntegerBits, numberOfFractionalBits>::checkSizes(std::size_t size1, std::size_t size2)
+{
+	if (size1 != size2)
+	{
+		throw std::invalid_argument("Fixed-point spans must have the same number of elements.");
+	}
+}
+/**
+ * @brief Apply a unary operation to every element of a span in parallel.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam UnaryOperation Callable as operation(ValueType) returning ValueType; called concurrently.
+ * @param values
+ * @param result May alias the input.
+ * @param operation
+ * @param grainSize Number of elements per task.
+ * @param threadPool
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <typename UnaryOperation>
+void FixedPointParallel<numberOfIntegerBits, numberOfFractionalBits>::transform(std::span<const ValueType> values, std::span<ValueType> result, UnaryOperation operation, std::size_t grainSize, FixedPointThreadPool &threadPool)
+{
+	checkSizes(values.size(), result.size());
+	threadPool.parallelFor(numberOfChunksFor(values.size(), grainSize), [&](std::size_t chunk)
+	{
+		std::size_t lastIndex = std::min(values.size(), (chunk + 1) * grainSize);
+		for (std::size_t index = chunk * grainSize; index < lastIndex; index++)
+		{
+			result[index] = operation(values[index]);
+		}
+	});
+}
+/**
+ * @brief Apply a binary operation to every pair of elements of two spans in parallel.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam BinaryOperation Callable as operation(ValueType, ValueType) returning ValueType; called concurrently.
+ * @param values1
+ * @param values2
+ * @param result May alias either input.
+ * @param operation
+ * @param grainSize Number of elements per task.
+ * @param threadPool
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <typename BinaryOperation>
+void FixedPointParallel<numberOfIntegerBits, numberOfFractionalBits>::transform(std::span<const ValueType> values1, std::span<const ValueType> values2, std::span<ValueType> result, BinaryOperation operation, std::size_t grainSize, FixedPointThreadPool &threadPool)
+{
+	checkSizes(values1.size(), values2.size());
+	checkSizes(values1.size(), result.size());
+	threadPool.parallelFor(numberOfChunksFor(values1.size(), grainSize), [&](std::size_t chunk)
+	{
+		std::size_t lastIndex = std::min(values1.size(), (chunk + 1) * grainSize);
+		for (std::size_t index = chunk * grainSize; index < lastIndex; index++)
+		{
+			result[index] = operation(values1[index], values2[index]);
+		}
+	});
+}
+/**
+ * @brief Combine all elements of a span with a binary operation in parallel.
+ * @details Each chunk is folded from left to right, then the initial value and the chunk results are folded in chunk
+ * order. With the default std::plus the sum wraps exactly like repeated operator+.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam BinaryOperation Callable as operation(ValueType, ValueType) returning ValueType; called concurrently.
+ * @param values
+ * @param initialValue
+ * @param operation
+ * @param grainSize Number of elements per task.
+ * @param threadPool
+ * @return ValueType
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <typename BinaryOperation>
+typename FixedPointParallel<numberOfIntegerBits, numberOfFractionalBits>::ValueType FixedPointParallel<numberOfIntegerBits, numberOfFractionalBits>::reduce(std::span<const ValueType> values, ValueType initialValue, BinaryOperation operation, std::size_t grainSize, FixedPointThreadPool &threadPool)
+{
+	std::vector<ValueType> chunkResults(numberOfChunksFor(values.size(), grainSize));
+	threadPool.parallelFor(chunkResults.size(), [&](std::size_t chunk)
+	{
+		std::size_t lastIndex = std::min(values.size(), (chunk + 1) * grainSize);
+		ValueType chunkResult = values[chunk * grainSize];
+		for (std::size_t index = chunk * grainSize + 1; index < lastIndex; index++)
+		{
+			chunkResult = operation(chunkResult, values[index]);
+		}
+		chunkResults[chunk] = chunkResult;
+	});
+	ValueType result = initialValue;
+	for (const ValueType &chunkResult : chunkResults)
+	{
+		result = operation(result, chunkResult);
+	}
+	return result;
+}
+/**
+ * @brief Compute the running combination of a span in parallel, where result[i] combines values[0] to values[i].
+ * @details Three passes: every chunk is reduced, the chunk totals are scanned in order, and every chunk is scanned
+ * again starting from the total of the chunks before it.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam BinaryOperation Callable as operation(ValueType, ValueType) returning ValueType; called concurrently.
+ * @param values
+ * @param result May alias the input.
+ * @param operation
+ * @param grainSize Number of elements per task.
+ * @param threadPool
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <typename BinaryOperation>
+void FixedPointParallel<numberOfIntegerBits, numberOfFractionalBits>::inclusiveScan(std::span<const ValueType> values, std::span<ValueType> result, BinaryOperation operation, std::size_t grainSize, FixedPointThreadPool &threadPool)
+{
+	checkSizes(values.size(), result.size());
+	std::size_t numberOfChunks = numberOfChunksFor(values.size(), grainSize);
+	std::vector<ValueType> chunkTotals(numberOfChunks);
+	threadPool.parallelFor(numberOfChunks, [&](std::size_t chunk)
+	{
+		std::size_t lastIndex = std::min(values.size(), (chunk + 1) * grainSize);
+		ValueType chunkTotal = values[chunk * grainSize];
+		for (std::size_t index = chunk * grainSize + 1; index < lastIndex; index++)
+		{
+			chunkTotal = operation(chunkTotal, values[index]);
+		}
+		chunkTotals[chunk] = chunkTotal;
+	});
+	for (std::size_t chunk = 1; chunk < numberOfChunks; chunk++)
+	{
+		chunkTotals[chunk] = operation(chunkTotals[chunk - 1], chunkTotals[chunk]);
+	}
+	threadPool.parallelFor(numberOfChunks, [&](std::size_t chunk)
+	{
+		std::size_t lastIndex = std::min(values.size(), (chunk + 1) * grainSize);
+		std::size_t index = chunk * grainSize;
+		ValueType runningValue = chunk == 0 ? values[index] : operation(chunkTotals[chunk - 1], values[index]);
+		result[index] = runningValue;
+		for (index++; index < lastIndex; index++)
+		{
+			runningValue = operation(runningValue, values[index]);
+			result[index] = runningValue;
+		}
+	});
+}
+/**
+ * @brief Compute the running combination of a span in parallel, where result[i] combines the initial value with
+ * values[0] to values[i - 1].
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam BinaryOperation Callable as operation(ValueType, ValueType) returning ValueType; called concurrently.
+ * @param values
+ * @param result May alias the input.
+ * @param initialValue
+ * @param operation
+ * @param grainSize Number of elements per task.
+ * @param threadPool
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <typename BinaryOperation>
+void FixedPointParallel<numberOfIntegerBits, numberOfFractionalBits>::exclusiveScan(std::span<const ValueType> values, std::span<ValueType> result, ValueType initialValue, BinaryOperation operation, std::size_t grainSize, FixedPointThreadPool &threadPool)
+{
+	checkSizes(values.size(), result.size());
+	std::size_t numberOfChunks = numberOfChunksFor(values.size(), grainSize);
+	std::vector<ValueType> chunkTotals(numberOfChunks);
+	threadPool.parallelFor(numberOfChunks, [&](std::size_t chunk)
+	{
+		std::size_t lastIndex = std::min(values.size(), (chunk + 1) * grainSize);
+		ValueType chunkTotal = values[chunk * grainSize];
+		for (std::size_t index = chunk * grainSize + 1; index < lastIndex; index++)
+		{
+			chunkTotal = operation(chunkTotal, values[index]);
+		}
+		chunkTotals[chunk] = chunkTotal;
+	});
+	ValueType runningTotal = initialValue;
+	for (std::size_t chunk = 0; chunk < numberOfChunks; chunk++)
+	{
+		ValueType chunkTotal = chunkTotals[chunk];
+		chunkTotals[chunk] = runningTotal;
+		runningTotal = operation(runningTotal, chunkTotal);
+	}
+	threadPool.parallelFor(numberOfChunks, [&](std::size_t chunk)
+	{
+		std::size_t lastIndex = std::min(values.size(), (chunk + 1) * grainSize);
+		ValueType runningValue = chunkTotals[chunk];
+		for (std::size_t index = chunk * grainSize; index < lastIndex; index++)
+		{
+			ValueType value = values[index];
+			result[index] = runningValue;
+			runningValue = operation(runningValue, value);
+		}
+	});
+}
+/**
+ * @brief Sort a span in ascending order in parallel.
+ * @details Every chunk is sorted on its own, then neighbouring runs are merged in rounds, each round merging its
+ * pairs of runs in parallel. Equal fixed-point numbers have identical bits, so the result is unique.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param grainSize Number of elements per task.
+ * @param threadPool
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointParallel<numberOfIntegerBits, numberOfFractionalBits>::sort(std::span<ValueType> values, std::size_t grainSize, FixedPointThreadPool &threadPool)
+{
+	std::size_t numberOfChunks = numberOfChunksFor(values.size(), grainSize);
+	threadPool.parallelFor(numberOfChunks, [&](std::size_t chunk)
+	{
+		std::sort(values.begin() + chunk * grainSize, values.begin() + std::min(values.size(), (chunk + 1) * grainSize));
+	});
+	if (numberOfChunks <= 1)
+	{
+		return;
+	}
+	std::vector<ValueType> buffer(values.size());
+	std::span<ValueType> source = values;
+	std::span<ValueType> destination = buffer;
+	for (std::size_t runSize = grainSize; runSize < values.size(); runSize *= 2)
+	{
+		std::size_t numberOfPairs = (values.size() + 2 * runSize - 1) / (2 * runSize);
+		threadPool.parallelFor(numberOfPairs, [&](std::size_t pair)
+		{
+			std::size_t firstIndex = pair * 2 * runSize;
+			std::size_t middleIndex = std::min(values.size(), firstIndex + runSize);
+			std::size_t lastIndex = std::min(values.size(), firstIndex + 2 * runSize);
+			std::merge(source.begin() + firstIndex, source.begin() + middleIndex, source.begin() + middleIndex, source.begin() + lastIndex, destination.begin() + firstIndex);
+		});
+		std::swap(source, destination);
+	}
+	if (source.data() != values.data())
+	{
+		std::copy(source.begin(), source.end(), values.begin());
+	}
+}
+/**
+ * @brief Find the smallest and largest elements of a span in parallel, using the FixedPointSimd kernels per chunk.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values Must not be empty.
+ * @param grainSize Number of elements per task.
+ * @param threadPool
+ * @return std::pair<ValueType, ValueType> The minimum followed by the maximum.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+std::pair<typename FixedPointParallel<numberOfIntegerBits, numberOfFractionalBits>::ValueType, typename FixedPointParallel<numberOfIntegerBits, numberOfFractionalBits>::ValueType> FixedPointParallel<numberOfIntegerBits, numberOfFractionalBits>::minimumAndMaximum(std::span<const ValueType> values, std::size_t grainSize, FixedPointThreadPool &threadPool)
+{
+	if (values.empty())
+	{
+		throw std::runtime_error("Cannot determine minimum and maximum of an empty array.");
+	}
+	std::vector<std::pair<ValueType, ValueType>> chunkResults(numberOfChunksFor(values.size(), grainSize));
+	threadPool.parallelFor(chunkResults.size(), [&](std::size_t chunk)
+	{
+		std::size_t firstIndex = chunk * grainSize;
+		FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::minimumAndMaximum(values.subspan(firstIndex, std::min(grainSize, values.size() - firstIndex)), chunkResults[chunk].first, chunkResults[chunk].second);
+	});
+	std::pair<ValueType, ValueType> result = chunkResults[0];
+	for (const std::pair<ValueType, ValueType> &chunkResult : chunkResults)
+	{
+		result.first = std::min(result.first, chunkResult.first);
+		result.second = std::max(result.second, chunkResult.second);
+	}
+	return result;
+}
+#endif
@@ -0,0 +1,3900 @@
+/**
+ * @file FixedPointSimd.hpp
+ * @author Robert Connor Luce
+ * @brief Header file for FixedPointSimd class, vectorized element-wise kernels and reductions for spans of fixed-point numbers.
+ */
+#include <cstdint>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <limits>
+#include "FixedPointNumber.hpp"
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define FIXEDPOINT_X86_KERNELS 1
+#else
+#define FIXEDPOINT_X86_KERNELS 0
+#endif
+#ifndef FIXEDPOINTSIMD_HPP
+#define FIXEDPOINTSIMD_HPP
+/**
+ * @brief Instruction sets the element-wise kernels can be compiled for, from least to most capable.
+ */
+enum class FixedPointInstructionSet
+{
+	Scalar,	///< Portable scalar reference loop.
+	Sse41,	///< 128-bit SSE4.1 kernels.
+	Avx2,	///< 256-bit AVX2 kernels.
+	Avx512	///< 512-bit AVX-512F and AVX-512BW kernels.
+};
+/**
+ * @brief Detect the most capable instruction set supported by the processor, once per program.
+ * @return FixedPointInstructionSet
+ */
+inline FixedPointInstructionSet fixedPointDetectInstructionSet()
+{
+#if FIXEDPOINT_X86_KERNELS
+	static const FixedPointInstructionSet detectedInstructionSet = []()
+	{
+		__builtin_cpu_init();
+		if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+		{
+			return FixedPointInstructionSet::Avx512;
+		}
+		if (__builtin_cpu_supports("avx2"))
+		{
+			return FixedPointInstructionSet::Avx2;
+		}
+		if (__builtin_cpu_supports("sse4.1"))
+		{
+			return FixedPointInstructionSet::Sse41;
+		}
+		return FixedPointInstructionSet::Scalar;
+	}();
+	return detectedInstructionSet;
+#else
+	return FixedPointInstructionSet::Scalar;
+#endif
+}
+/**
+ * @brief Class template of element-wise kernels over spans of fixed-point numbers, dispatched at run time.
+ * @details Formats stored in 16-bit or 32-bit integers get vector kernels; every other format, and the elements left
+ * over after the last full vector, use the scalar reference loop. Every kernel is bit-exact with the scalar reference:
+ * add, subtract and multiply match operator+, operator- and operator*, multiply and shiftRight round like the scalar
+ * multiply and shiftRight with the same FixedPointRounding, and the saturated variants clamp the exact result to the
+ * range of the format. quantize and dequantize convert between floats and fixed point with a per-tensor scale, rounding
+ * like fromDouble and toDouble. Stochastic rounding draws random bits per element and always runs the scalar loop. The
+ * result span may alias an input. The reductions minimumAndMaximum and indexOf compare raw values, which order exactly
+ * like the numbers they represent, and dot and sum accumulate exactly in AccumulatorType. sine, cosine, exponential,
+ * logarithmBase2 and arcTangent2 run the CORDIC iterations of the scalar functions in 64-bit lanes with AVX2 and
+ * AVX-512, for formats with at least two fractional bits.
+ * @tparam numberOfIntegerBits Number of bits allocated for the integer part.
+ * @tparam numberOfFractionalBits Number of bits allocated for the fractional part.
+ */
+template<int numberOfIntegerBits, int numberOfFractionalBits>
+class FixedPointSimd
+{
+public:
+	using ValueType = FixedPointNumber<numberOfIntegerBits, numberOfFractionalBits>;
+	using StorageType = typename ValueType::StorageType;
+	using AccumulatorType = typename ValueType::AccumulatorType;
+private:
+	using WideStorageType = typename ValueType::WideStorageType;
+	static constexpr int numberOfBits = numberOfIntegerBits + numberOfFractionalBits;
+	static constexpr int numberOfStorageBits = static_cast<int>(8 * sizeof(StorageType));
+	static constexpr bool hasVectorKernels = (numberOfStorageBits == 16 && numberOfFractionalBits >= 0 && numberOfFractionalBits <= 16) || (numberOfStorageBits == 32 && numberOfFractionalBits >= 0 && numberOfFractionalBits <= 32);
+	static constexpr bool hasVectorMathKernels = hasVectorKernels && numberOfFractionalBits >= 2;
+	static constexpr WideStorageType largestRawValue = static_cast<WideStorageType>((static_cast<WideStorageType>(1) << (numberOfBits - 1)) - static_cast<WideStorageType>(1));
+	static constexpr WideStorageType smallestRawValue = static_cast<WideStorageType>(-largestRawValue - static_cast<WideStorageType>(1));
+	static constexpr std::size_t accumulationBlockSize = std::size_t(1) << 24;
+	static const StorageType* rawValues(std::span<const ValueType> values);
+	static StorageType* rawValues(std::span<ValueType> values);
+	static void checkSizes(std::size_t size1, std::size_t size2, std::size_t size3);
+	static FixedPointInstructionSet selectInstructionSet(FixedPointInstructionSet instructionSet);
+	static StorageType saturate(WideStorageType value);
+	static void addScalar(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t firstIndex, std::size_t numberOfValues);
+	static void subtractScalar(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t firstIndex, std::size_t numberOfValues);
+	template<FixedPointRounding rounding>
+	static void multiplyScalar(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t firstIndex, std::size_t numberOfValues);
+	template<FixedPointRounding rounding>
+	static void shiftRightScalar(const StorageType* values, int amountToShift, StorageType* result, std::size_t firstIndex, std::size_t numberOfValues);
+	template<FixedPointRounding rounding>
+	static void quantizeScalar(const float* values, double inverseScale, StorageType* result, std::size_t firstIndex, std::size_t numberOfValues);
+	static void dequantizeScalar(const StorageType* values, double scale, float* result, std::size_t firstIndex, std::size_t numberOfValues);
+	static void addSaturatedScalar(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t firstIndex, std::size_t numberOfValues);
+	static void subtractSaturatedScalar(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t firstIndex, std::size_t numberOfValues);
+	static void minimumAndMaximumScalar(const StorageType* values, std::size_t firstIndex, std::size_t numberOfValues, StorageType &minimum, StorageType &maximum);
+	static std::size_t indexOfScalar(const StorageType* values, std::size_t firstIndex, std::size_t numberOfValues, StorageType value);
+	static void dotScalar(const StorageType* values1, const StorageType* values2, std::size_t firstIndex, std::size_t numberOfValues, AccumulatorType &accumulator);
+	static void sumScalar(const StorageType* values, std::size_t firstIndex, std::size_t numberOfValues, AccumulatorType &accumulator);
+	static void sineScalar(const StorageType* values, StorageType* result, std::size_t firstIndex, std::size_t numberOfValues);
+	static void cosineScalar(const StorageType* values, StorageType* result, std::size_t firstIndex, std::size_t numberOfValues);
+	static void exponentialScalar(const StorageType* values, StorageType* result, std::size_t firstIndex, std::size_t numberOfValues);
+	static void logarithmBase2Scalar(const StorageType* values, StorageType* result, std::size_t firstIndex, std::size_t numberOfValues);
+	static void arcTangent2Scalar(const StorageType* ordinates, const StorageType* abscissas, StorageType* result, std::size_t firstIndex, std::size_t numberOfValues);
+#if FIXEDPOINT_X86_KERNELS
+	static std::size_t addSse41(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t numberOfValues);
+	static std::size_t subtractSse41(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t numberOfValues);
+	static std::size_t addSaturatedSse41(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t numberOfValues);
+	static std::size_t subtractSaturatedSse41(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t numberOfValues);
+	template<FixedPointRounding rounding>
+	static __m128i productRoundingBiasSse41(__m128i products);
+	template<FixedPointRounding rounding>
+	static std::size_t multiplySse41(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t numberOfValues);
+	template<FixedPointRounding rounding>
+	static std::size_t shiftRightSse41(const StorageType* values, int amountToShift, StorageType* result, std::size_t numberOfValues);
+	static std::size_t addAvx2(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t numberOfValues);
+	static std::size_t subtractAvx2(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t numberOfValues);
+	static std::size_t addSaturatedAvx2(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t numberOfValues);
+	static std::size_t subtractSaturatedAvx2(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t numberOfValues);
+	template<FixedPointRounding rounding>
+	static __m256i productRoundingBiasAvx2(__m256i products);
+	template<FixedPointRounding rounding>
+	static std::size_t multiplyAvx2(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t numberOfValues);
+	template<FixedPointRounding rounding>
+	static std::size_t shiftRightAvx2(const StorageType* values, int amountToShift, StorageType* result, std::size_t numberOfValues);
+	static std::size_t addAvx512(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t numberOfValues);
+	static std::size_t subtractAvx512(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t numberOfValues);
+	static std::size_t addSaturatedAvx512(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t numberOfValues);
+	static std::size_t subtractSaturatedAvx512(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t numberOfValues);
+	template<FixedPointRounding rounding>
+	static __m512i productRoundingBiasAvx512(__m512i products);
+	template<FixedPointRounding rounding>
+	static std::size_t multiplyAvx512(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t numberOfValues);
+	template<FixedPointRounding rounding>
+	static std::size_t shiftRightAvx512(const StorageType* values, int amountToShift, StorageType* result, std::size_t numberOfValues);
+	template<FixedPointRounding rounding>
+	static __m128i roundToRawSse41(__m128d scaledValues);
+	template<FixedPointRounding rounding>
+	static std::size_t quantizeSse41(const float* values, double scaleFactor, StorageType* result, std::size_t numberOfValues);
+	static std::size_t dequantizeSse41(const StorageType* values, double scaleFactor, float* result, std::size_t numberOfValues);
+	template<FixedPointRounding rounding>
+	static __m128i roundToRawAvx2(__m256d scaledValues);
+	template<FixedPointRounding rounding>
+	static std::size_t quantizeAvx2(const float* values, double scaleFactor, StorageType* result, std::size_t numberOfValues);
+	static std::size_t dequantizeAvx2(const StorageType* values, double scaleFactor, float* result, std::size_t numberOfValues);
+	template<FixedPointRounding rounding>
+	static __m256i roundToRawAvx512(__m512d scaledValues);
+	template<FixedPointRounding rounding>
+	static std::size_t quantizeAvx512(const float* values, double scaleFactor, StorageType* result, std::size_t numberOfValues);
+	static std::size_t dequantizeAvx512(const StorageType* values, double scaleFactor, float* result, std::size_t numberOfValues);
+	static std::size_t minimumAndMaximumSse41(const StorageType* values, std::size_t numberOfValues, StorageType &minimum, StorageType &maximum);
+	static std::size_t indexOfSse41(const StorageType* values, std::size_t numberOfValues, StorageType value);
+	static std::size_t minimumAndMaximumAvx2(const StorageType* values, std::size_t numberOfValues, StorageType &minimum, StorageType &maximum);
+	static std::size_t indexOfAvx2(const StorageType* values, std::size_t numberOfValues, StorageType value);
+	static std::size_t minimumAndMaximumAvx512(const StorageType* values, std::size_t numberOfValues, StorageType &minimum, StorageType &maximum);
+	static std::size_t indexOfAvx512(const StorageType* values, std::size_t numberOfValues, StorageType value);
+	static std::size_t dotSse41(const StorageType* values1, const StorageType* values2, std::size_t numberOfValues, AccumulatorType &accumulator);
+	static std::size_t sumSse41(const StorageType* values, std::size_t numberOfValues, AccumulatorType &accumulator);
+	static std::size_t dotAvx2(const StorageType* values1, const StorageType* values2, std::size_t numberOfValues, AccumulatorType &accumulator);
+	static std::size_t sumAvx2(const StorageType* values, std::size_t numberOfValues, AccumulatorType &accumulator);
+	static std::size_t dotAvx512(const StorageType* values1, const StorageType* values2, std::size_t numberOfValues, AccumulatorType &accumulator);
+	static std::size_t sumAvx512(const StorageType* values, std::size_t numberOfValues, AccumulatorType &accumulator);
+	static __m256i loadWidenedAvx2(const StorageType* values);
+	static void storeNarrowedAvx2(__m256i values, StorageType* result);
+	static __m256i shiftRightArithmeticAvx2(__m256i values, __m256i amountsToShift);
+	static __m256i negateWhereAvx2(__m256i values, __m256i mask);
+	static void multiplyByConstantAvx2(__m256i values, int64_t constant, __m256i &high, __m256i &low);
+	static __m256i bitLengthAvx2(__m256i values);
+	static __m256i saturateAvx2(__m256i values);
+	static __m256i roundAndSaturateAvx2(__m256i values, __m256i amountsToShift);
+	template<bool isCosine>
+	static std::size_t sineOrCosineAvx2(const StorageType* values, StorageType* result, std::size_t numberOfValues);
+	static std::size_t exponentialAvx2(const StorageType* values, StorageType* result, std::size_t numberOfValues);
+	static std::size_t logarithmBase2Avx2(const StorageType* values, StorageType* result, std::size_t numberOfValues);
+	static std::size_t arcTangent2Avx2(const StorageType* ordinates, const StorageType* abscissas, StorageType* result, std::size_t numberOfValues);
+	static __m512i loadWidenedAvx512(const StorageType* values);
+	static void storeNarrowedAvx512(__m512i values, StorageType* result);
+	static __m512i negateWhereAvx512(__m512i values, __m512i mask);
+	static void multiplyByConstantAvx512(__m512i values, int64_t constant, __m512i &high, __m512i &low);
+	static __m512i bitLengthAvx512(__m512i values);
+	static __m512i saturateAvx512(__m512i values);
+	static __m512i roundAndSaturateAvx512(__m512i values, __m512i amountsToShift);
+	template<bool isCosine>
+	static std::size_t sineOrCosineAvx512(const StorageType* values, StorageType* result, std::size_t numberOfValues);
+	static std::size_t exponentialAvx512(const StorageType* values, StorageType* result, std::size_t numberOfValues);
+	static std::size_t logarithmBase2Avx512(const StorageType* values, StorageType* result, std::size_t numberOfValues);
+	static std::size_t arcTangent2Avx512(const StorageType* ordinates, const StorageType* abscissas, StorageType* result, std::size_t numberOfValues);
+#endif
+public:
+	static void add(std::span<const ValueType> values1, std::span<const ValueType> values2, std::span<ValueType> result, FixedPointInstructionSet instructionSet = fixedPointDetectInstructionSet());
+	static void subtract(std::span<const ValueType> values1, std::span<const ValueType> values2, std::span<ValueType> result, FixedPointInstructionSet instructionSet = fixedPointDetectInstructionSet());
+	template<FixedPointRounding rounding = FixedPointRounding::RoundHalfUp>
+	static void multiply(std::span<const ValueType> values1, std::span<const ValueType> values2, std::span<ValueType> result, FixedPointInstructionSet instructionSet = fixedPointDetectInstructionSet());
+	template<FixedPointRounding rounding = FixedPointRounding::RoundHalfUp>
+	static void shiftRight(std::span<const ValueType> values, int amountToShift, std::span<ValueType> result, FixedPointInstructionSet instructionSet = fixedPointDetectInstructionSet());
+	template<FixedPointRounding rounding = FixedPointRounding::RoundHalfUp>
+	static void quantize(std::span<const float> values, double scale, std::span<ValueType> result, FixedPointInstructionSet instructionSet = fixedPointDetectInstructionSet());
+	static void dequantize(std::span<const ValueType> values, double scale, std::span<float> result, FixedPointInstructionSet instructionSet = fixedPointDetectInstructionSet());
+	static void addSaturated(std::span<const ValueType> values1, std::span<const ValueType> values2, std::span<ValueType> result, FixedPointInstructionSet instructionSet = fixedPointDetectInstructionSet());
+	static void subtractSaturated(std::span<const ValueType> values1, std::span<const ValueType> values2, std::span<ValueType> result, FixedPointInstructionSet instructionSet = fixedPointDetectInstructionSet());
+	static void minimumAndMaximum(std::span<const ValueType> values, ValueType &minimum, ValueType &maximum, FixedPointInstructionSet instructionSet = fixedPointDetectInstructionSet());
+	static std::size_t indexOf(std::span<const ValueType> values, const ValueType &value, FixedPointInstructionSet instructionSet = fixedPointDetectInstructionSet());
+	static AccumulatorType dot(std::span<const ValueType> values1, std::span<const ValueType> values2, FixedPointInstructionSet instructionSet = fixedPointDetectInstructionSet());
+	static AccumulatorType sum(std::span<const ValueType> values, FixedPointInstructionSet instructionSet = fixedPointDetectInstructionSet());
+	static void sine(std::span<const ValueType> values, std::span<ValueType> result, FixedPointInstructionSet instructionSet = fixedPointDetectInstructionSet());
+	static void cosine(std::span<const ValueType> values, std::span<ValueType> result, FixedPointInstructionSet instructionSet = fixedPointDetectInstructionSet());
+	static void exponential(std::span<const ValueType> values, std::span<ValueType> result, FixedPointInstructionSet instructionSet = fixedPointDetectInstructionSet());
+	static void logarithmBase2(std::span<const ValueType> values, std::span<ValueType> result, FixedPointInstructionSet instructionSet = fixedPointDetectInstructionSet());
+	static void arcTangent2(std::span<const ValueType> ordinates, std::span<const ValueType> abscissas, std::span<ValueType> result, FixedPointInstructionSet instructionSet = fixedPointDetectInstructionSet());
+};
+/**
+ * @brief View a span of fixed-point numbers as their raw values.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @return const StorageType*
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+const typename FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::StorageType* FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::rawValues(std::span<const ValueType> values)
+{
+	static_assert(sizeof(ValueType) == sizeof(StorageType) && std::is_standard_layout_v<ValueType>, "FixedPointNumber must be layout-compatible with its storage.");
+	return reinterpret_cast<const StorageType*>(values.data());
+}
+/**
+ * @brief View a span of fixed-point numbers as their raw values.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @return StorageType*
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+typename FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::StorageType* FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::rawValues(std::span<ValueType> values)
+{
+	static_assert(sizeof(ValueType) == sizeof(StorageType) && std::is_standard_layout_v<ValueType>, "FixedPointNumber must be layout-compatible with its storage.");
+	return reinterpret_cast<StorageType*>(values.data());
+}
+/**
+ * @brief Check that the operands and result of a kernel have the same number of elements.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param size1
+ * @param size2
+ * @param size3
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::checkSizes(std::size_t size1, std::size_t size2, std::size_t size3)
+{
+	if (size1 != size2 || size1 != size3)
+	{
+		throw std::invalid_argument("Fixed-point spans must have the same number of elements.");
+	}
+}
+/**
+ * @brief Limit a requested instruction set to what the processor and the format support.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param instructionSet
+ * @return FixedPointInstructionSet
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+FixedPointInstructionSet FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::selectInstructionSet(FixedPointInstructionSet instructionSet)
+{
+	if constexpr (!hasVectorKernels)
+	{
+		return FixedPointInstructionSet::Scalar;
+	}
+	FixedPointInstructionSet detectedInstructionSet = fixedPointDetectInstructionSet();
+	return instructionSet < detectedInstructionSet ? instructionSet : detectedInstructionSet;
+}
+/**
+ * @brief Clamp an exact intermediate value to the range of the format.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param value
+ * @return StorageType
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+typename FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::StorageType FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::saturate(WideStorageType value)
+{
+	if (value > largestRawValue)
+	{
+		return static_cast<StorageType>(largestRawValue);
+	}
+	if (value < smallestRawValue)
+	{
+		return static_cast<StorageType>(smallestRawValue);
+	}
+	return static_cast<StorageType>(value);
+}
+/**
+ * @brief Scalar reference for add, applied from firstIndex to the end.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values1
+ * @param values2
+ * @param result
+ * @param firstIndex
+ * @param numberOfValues
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::addScalar(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t firstIndex, std::size_t numberOfValues)
+{
+	for (std::size_t index = firstIndex; index < numberOfValues; index++)
+	{
+		result[index] = (ValueType::fromRawValue(values1[index]) + ValueType::fromRawValue(values2[index])).getRawValue();
+	}
+}
+/**
+ * @brief Scalar reference for subtract, applied from firstIndex to the end.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values1
+ * @param values2
+ * @param result
+ * @param firstIndex
+ * @param numberOfValues
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::subtractScalar(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t firstIndex, std::size_t numberOfValues)
+{
+	for (std::size_t index = firstIndex; index < numberOfValues; index++)
+	{
+		result[index] = (ValueType::fromRawValue(values1[index]) - ValueType::fromRawValue(values2[index])).getRawValue();
+	}
+}
+/**
+ * @brief Scalar reference for multiply, applied from firstIndex to the end.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam rounding
+ * @param values1
+ * @param values2
+ * @param result
+ * @param firstIndex
+ * @param numberOfValues
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <FixedPointRounding rounding>
+void FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::multiplyScalar(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t firstIndex, std::size_t numberOfValues)
+{
+	for (std::size_t index = firstIndex; index < numberOfValues; index++)
+	{
+		result[index] = ValueType::fromRawValue(values1[index]).template multiply<rounding>(ValueType::fromRawValue(values2[index])).getRawValue();
+	}
+}
+/**
+ * @brief Scalar reference for shiftRight, applied from firstIndex to the end.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam rounding
+ * @param values
+ * @param amountToShift
+ * @param result
+ * @param firstIndex
+ * @param numberOfValues
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <FixedPointRounding rounding>
+void FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::shiftRightScalar(const StorageType* values, int amountToShift, StorageType* result, std::size_t firstIndex, std::size_t numberOfValues)
+{
+	for (std::size_t index = firstIndex; index < numberOfValues; index++)
+	{
+		result[index] = ValueType::fromRawValue(values[index]).template shiftRight<rounding>(amountToShift).getRawValue();
+	}
+}
+/**
+ * @brief Scalar reference for quantize, applied from firstIndex to the end.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam rounding
+ * @param values
+ * @param inverseScale Reciprocal of the quantization scale.
+ * @param result
+ * @param firstIndex
+ * @param numberOfValues
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <FixedPointRounding rounding>
+void FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::quantizeScalar(const float* values, double inverseScale, StorageType* result, std::size_t firstIndex, std::size_t numberOfValues)
+{
+	for (std::size_t index = firstIndex; index < numberOfValues; index++)
+	{
+		result[index] = ValueType::template fromDouble<rounding>(static_cast<double>(values[index]) * inverseScale).getRawValue();
+	}
+}
+/**
+ * @brief Scalar reference for dequantize, applied from firstIndex to the end.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param scale
+ * @param result
+ * @param firstIndex
+ * @param numberOfValues
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::dequantizeScalar(const StorageType* values, double scale, float* result, std::size_t firstIndex, std::size_t numberOfValues)
+{
+	for (std::size_t index = firstIndex; index < numberOfValues; index++)
+	{
+		result[index] = static_cast<float>(ValueType::fromRawValue(values[index]).toDouble() * scale);
+	}
+}
+/**
+ * @brief Scalar reference for addSaturated, applied from firstIndex to the end.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values1
+ * @param values2
+ * @param result
+ * @param firstIndex
+ * @param numberOfValues
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::addSaturatedScalar(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t firstIndex, std::size_t numberOfValues)
+{
+	for (std::size_t index = firstIndex; index < numberOfValues; index++)
+	{
+		result[index] = saturate(static_cast<WideStorageType>(values1[index]) + static_cast<WideStorageType>(values2[index]));
+	}
+}
+/**
+ * @brief Scalar reference for subtractSaturated, applied from firstIndex to the end.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values1
+ * @param values2
+ * @param result
+ * @param firstIndex
+ * @param numberOfValues
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::subtractSaturatedScalar(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t firstIndex, std::size_t numberOfValues)
+{
+	for (std::size_t index = firstIndex; index < numberOfValues; index++)
+	{
+		result[index] = saturate(static_cast<WideStorageType>(values1[index]) - static_cast<WideStorageType>(values2[index]));
+	}
+}
+/**
+ * @brief Scalar reference for minimumAndMaximum, folding the elements from firstIndex to the end into minimum and maximum.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param firstIndex
+ * @param numberOfValues
+ * @param minimum Running minimum, updated in place.
+ * @param maximum Running maximum, updated in place.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::minimumAndMaximumScalar(const StorageType* values, std::size_t firstIndex, std::size_t numberOfValues, StorageType &minimum, StorageType &maximum)
+{
+	for (std::size_t index = firstIndex; index < numberOfValues; index++)
+	{
+		if (values[index] < minimum)
+		{
+			minimum = values[index];
+		}
+		if (values[index] > maximum)
+		{
+			maximum = values[index];
+		}
+	}
+}
+/**
+ * @brief Scalar reference for indexOf, searching from firstIndex to the end.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param firstIndex
+ * @param numberOfValues
+ * @param value
+ * @return std::size_t Index of the first match, or numberOfValues if there is none.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::indexOfScalar(const StorageType* values, std::size_t firstIndex, std::size_t numberOfValues, StorageType value)
+{
+	for (std::size_t index = firstIndex; index < numberOfValues; index++)
+	{
+		if (values[index] == value)
+		{
+			return index;
+		}
+	}
+	return numberOfValues;
+}
+/**
+ * @brief Scalar reference for dot, accumulating the exact products from firstIndex to the end.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values1
+ * @param values2
+ * @param firstIndex
+ * @param numberOfValues
+ * @param accumulator Exact sum of products with 2 * numberOfFractionalBits fractional bits, updated in place.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::dotScalar(const StorageType* values1, const StorageType* values2, std::size_t firstIndex, std::size_t numberOfValues, AccumulatorType &accumulator)
+{
+	for (std::size_t index = firstIndex; index < numberOfValues; index++)
+	{
+		accumulator = static_cast<AccumulatorType>(accumulator + static_cast<AccumulatorType>(values1[index]) * static_cast<AccumulatorType>(values2[index]));
+	}
+}
+/**
+ * @brief Scalar reference for sum, accumulating the elements from firstIndex to the end.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param firstIndex
+ * @param numberOfValues
+ * @param accumulator Exact sum with numberOfFractionalBits fractional bits, updated in place.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::sumScalar(const StorageType* values, std::size_t firstIndex, std::size_t numberOfValues, AccumulatorType &accumulator)
+{
+	for (std::size_t index = firstIndex; index < numberOfValues; index++)
+	{
+		accumulator = static_cast<AccumulatorType>(accumulator + static_cast<AccumulatorType>(values[index]));
+	}
+}
+/**
+ * @brief Scalar reference for sine, applied from firstIndex to the end.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param result
+ * @param firstIndex
+ * @param numberOfValues
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::sineScalar(const StorageType* values, StorageType* result, std::size_t firstIndex, std::size_t numberOfValues)
+{
+	for (std::size_t index = firstIndex; index < numberOfValues; index++)
+	{
+		result[index] = ValueType::fromRawValue(values[index]).sine().getRawValue();
+	}
+}
+/**
+ * @brief Scalar reference for cosine, applied from firstIndex to the end.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param result
+ * @param firstIndex
+ * @param numberOfValues
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::cosineScalar(const StorageType* values, StorageType* result, std::size_t firstIndex, std::size_t numberOfValues)
+{
+	for (std::size_t index = firstIndex; index < numberOfValues; index++)
+	{
+		result[index] = ValueType::fromRawValue(values[index]).cosine().getRawValue();
+	}
+}
+/**
+ * @brief Scalar reference for exponential, applied from firstIndex to the end.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param result
+ * @param firstIndex
+ * @param numberOfValues
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::exponentialScalar(const StorageType* values, StorageType* result, std::size_t firstIndex, std::size_t numberOfValues)
+{
+	for (std::size_t index = firstIndex; index < numberOfValues; index++)
+	{
+		result[index] = ValueType::fromRawValue(values[index]).exponential().getRawValue();
+	}
+}
+/**
+ * @brief Scalar reference for logarithmBase2, applied from firstIndex to the end.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param result
+ * @param firstIndex
+ * @param numberOfValues
+ * @throws std::domain_error If a value is not positive.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::logarithmBase2Scalar(const StorageType* values, StorageType* result, std::size_t firstIndex, std::size_t numberOfValues)
+{
+	for (std::size_t index = firstIndex; index < numberOfValues; index++)
+	{
+		result[index] = ValueType::fromRawValue(values[index]).logarithmBase2().getRawValue();
+	}
+}
+/**
+ * @brief Scalar reference for arcTangent2, applied from firstIndex to the end.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param ordinates
+ * @param abscissas
+ * @param result
+ * @param firstIndex
+ * @param numberOfValues
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::arcTangent2Scalar(const StorageType* ordinates, const StorageType* abscissas, StorageType* result, std::size_t firstIndex, std::size_t numberOfValues)
+{
+	for (std::size_t index = firstIndex; index < numberOfValues; index++)
+	{
+		result[index] = ValueType::fromRawValue(ordinates[index]).arcTangent2(ValueType::fromRawValue(abscissas[index])).getRawValue();
+	}
+}
+#if FIXEDPOINT_X86_KERNELS
+/**
+ * @brief Add raw values 16 bytes at a time with SSE4.1, wrapping like the scalar operator.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values1
+ * @param values2
+ * @param result
+ * @param numberOfValues
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("sse4.1"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::addSse41(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t numberOfValues)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m128i) / sizeof(StorageType);
+	std::size_t index = 0;
+	for (; index + numberOfLanes <= numberOfValues; index += numberOfLanes)
+	{
+		__m128i vector1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values1 + index));
+		__m128i vector2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values2 + index));
+		__m128i vectorResult;
+		if constexpr (numberOfStorageBits == 16)
+		{
+			vectorResult = _mm_add_epi16(vector1, vector2);
+			if constexpr (numberOfBits < numberOfStorageBits)
+			{
+				vectorResult = _mm_srai_epi16(_mm_slli_epi16(vectorResult, numberOfStorageBits - numberOfBits), numberOfStorageBits - numberOfBits);
+			}
+		}
+		else
+		{
+			vectorResult = _mm_add_epi32(vector1, vector2);
+			if constexpr (numberOfBits < numberOfStorageBits)
+			{
+				vectorResult = _mm_srai_epi32(_mm_slli_epi32(vectorResult, numberOfStorageBits - numberOfBits), numberOfStorageBits - numberOfBits);
+			}
+		}
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(result + index), vectorResult);
+	}
+	return index;
+}
+/**
+ * @brief Subtract raw values 16 bytes at a time with SSE4.1, wrapping like the scalar operator.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values1
+ * @param values2
+ * @param result
+ * @param numberOfValues
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("sse4.1"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::subtractSse41(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t numberOfValues)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m128i) / sizeof(StorageType);
+	std::size_t index = 0;
+	for (; index + numberOfLanes <= numberOfValues; index += numberOfLanes)
+	{
+		__m128i vector1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values1 + index));
+		__m128i vector2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values2 + index));
+		__m128i vectorResult;
+		if constexpr (numberOfStorageBits == 16)
+		{
+			vectorResult = _mm_sub_epi16(vector1, vector2);
+			if constexpr (numberOfBits < numberOfStorageBits)
+			{
+				vectorResult = _mm_srai_epi16(_mm_slli_epi16(vectorResult, numberOfStorageBits - numberOfBits), numberOfStorageBits - numberOfBits);
+			}
+		}
+		else
+		{
+			vectorResult = _mm_sub_epi32(vector1, vector2);
+			if constexpr (numberOfBits < numberOfStorageBits)
+			{
+				vectorResult = _mm_srai_epi32(_mm_slli_epi32(vectorResult, numberOfStorageBits - numberOfBits), numberOfStorageBits - numberOfBits);
+			}
+		}
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(result + index), vectorResult);
+	}
+	return index;
+}
+/**
+ * @brief Add raw values 16 bytes at a time with SSE4.1, clamping to the range of the format.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values1
+ * @param values2
+ * @param result
+ * @param numberOfValues
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("sse4.1"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::addSaturatedSse41(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t numberOfValues)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m128i) / sizeof(StorageType);
+	std::size_t index = 0;
+	for (; index + numberOfLanes <= numberOfValues; index += numberOfLanes)
+	{
+		__m128i vector1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values1 + index));
+		__m128i vector2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values2 + index));
+		__m128i vectorResult;
+		if constexpr (numberOfStorageBits == 16 && numberOfBits == 16)
+		{
+			vectorResult = _mm_adds_epi16(vector1, vector2);
+		}
+		else if constexpr (numberOfStorageBits == 16)
+		{
+			vectorResult = _mm_add_epi16(vector1, vector2);
+			vectorResult = _mm_max_epi16(_mm_min_epi16(vectorResult, _mm_set1_epi16(static_cast<short>(largestRawValue))), _mm_set1_epi16(static_cast<short>(smallestRawValue)));
+		}
+		else if constexpr (numberOfBits == 32)
+		{
+			vectorResult = _mm_add_epi32(vector1, vector2);
+			__m128i isOverflow = _mm_srai_epi32(_mm_and_si128(_mm_xor_si128(vector1, vectorResult), _mm_xor_si128(vector2, vectorResult)), 31);
+			__m128i saturatedValue = _mm_xor_si128(_mm_srai_epi32(vector1, 31), _mm_set1_epi32(INT32_MAX));
+			vectorResult = _mm_or_si128(_mm_andnot_si128(isOverflow, vectorResult), _mm_and_si128(isOverflow, saturatedValue));
+		}
+		else
+		{
+			vectorResult = _mm_add_epi32(vector1, vector2);
+			vectorResult = _mm_max_epi32(_mm_min_epi32(vectorResult, _mm_set1_epi32(static_cast<int>(largestRawValue))), _mm_set1_epi32(static_cast<int>(smallestRawValue)));
+		}
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(result + index), vectorResult);
+	}
+	return index;
+}
+/**
+ * @brief Subtract raw values 16 bytes at a time with SSE4.1, clamping to the range of the format.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values1
+ * @param values2
+ * @param result
+ * @param numberOfValues
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("sse4.1"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::subtractSaturatedSse41(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t numberOfValues)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m128i) / sizeof(StorageType);
+	std::size_t index = 0;
+	for (; index + numberOfLanes <= numberOfValues; index += numberOfLanes)
+	{
+		__m128i vector1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values1 + index));
+		__m128i vector2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values2 + index));
+		__m128i vectorResult;
+		if constexpr (numberOfStorageBits == 16 && numberOfBits == 16)
+		{
+			vectorResult = _mm_subs_epi16(vector1, vector2);
+		}
+		else if constexpr (numberOfStorageBits == 16)
+		{
+			vectorResult = _mm_sub_epi16(vector1, vector2);
+			vectorResult = _mm_max_epi16(_mm_min_epi16(vectorResult, _mm_set1_epi16(static_cast<short>(largestRawValue))), _mm_set1_epi16(static_cast<short>(smallestRawValue)));
+		}
+		else if constexpr (numberOfBits == 32)
+		{
+			vectorResult = _mm_sub_epi32(vector1, vector2);
+			__m128i isOverflow = _mm_srai_epi32(_mm_and_si128(_mm_xor_si128(vector1, vector2), _mm_xor_si128(vector1, vectorResult)), 31);
+			__m128i saturatedValue = _mm_xor_si128(_mm_srai_epi32(vector1, 31), _mm_set1_epi32(INT32_MAX));
+			vectorResult = _mm_or_si128(_mm_andnot_si128(isOverflow, vectorResult), _mm_and_si128(isOverflow, saturatedValue));
+		}
+		else
+		{
+			vectorResult = _mm_sub_epi32(vector1, vector2);
+			vectorResult = _mm_max_epi32(_mm_min_epi32(vectorResult, _mm_set1_epi32(static_cast<int>(largestRawValue))), _mm_set1_epi32(static_cast<int>(smallestRawValue)));
+		}
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(result + index), vectorResult);
+	}
+	return index;
+}
+/**
+ * @brief Bias that makes a floor shift of 64-bit products by numberOfFractionalBits round like the scalar multiply.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam rounding Any rounding but FixedPointRounding::Stochastic.
+ * @param products
+ * @return __m128i
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <FixedPointRounding rounding>
+__attribute__((target("sse4.1"))) __m128i FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::productRoundingBiasSse41(__m128i products)
+{
+	constexpr long long halfLeastSignificantBit = numberOfFractionalBits > 0 ? (1LL << (numberOfFractionalBits - 1)) : 0;
+	if constexpr (numberOfFractionalBits == 0 || rounding == FixedPointRounding::Floor)
+	{
+		static_cast<void>(products);
+		return _mm_setzero_si128();
+	}
+	else if constexpr (rounding == FixedPointRounding::Truncate)
+	{
+		return _mm_and_si128(_mm_shuffle_epi32(_mm_srai_epi32(products, 31), 0xF5), _mm_set1_epi64x(2 * halfLeastSignificantBit - 1));
+	}
+	else if constexpr (rounding == FixedPointRounding::RoundHalfEven)
+	{
+		return _mm_add_epi64(_mm_set1_epi64x(halfLeastSignificantBit - 1), _mm_and_si128(_mm_srli_epi64(products, numberOfFractionalBits), _mm_set1_epi64x(1)));
+	}
+	else
+	{
+		return _mm_set1_epi64x(halfLeastSignificantBit);
+	}
+}
+/**
+ * @brief Multiply raw values 16 bytes at a time with SSE4.1, rounding like the scalar multiply.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam rounding Any rounding but FixedPointRounding::Stochastic.
+ * @details 16-bit Q15 values rounded half up use the rounding high-half multiply (pmulhrsw), which is exactly the
+ * scalar rounding. Other 16-bit formats add the rounding bias to the low half of the product and carry into the high
+ * half; 32-bit formats form 64-bit products of the even and odd lanes (pmuldq), add the rounding bias, shift them and
+ * interleave the results.
+ * @param values1
+ * @param values2
+ * @param result
+ * @param numberOfValues
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <FixedPointRounding rounding>
+__attribute__((target("sse4.1"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::multiplySse41(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t numberOfValues)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m128i) / sizeof(StorageType);
+	constexpr long long halfLeastSignificantBit = numberOfFractionalBits > 0 ? (1LL << (numberOfFractionalBits - 1)) : 0;
+	std::size_t index = 0;
+	for (; index + numberOfLanes <= numberOfValues; index += numberOfLanes)
+	{
+		__m128i vector1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values1 + index));
+		__m128i vector2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values2 + index));
+		__m128i vectorResult;
+		if constexpr (rounding == FixedPointRounding::RoundHalfUp && numberOfStorageBits == 16 && numberOfBits == 16 && numberOfFractionalBits == 15)
+		{
+			vectorResult = _mm_mulhrs_epi16(vector1, vector2);
+		}
+		else if constexpr (numberOfStorageBits == 16)
+		{
+			__m128i lowHalf = _mm_mullo_epi16(vector1, vector2);
+			__m128i highHalf = _mm_mulhi_epi16(vector1, vector2);
+			vectorResult = lowHalf;
+			if constexpr (numberOfFractionalBits > 0)
+			{
+				__m128i bias = _mm_setzero_si128();
+				if constexpr (rounding == FixedPointRounding::Truncate)
+				{
+					bias = _mm_and_si128(_mm_srai_epi16(highHalf, 15), _mm_set1_epi16(static_cast<short>(2 * halfLeastSignificantBit - 1)));
+				}
+				else if constexpr (rounding == FixedPointRounding::RoundHalfUp)
+				{
+					bias = _mm_set1_epi16(static_cast<short>(halfLeastSignificantBit));
+				}
+				else if constexpr (rounding == FixedPointRounding::RoundHalfEven)
+				{
+					__m128i leastSignificantBit = numberOfFractionalBits == 16 ? highHalf : _mm_srli_epi16(lowHalf, numberOfFractionalBits);
+					bias = _mm_add_epi16(_mm_set1_epi16(static_cast<short>(halfLeastSignificantBit - 1)), _mm_and_si128(leastSignificantBit, _mm_set1_epi16(1)));
+				}
+				__m128i roundedLowHalf = _mm_add_epi16(lowHalf, bias);
+				__m128i carry = _mm_srli_epi16(_mm_or_si128(_mm_and_si128(lowHalf, bias), _mm_andnot_si128(roundedLowHalf, _mm_or_si128(lowHalf, bias))), 15);
+				highHalf = _mm_add_epi16(highHalf, carry);
+				vectorResult = _mm_or_si128(_mm_srli_epi16(roundedLowHalf, numberOfFractionalBits), _mm_slli_epi16(highHalf, 16 - numberOfFractionalBits));
+			}
+			if constexpr (numberOfBits < numberOfStorageBits)
+			{
+				vectorResult = _mm_srai_epi16(_mm_slli_epi16(vectorResult, numberOfStorageBits - numberOfBits), numberOfStorageBits - numberOfBits);
+			}
+		}
+		else
+		{
+			__m128i evenProducts = _mm_mul_epi32(vector1, vector2);
+			__m128i oddProducts = _mm_mul_epi32(_mm_srli_epi64(vector1, 32), _mm_srli_epi64(vector2, 32));
+			evenProducts = _mm_add_epi64(evenProducts, productRoundingBiasSse41<rounding>(evenProducts));
+			oddProducts = _mm_add_epi64(oddProducts, productRoundingBiasSse41<rounding>(oddProducts));
+			evenProducts = _mm_srli_epi64(evenProducts, numberOfFractionalBits);
+			oddProducts = _mm_slli_epi64(_mm_srli_epi64(oddProducts, numberOfFractionalBits), 32);
+			vectorResult = _mm_blend_epi16(evenProducts, oddProducts, 0xCC);
+			if constexpr (numberOfBits < numberOfStorageBits)
+			{
+				vectorResult = _mm_srai_epi32(_mm_slli_epi32(vectorResult, numberOfStorageBits - numberOfBits), numberOfStorageBits - numberOfBits);
+			}
+		}
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(result + index), vectorResult);
+	}
+	return index;
+}
+/**
+ * @brief Shift raw values right 16 bytes at a time with SSE4.1, rounding like the scalar shiftRight.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam rounding Any rounding but FixedPointRounding::Stochastic.
+ * @details The floor is an arithmetic shift; the rounding bit, the sticky bits below it and the discarded bits are
+ * turned into a 0 or 1 per lane that is added to it.
+ * @param values
+ * @param amountToShift At least 1.
+ * @param result
+ * @param numberOfValues
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <FixedPointRounding rounding>
+__attribute__((target("sse4.1"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::shiftRightSse41(const StorageType* values, int amountToShift, StorageType* result, std::size_t numberOfValues)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m128i) / sizeof(StorageType);
+	__m128i shiftCount = _mm_cvtsi32_si128(amountToShift);
+	__m128i roundingBitCount = _mm_cvtsi32_si128(amountToShift - 1);
+	StorageType stickyBits = amountToShift - 1 < numberOfStorageBits ? static_cast<StorageType>((1LL << (amountToShift - 1)) - 1) : static_cast<StorageType>(-1);
+	StorageType discardedBits = amountToShift < numberOfStorageBits ? static_cast<StorageType>((1LL << amountToShift) - 1) : static_cast<StorageType>(-1);
+	__m128i stickyMask = numberOfStorageBits == 16 ? _mm_set1_epi16(static_cast<short>(stickyBits)) : _mm_set1_epi32(static_cast<int>(stickyBits));
+	__m128i discardedMask = numberOfStorageBits == 16 ? _mm_set1_epi16(static_cast<short>(discardedBits)) : _mm_set1_epi32(static_cast<int>(discardedBits));
+	std::size_t index = 0;
+	for (; index + numberOfLanes <= numberOfValues; index += numberOfLanes)
+	{
+		__m128i vector = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + index));
+		__m128i vectorResult;
+		if constexpr (numberOfStorageBits == 16)
+		{
+			__m128i floor = _mm_sra_epi16(vector, shiftCount);
+			__m128i roundingBit = _mm_and_si128(_mm_sra_epi16(vector, roundingBitCount), _mm_set1_epi16(1));
+			vectorResult = floor;
+			if constexpr (rounding == FixedPointRounding::Truncate)
+			{
+				__m128i isDiscardedNonZero = _mm_andnot_si128(_mm_cmpeq_epi16(_mm_and_si128(vector, discardedMask), _mm_setzero_si128()), _mm_set1_epi16(1));
+				vectorResult = _mm_add_epi16(floor, _mm_and_si128(_mm_srai_epi16(vector, 15), isDiscardedNonZero));
+			}
+			else if constexpr (rounding == FixedPointRounding::RoundHalfUp)
+			{
+				vectorResult = _mm_add_epi16(floor, roundingBit);
+			}
+			else if constexpr (rounding == FixedPointRounding::RoundHalfEven)
+			{
+				__m128i isStickyNonZero = _mm_andnot_si128(_mm_cmpeq_epi16(_mm_and_si128(vector, stickyMask), _mm_setzero_si128()), _mm_set1_epi16(1));
+				vectorResult = _mm_add_epi16(floor, _mm_and_si128(roundingBit, _mm_or_si128(_mm_and_si128(floor, _mm_set1_epi16(1)), isStickyNonZero)));
+			}
+		}
+		else
+		{
+			__m128i floor = _mm_sra_epi32(vector, shiftCount);
+			__m128i roundingBit = _mm_and_si128(_mm_sra_epi32(vector, roundingBitCount), _mm_set1_epi32(1));
+			vectorResult = floor;
+			if constexpr (rounding == FixedPointRounding::Truncate)
+			{
+				__m128i isDiscardedNonZero = _mm_andnot_si128(_mm_cmpeq_epi32(_mm_and_si128(vector, discardedMask), _mm_setzero_si128()), _mm_set1_epi32(1));
+				vectorResult = _mm_add_epi32(floor, _mm_and_si128(_mm_srai_epi32(vector, 31), isDiscardedNonZero));
+			}
+			else if constexpr (rounding == FixedPointRounding::RoundHalfUp)
+			{
+				vectorResult = _mm_add_epi32(floor, roundingBit);
+			}
+			else if constexpr (rounding == FixedPointRounding::RoundHalfEven)
+			{
+				__m128i isStickyNonZero = _mm_andnot_si128(_mm_cmpeq_epi32(_mm_and_si128(vector, stickyMask), _mm_setzero_si128()), _mm_set1_epi32(1));
+				vectorResult = _mm_add_epi32(floor, _mm_and_si128(roundingBit, _mm_or_si128(_mm_and_si128(floor, _mm_set1_epi32(1)), isStickyNonZero)));
+			}
+		}
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(result + index), vectorResult);
+	}
+	return index;
+}
+/**
+ * @brief Add raw values 32 bytes at a time with AVX2, wrapping like the scalar operator.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values1
+ * @param values2
+ * @param result
+ * @param numberOfValues
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx2"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::addAvx2(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t numberOfValues)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m256i) / sizeof(StorageType);
+	std::size_t index = 0;
+	for (; index + numberOfLanes <= numberOfValues; index += numberOfLanes)
+	{
+		__m256i vector1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values1 + index));
+		__m256i vector2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values2 + index));
+		__m256i vectorResult;
+		if constexpr (numberOfStorageBits == 16)
+		{
+			vectorResult = _mm256_add_epi16(vector1, vector2);
+			if constexpr (numberOfBits < numberOfStorageBits)
+			{
+				vectorResult = _mm256_srai_epi16(_mm256_slli_epi16(vectorResult, numberOfStorageBits - numberOfBits), numberOfStorageBits - numberOfBits);
+			}
+		}
+		else
+		{
+			vectorResult = _mm256_add_epi32(vector1, vector2);
+			if constexpr (numberOfBits < numberOfStorageBits)
+			{
+				vectorResult = _mm256_srai_epi32(_mm256_slli_epi32(vectorResult, numberOfStorageBits - numberOfBits), numberOfStorageBits - numberOfBits);
+			}
+		}
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(result + index), vectorResult);
+	}
+	return index;
+}
+/**
+ * @brief Subtract raw values 32 bytes at a time with AVX2, wrapping like the scalar operator.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values1
+ * @param values2
+ * @param result
+ * @param numberOfValues
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx2"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::subtractAvx2(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t numberOfValues)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m256i) / sizeof(StorageType);
+	std::size_t index = 0;
+	for (; index + numberOfLanes <= numberOfValues; index += numberOfLanes)
+	{
+		__m256i vector1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values1 + index));
+		__m256i vector2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values2 + index));
+		__m256i vectorResult;
+		if constexpr (numberOfStorageBits == 16)
+		{
+			vectorResult = _mm256_sub_epi16(vector1, vector2);
+			if constexpr (numberOfBits < numberOfStorageBits)
+			{
+				vectorResult = _mm256_srai_epi16(_mm256_slli_epi16(vectorResult, numberOfStorageBits - numberOfBits), numberOfStorageBits - numberOfBits);
+			}
+		}
+		else
+		{
+			vectorResult = _mm256_sub_epi32(vector1, vector2);
+			if constexpr (numberOfBits < numberOfStorageBits)
+			{
+				vectorResult = _mm256_srai_epi32(_mm256_slli_epi32(vectorResult, numberOfStorageBits - numberOfBits), numberOfStorageBits - numberOfBits);
+			}
+		}
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(result + index), vectorResult);
+	}
+	return index;
+}
+/**
+ * @brief Add raw values 32 bytes at a time with AVX2, clamping to the range of the format.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values1
+ * @param values2
+ * @param result
+ * @param numberOfValues
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx2"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::addSaturatedAvx2(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t numberOfValues)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m256i) / sizeof(StorageType);
+	std::size_t index = 0;
+	for (; index + numberOfLanes <= numberOfValues; index += numberOfLanes)
+	{
+		__m256i vector1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values1 + index));
+		__m256i vector2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values2 + index));
+		__m256i vectorResult;
+		if constexpr (numberOfStorageBits == 16 && numberOfBits == 16)
+		{
+			vectorResult = _mm256_adds_epi16(vector1, vector2);
+		}
+		else if constexpr (numberOfStorageBits == 16)
+		{
+			vectorResult = _mm256_add_epi16(vector1, vector2);
+			vectorResult = _mm256_max_epi16(_mm256_min_epi16(vectorResult, _mm256_set1_epi16(static_cast<short>(largestRawValue))), _mm256_set1_epi16(static_cast<short>(smallestRawValue)));
+		}
+		else if constexpr (numberOfBits == 32)
+		{
+			vectorResult = _mm256_add_epi32(vector1, vector2);
+			__m256i isOverflow = _mm256_srai_epi32(_mm256_and_si256(_mm256_xor_si256(vector1, vectorResult), _mm256_xor_si256(vector2, vectorResult)), 31);
+			__m256i saturatedValue = _mm256_xor_si256(_mm256_srai_epi32(vector1, 31), _mm256_set1_epi32(INT32_MAX));
+			vectorResult = _mm256_or_si256(_mm256_andnot_si256(isOverflow, vectorResult), _mm256_and_si256(isOverflow, saturatedValue));
+		}
+		else
+		{
+			vectorResult = _mm256_add_epi32(vector1, vector2);
+			vectorResult = _mm256_max_epi32(_mm256_min_epi32(vectorResult, _mm256_set1_epi32(static_cast<int>(largestRawValue))), _mm256_set1_epi32(static_cast<int>(smallestRawValue)));
+		}
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(result + index), vectorResult);
+	}
+	return index;
+}
+/**
+ * @brief Subtract raw values 32 bytes at a time with AVX2, clamping to the range of the format.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values1
+ * @param values2
+ * @param result
+ * @param numberOfValues
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx2"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::subtractSaturatedAvx2(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t numberOfValues)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m256i) / sizeof(StorageType);
+	std::size_t index = 0;
+	for (; index + numberOfLanes <= numberOfValues; index += numberOfLanes)
+	{
+		__m256i vector1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values1 + index));
+		__m256i vector2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values2 + index));
+		__m256i vectorResult;
+		if constexpr (numberOfStorageBits == 16 && numberOfBits == 16)
+		{
+			vectorResult = _mm256_subs_epi16(vector1, vector2);
+		}
+		else if constexpr (numberOfStorageBits == 16)
+		{
+			vectorResult = _mm256_sub_epi16(vector1, vector2);
+			vectorResult = _mm256_max_epi16(_mm256_min_epi16(vectorResult, _mm256_set1_epi16(static_cast<short>(largestRawValue))), _mm256_set1_epi16(static_cast<short>(smallestRawValue)));
+		}
+		else if constexpr (numberOfBits == 32)
+		{
+			vectorResult = _mm256_sub_epi32(vector1, vector2);
+			__m256i isOverflow = _mm256_srai_epi32(_mm256_and_si256(_mm256_xor_si256(vector1, vector2), _mm256_xor_si256(vector1, vectorResult)), 31);
+			__m256i saturatedValue = _mm256_xor_si256(_mm256_srai_epi32(vector1, 31), _mm256_set1_epi32(INT32_MAX));
+			vectorResult = _mm256_or_si256(_mm256_andnot_si256(isOverflow, vectorResult), _mm256_and_si256(isOverflow, saturatedValue));
+		}
+		else
+		{
+			vectorResult = _mm256_sub_epi32(vector1, vector2);
+			vectorResult = _mm256_max_epi32(_mm256_min_epi32(vectorResult, _mm256_set1_epi32(static_cast<int>(largestRawValue))), _mm256_set1_epi32(static_cast<int>(smallestRawValue)));
+		}
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(result + index), vectorResult);
+	}
+	return index;
+}
+/**
+ * @brief Bias that makes a floor shift of 64-bit products by numberOfFractionalBits round like the scalar multiply.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam rounding Any rounding but FixedPointRounding::Stochastic.
+ * @param products
+ * @return __m256i
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <FixedPointRounding rounding>
+__attribute__((target("avx2"))) __m256i FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::productRoundingBiasAvx2(__m256i products)
+{
+	constexpr long long halfLeastSignificantBit = numberOfFractionalBits > 0 ? (1LL << (numberOfFractionalBits - 1)) : 0;
+	if constexpr (numberOfFractionalBits == 0 || rounding == FixedPointRounding::Floor)
+	{
+		static_cast<void>(products);
+		return _mm256_setzero_si256();
+	}
+	else if constexpr (rounding == FixedPointRounding::Truncate)
+	{
+		return _mm256_and_si256(_mm256_shuffle_epi32(_mm256_srai_epi32(products, 31), 0xF5), _mm256_set1_epi64x(2 * halfLeastSignificantBit - 1));
+	}
+	else if constexpr (rounding == FixedPointRounding::RoundHalfEven)
+	{
+		return _mm256_add_epi64(_mm256_set1_epi64x(halfLeastSignificantBit - 1), _mm256_and_si256(_mm256_srli_epi64(products, numberOfFractionalBits), _mm256_set1_epi64x(1)));
+	}
+	else
+	{
+		return _mm256_set1_epi64x(halfLeastSignificantBit);
+	}
+}
+/**
+ * @brief Multiply raw values 32 bytes at a time with AVX2, rounding like the scalar multiply.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam rounding Any rounding but FixedPointRounding::Stochastic.
+ * @details 16-bit Q15 values rounded half up use the rounding high-half multiply (pmulhrsw), which is exactly the
+ * scalar rounding. Other 16-bit formats add the rounding bias to the low half of the product and carry into the high
+ * half; 32-bit formats form 64-bit products of the even and odd lanes (pmuldq), add the rounding bias, shift them and
+ * interleave the results.
+ * @param values1
+ * @param values2
+ * @param result
+ * @param numberOfValues
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <FixedPointRounding rounding>
+__attribute__((target("avx2"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::multiplyAvx2(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t numberOfValues)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m256i) / sizeof(StorageType);
+	constexpr long long halfLeastSignificantBit = numberOfFractionalBits > 0 ? (1LL << (numberOfFractionalBits - 1)) : 0;
+	std::size_t index = 0;
+	for (; index + numberOfLanes <= numberOfValues; index += numberOfLanes)
+	{
+		__m256i vector1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values1 + index));
+		__m256i vector2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values2 + index));
+		__m256i vectorResult;
+		if constexpr (rounding == FixedPointRounding::RoundHalfUp && numberOfStorageBits == 16 && numberOfBits == 16 && numberOfFractionalBits == 15)
+		{
+			vectorResult = _mm256_mulhrs_epi16(vector1, vector2);
+		}
+		else if constexpr (numberOfStorageBits == 16)
+		{
+			__m256i lowHalf = _mm256_mullo_epi16(vector1, vector2);
+			__m256i highHalf = _mm256_mulhi_epi16(vector1, vector2);
+			vectorResult = lowHalf;
+			if constexpr (numberOfFractionalBits > 0)
+			{
+				__m256i bias = _mm256_setzero_si256();
+				if constexpr (rounding == FixedPointRounding::Truncate)
+				{
+					bias = _mm256_and_si256(_mm256_srai_epi16(highHalf, 15), _mm256_set1_epi16(static_cast<short>(2 * halfLeastSignificantBit - 1)));
+				}
+				else if constexpr (rounding == FixedPointRounding::RoundHalfUp)
+				{
+					bias = _mm256_set1_epi16(static_cast<short>(halfLeastSignificantBit));
+				}
+				else if constexpr (rounding == FixedPointRounding::RoundHalfEven)
+				{
+					__m256i leastSignificantBit = numberOfFractionalBits == 16 ? highHalf : _mm256_srli_epi16(lowHalf, numberOfFractionalBits);
+					bias = _mm256_add_epi16(_mm256_set1_epi16(static_cast<short>(halfLeastSignificantBit - 1)), _mm256_and_si256(leastSignificantBit, _mm256_set1_epi16(1)));
+				}
+				__m256i roundedLowHalf = _mm256_add_epi16(lowHalf, bias);
+				__m256i carry = _mm256_srli_epi16(_mm256_or_si256(_mm256_and_si256(lowHalf, bias), _mm256_andnot_si256(roundedLowHalf, _mm256_or_si256(lowHalf, bias))), 15);
+				highHalf = _mm256_add_epi16(highHalf, carry);
+				vectorResult = _mm256_or_si256(_mm256_srli_epi16(roundedLowHalf, numberOfFractionalBits), _mm256_slli_epi16(highHalf, 16 - numberOfFractionalBits));
+			}
+			if constexpr (numberOfBits < numberOfStorageBits)
+			{
+				vectorResult = _mm256_srai_epi16(_mm256_slli_epi16(vectorResult, numberOfStorageBits - numberOfBits), numberOfStorageBits - numberOfBits);
+			}
+		}
+		else
+		{
+			__m256i evenProducts = _mm256_mul_epi32(vector1, vector2);
+			__m256i oddProducts = _mm256_mul_epi32(_mm256_srli_epi64(vector1, 32), _mm256_srli_epi64(vector2, 32));
+			evenProducts = _mm256_add_epi64(evenProducts, productRoundingBiasAvx2<rounding>(evenProducts));
+			oddProducts = _mm256_add_epi64(oddProducts, productRoundingBiasAvx2<rounding>(oddProducts));
+			evenProducts = _mm256_srli_epi64(evenProducts, numberOfFractionalBits);
+			oddProducts = _mm256_slli_epi64(_mm256_srli_epi64(oddProducts, numberOfFractionalBits), 32);
+			vectorResult = _mm256_blend_epi32(evenProducts, oddProducts, 0xAA);
+			if constexpr (numberOfBits < numberOfStorageBits)
+			{
+				vectorResult = _mm256_srai_epi32(_mm256_slli_epi32(vectorResult, numberOfStorageBits - numberOfBits), numberOfStorageBits - numberOfBits);
+			}
+		}
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(result + index), vectorResult);
+	}
+	return index;
+}
+/**
+ * @brief Shift raw values right 32 bytes at a time with AVX2, rounding like the scalar shiftRight.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam rounding Any rounding but FixedPointRounding::Stochastic.
+ * @details The floor is an arithmetic shift; the rounding bit, the sticky bits below it and the discarded bits are
+ * turned into a 0 or 1 per lane that is added to it.
+ * @param values
+ * @param amountToShift At least 1.
+ * @param result
+ * @param numberOfValues
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <FixedPointRounding rounding>
+__attribute__((target("avx2"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::shiftRightAvx2(const StorageType* values, int amountToShift, StorageType* result, std::size_t numberOfValues)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m256i) / sizeof(StorageType);
+	__m128i shiftCount = _mm_cvtsi32_si128(amountToShift);
+	__m128i roundingBitCount = _mm_cvtsi32_si128(amountToShift - 1);
+	StorageType stickyBits = amountToShift - 1 < numberOfStorageBits ? static_cast<StorageType>((1LL << (amountToShift - 1)) - 1) : static_cast<StorageType>(-1);
+	StorageType discardedBits = amountToShift < numberOfStorageBits ? static_cast<StorageType>((1LL << amountToShift) - 1) : static_cast<StorageType>(-1);
+	__m256i stickyMask = numberOfStorageBits == 16 ? _mm256_set1_epi16(static_cast<short>(stickyBits)) : _mm256_set1_epi32(static_cast<int>(stickyBits));
+	__m256i discardedMask = numberOfStorageBits == 16 ? _mm256_set1_epi16(static_cast<short>(discardedBits)) : _mm256_set1_epi32(static_cast<int>(discardedBits));
+	std::size_t index = 0;
+	for (; index + numberOfLanes <= numberOfValues; index += numberOfLanes)
+	{
+		__m256i vector = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + index));
+		__m256i vectorResult;
+		if constexpr (numberOfStorageBits == 16)
+		{
+			__m256i floor = _mm256_sra_epi16(vector, shiftCount);
+			__m256i roundingBit = _mm256_and_si256(_mm256_sra_epi16(vector, roundingBitCount), _mm256_set1_epi16(1));
+			vectorResult = floor;
+			if constexpr (rounding == FixedPointRounding::Truncate)
+			{
+				__m256i isDiscardedNonZero = _mm256_andnot_si256(_mm256_cmpeq_epi16(_mm256_and_si256(vector, discardedMask), _mm256_setzero_si256()), _mm256_set1_epi16(1));
+				vectorResult = _mm256_add_epi16(floor, _mm256_and_si256(_mm256_srai_epi16(vector, 15), isDiscardedNonZero));
+			}
+			else if constexpr (rounding == FixedPointRounding::RoundHalfUp)
+			{
+				vectorResult = _mm256_add_epi16(floor, roundingBit);
+			}
+			else if constexpr (rounding == FixedPointRounding::RoundHalfEven)
+			{
+				__m256i isStickyNonZero = _mm256_andnot_si256(_mm256_cmpeq_epi16(_mm256_and_si256(vector, stickyMask), _mm256_setzero_si256()), _mm256_set1_epi16(1));
+				vectorResult = _mm256_add_epi16(floor, _mm256_and_si256(roundingBit, _mm256_or_si256(_mm256_and_si256(floor, _mm256_set1_epi16(1)), isStickyNonZero)));
+			}
+		}
+		else
+		{
+			__m256i floor = _mm256_sra_epi32(vector, shiftCount);
+			__m256i roundingBit = _mm256_and_si256(_mm256_sra_epi32(vector, roundingBitCount), _mm256_set1_epi32(1));
+			vectorResult = floor;
+			if constexpr (rounding == FixedPointRounding::Truncate)
+			{
+				__m256i isDiscardedNonZero = _mm256_andnot_si256(_mm256_cmpeq_epi32(_mm256_and_si256(vector, discardedMask), _mm256_setzero_si256()), _mm256_set1_epi32(1));
+				vectorResult = _mm256_add_epi32(floor, _mm256_and_si256(_mm256_srai_epi32(vector, 31), isDiscardedNonZero));
+			}
+			else if constexpr (rounding == FixedPointRounding::RoundHalfUp)
+			{
+				vectorResult = _mm256_add_epi32(floor, roundingBit);
+			}
+			else if constexpr (rounding == FixedPointRounding::RoundHalfEven)
+			{
+				__m256i isStickyNonZero = _mm256_andnot_si256(_mm256_cmpeq_epi32(_mm256_and_si256(vector, stickyMask), _mm256_setzero_si256()), _mm256_set1_epi32(1));
+				vectorResult = _mm256_add_epi32(floor, _mm256_and_si256(roundingBit, _mm256_or_si256(_mm256_and_si256(floor, _mm256_set1_epi32(1)), isStickyNonZero)));
+			}
+		}
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(result + index), vectorResult);
+	}
+	return index;
+}
+/**
+ * @brief Find the smallest and largest raw values 16 bytes at a time with SSE4.1.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param numberOfValues
+ * @param minimum Running minimum, updated in place when at least one full vector is processed.
+ * @param maximum Running maximum, updated in place when at least one full vector is processed.
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("sse4.1"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::minimumAndMaximumSse41(const StorageType* values, std::size_t numberOfValues, StorageType &minimum, StorageType &maximum)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m128i) / sizeof(StorageType);
+	__m128i vectorMinimum;
+	__m128i vectorMaximum;
+	if constexpr (numberOfStorageBits == 16)
+	{
+		vectorMinimum = _mm_set1_epi16(static_cast<short>(minimum));
+		vectorMaximum = _mm_set1_epi16(static_cast<short>(maximum));
+	}
+	else
+	{
+		vectorMinimum = _mm_set1_epi32(static_cast<int>(minimum));
+		vectorMaximum = _mm_set1_epi32(static_cast<int>(maximum));
+	}
+	std::size_t index = 0;
+	for (; index + numberOfLanes <= numberOfValues; index += numberOfLanes)
+	{
+		__m128i vector = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + index));
+		if constexpr (numberOfStorageBits == 16)
+		{
+			vectorMinimum = _mm_min_epi16(vectorMinimum, vector);
+			vectorMaximum = _mm_max_epi16(vectorMaximum, vector);
+		}
+		else
+		{
+			vectorMinimum = _mm_min_epi32(vectorMinimum, vector);
+			vectorMaximum = _mm_max_epi32(vectorMaximum, vector);
+		}
+	}
+	alignas(__m128i) StorageType laneMinimums[numberOfLanes];
+	alignas(__m128i) StorageType laneMaximums[numberOfLanes];
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(laneMinimums), vectorMinimum);
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(laneMaximums), vectorMaximum);
+	minimumAndMaximumScalar(laneMinimums, 0, numberOfLanes, minimum, maximum);
+	minimumAndMaximumScalar(laneMaximums, 0, numberOfLanes, minimum, maximum);
+	return index;
+}
+/**
+ * @brief Search for a raw value 16 bytes at a time with SSE4.1.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param numberOfValues
+ * @param value
+ * @return std::size_t Start of the first vector containing a match, or the number of elements processed if no vector
+ * matched; either way the caller finishes the search from there.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("sse4.1"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::indexOfSse41(const StorageType* values, std::size_t numberOfValues, StorageType value)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m128i) / sizeof(StorageType);
+	__m128i vectorValue;
+	if constexpr (numberOfStorageBits == 16)
+	{
+		vectorValue = _mm_set1_epi16(static_cast<short>(value));
+	}
+	else
+	{
+		vectorValue = _mm_set1_epi32(static_cast<int>(value));
+	}
+	std::size_t index = 0;
+	for (; index + numberOfLanes <= numberOfValues; index += numberOfLanes)
+	{
+		__m128i vector = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + index));
+		bool isFound;
+		if constexpr (numberOfStorageBits == 16)
+		{
+			isFound = _mm_movemask_epi8(_mm_cmpeq_epi16(vector, vectorValue)) != 0;
+		}
+		else
+		{
+			isFound = _mm_movemask_epi8(_mm_cmpeq_epi32(vector, vectorValue)) != 0;
+		}
+		if (isFound)
+		{
+			return index;
+		}
+	}
+	return index;
+}
+/**
+ * @brief Find the smallest and largest raw values 32 bytes at a time with AVX2.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param numberOfValues
+ * @param minimum Running minimum, updated in place when at least one full vector is processed.
+ * @param maximum Running maximum, updated in place when at least one full vector is processed.
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx2"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::minimumAndMaximumAvx2(const StorageType* values, std::size_t numberOfValues, StorageType &minimum, StorageType &maximum)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m256i) / sizeof(StorageType);
+	__m256i vectorMinimum;
+	__m256i vectorMaximum;
+	if constexpr (numberOfStorageBits == 16)
+	{
+		vectorMinimum = _mm256_set1_epi16(static_cast<short>(minimum));
+		vectorMaximum = _mm256_set1_epi16(static_cast<short>(maximum));
+	}
+	else
+	{
+		vectorMinimum = _mm256_set1_epi32(static_cast<int>(minimum));
+		vectorMaximum = _mm256_set1_epi32(static_cast<int>(maximum));
+	}
+	std::size_t index = 0;
+	for (; index + numberOfLanes <= numberOfValues; index += numberOfLanes)
+	{
+		__m256i vector = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + index));
+		if constexpr (numberOfStorageBits == 16)
+		{
+			vectorMinimum = _mm256_min_epi16(vectorMinimum, vector);
+			vectorMaximum = _mm256_max_epi16(vectorMaximum, vector);
+		}
+		else
+		{
+			vectorMinimum = _mm256_min_epi32(vectorMinimum, vector);
+			vectorMaximum = _mm256_max_epi32(vectorMaximum, vector);
+		}
+	}
+	alignas(__m256i) StorageType laneMinimums[numberOfLanes];
+	alignas(__m256i) StorageType laneMaximums[numberOfLanes];
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(laneMinimums), vectorMinimum);
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(laneMaximums), vectorMaximum);
+	minimumAndMaximumScalar(laneMinimums, 0, numberOfLanes, minimum, maximum);
+	minimumAndMaximumScalar(laneMaximums, 0, numberOfLanes, minimum, maximum);
+	return index;
+}
+/**
+ * @brief Search for a raw value 32 bytes at a time with AVX2.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param numberOfValues
+ * @param value
+ * @return std::size_t Start of the first vector containing a match, or the number of elements processed if no vector
+ * matched; either way the caller finishes the search from there.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx2"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::indexOfAvx2(const StorageType* values, std::size_t numberOfValues, StorageType value)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m256i) / sizeof(StorageType);
+	__m256i vectorValue;
+	if constexpr (numberOfStorageBits == 16)
+	{
+		vectorValue = _mm256_set1_epi16(static_cast<short>(value));
+	}
+	else
+	{
+		vectorValue = _mm256_set1_epi32(static_cast<int>(value));
+	}
+	std::size_t index = 0;
+	for (; index + numberOfLanes <= numberOfValues; index += numberOfLanes)
+	{
+		__m256i vector = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + index));
+		bool isFound;
+		if constexpr (numberOfStorageBits == 16)
+		{
+			isFound = _mm256_movemask_epi8(_mm256_cmpeq_epi16(vector, vectorValue)) != 0;
+		}
+		else
+		{
+			isFound = _mm256_movemask_epi8(_mm256_cmpeq_epi32(vector, vectorValue)) != 0;
+		}
+		if (isFound)
+		{
+			return index;
+		}
+	}
+	return index;
+}
+/**
+ * @brief Accumulate the exact products of raw values 16 bytes at a time with SSE4.1.
+ * @details 16-bit formats multiply and add pairs with madd and widen the pair sums to 64-bit lanes; the only pair sum
+ * that overflows 32 bits, 2^31 from two products of the most negative value, is corrected after widening. 32-bit
+ * formats split every 64-bit product into its low and high 32-bit halves and count the negative products, so the
+ * 64-bit lanes cannot overflow within a block. The lanes are folded into the accumulator after every block.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values1
+ * @param values2
+ * @param numberOfValues
+ * @param accumulator Exact sum of products with 2 * numberOfFractionalBits fractional bits, updated in place.
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("sse4.1"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::dotSse41(const StorageType* values1, const StorageType* values2, std::size_t numberOfValues, AccumulatorType &accumulator)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m128i) / sizeof(StorageType);
+	constexpr std::size_t numberOfLanes64 = sizeof(__m128i) / sizeof(int64_t);
+	std::size_t index = 0;
+	while (index + numberOfLanes <= numberOfValues)
+	{
+		std::size_t blockEnd = numberOfValues - index > accumulationBlockSize ? index + accumulationBlockSize : numberOfValues;
+		if constexpr (numberOfStorageBits == 16)
+		{
+			const __m128i pairSumOverflow = _mm_set1_epi64x(static_cast<long long>(INT32_MIN));
+			const __m128i pairSumCorrection = _mm_set1_epi64x(static_cast<long long>(1) << 32);
+			__m128i sums = _mm_setzero_si128();
+			for (; index + numberOfLanes <= blockEnd; index += numberOfLanes)
+			{
+				__m128i pairSums = _mm_madd_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(values1 + index)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(values2 + index)));
+				__m128i lowPairSums = _mm_cvtepi32_epi64(pairSums);
+				__m128i highPairSums = _mm_cvtepi32_epi64(_mm_srli_si128(pairSums, 8));
+				if constexpr (numberOfBits == 16)
+				{
+					lowPairSums = _mm_add_epi64(lowPairSums, _mm_and_si128(_mm_cmpeq_epi64(lowPairSums, pairSumOverflow), pairSumCorrection));
+					highPairSums = _mm_add_epi64(highPairSums, _mm_and_si128(_mm_cmpeq_epi64(highPairSums, pairSumOverflow), pairSumCorrection));
+				}
+				sums = _mm_add_epi64(sums, _mm_add_epi64(lowPairSums, highPairSums));
+			}
+			alignas(__m128i) int64_t laneSums[numberOfLanes64];
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(laneSums), sums);
+			for (std::size_t lane = 0; lane < numberOfLanes64; lane++)
+			{
+				accumulator = static_cast<AccumulatorType>(accumulator + static_cast<AccumulatorType>(laneSums[lane]));
+			}
+		}
+		else
+		{
+			const __m128i lowHalfMask = _mm_set1_epi64x(0xFFFFFFFFLL);
+			__m128i lowSums = _mm_setzero_si128();
+			__m128i highSums = _mm_setzero_si128();
+			__m128i negativeCounts = _mm_setzero_si128();
+			for (; index + numberOfLanes <= blockEnd; index += numberOfLanes)
+			{
+				__m128i vector1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values1 + index));
+				__m128i vector2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values2 + index));
+				__m128i evenProducts = _mm_mul_epi32(vector1, vector2);
+				__m128i oddProducts = _mm_mul_epi32(_mm_srli_epi64(vector1, 32), _mm_srli_epi64(vector2, 32));
+				lowSums = _mm_add_epi64(lowSums, _mm_add_epi64(_mm_and_si128(evenProducts, lowHalfMask), _mm_and_si128(oddProducts, lowHalfMask)));
+				highSums = _mm_add_epi64(highSums, _mm_add_epi64(_mm_srli_epi64(evenProducts, 32), _mm_srli_epi64(oddProducts, 32)));
+				negativeCounts = _mm_add_epi64(negativeCounts, _mm_add_epi64(_mm_srli_epi64(evenProducts, 63), _mm_srli_epi64(oddProducts, 63)));
+			}
+			alignas(__m128i) uint64_t laneLowSums[numberOfLanes64];
+			alignas(__m128i) uint64_t laneHighSums[numberOfLanes64];
+			alignas(__m128i) uint64_t laneNegativeCounts[numberOfLanes64];
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(laneLowSums), lowSums);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(laneHighSums), highSums);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(laneNegativeCounts), negativeCounts);
+			for (std::size_t lane = 0; lane < numberOfLanes64; lane++)
+			{
+				accumulator = static_cast<AccumulatorType>(accumulator + static_cast<AccumulatorType>(laneLowSums[lane]) + static_cast<AccumulatorType>(static_cast<AccumulatorType>(laneHighSums[lane]) << 32) - static_cast<AccumulatorType>(static_cast<AccumulatorType>(laneNegativeCounts[lane]) << 64));
+			}
+		}
+	}
+	return index;
+}
+/**
+ * @brief Accumulate the exact sum of raw values 16 bytes at a time with SSE4.1, widening to 64-bit lanes.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param numberOfValues
+ * @param accumulator Exact sum with numberOfFractionalBits fractional bits, updated in place.
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("sse4.1"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::sumSse41(const StorageType* values, std::size_t numberOfValues, AccumulatorType &accumulator)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m128i) / sizeof(StorageType);
+	constexpr std::size_t numberOfLanes64 = sizeof(__m128i) / sizeof(int64_t);
+	std::size_t index = 0;
+	while (index + numberOfLanes <= numberOfValues)
+	{
+		std::size_t blockEnd = numberOfValues - index > accumulationBlockSize ? index + accumulationBlockSize : numberOfValues;
+		__m128i sums = _mm_setzero_si128();
+		for (; index + numberOfLanes <= blockEnd; index += numberOfLanes)
+		{
+			__m128i vector = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + index));
+			if constexpr (numberOfStorageBits == 16)
+			{
+				vector = _mm_madd_epi16(vector, _mm_set1_epi16(1));
+			}
+			sums = _mm_add_epi64(sums, _mm_add_epi64(_mm_cvtepi32_epi64(vector), _mm_cvtepi32_epi64(_mm_srli_si128(vector, 8))));
+		}
+		alignas(__m128i) int64_t laneSums[numberOfLanes64];
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(laneSums), sums);
+		for (std::size_t lane = 0; lane < numberOfLanes64; lane++)
+		{
+			accumulator = static_cast<AccumulatorType>(accumulator + static_cast<AccumulatorType>(laneSums[lane]));
+		}
+	}
+	return index;
+}
+/**
+ * @brief Accumulate the exact products of raw values 32 bytes at a time with AVX2.
+ * @details 16-bit formats multiply and add pairs with madd and widen the pair sums to 64-bit lanes; the only pair sum
+ * that overflows 32 bits, 2^31 from two products of the most negative value, is corrected after widening. 32-bit
+ * formats split every 64-bit product into its low and high 32-bit halves and count the negative products, so the
+ * 64-bit lanes cannot overflow within a block. The lanes are folded into the accumulator after every block.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values1
+ * @param values2
+ * @param numberOfValues
+ * @param accumulator Exact sum of products with 2 * numberOfFractionalBits fractional bits, updated in place.
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx2"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::dotAvx2(const StorageType* values1, const StorageType* values2, std::size_t numberOfValues, AccumulatorType &accumulator)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m256i) / sizeof(StorageType);
+	constexpr std::size_t numberOfLanes64 = sizeof(__m256i) / sizeof(int64_t);
+	std::size_t index = 0;
+	while (index + numberOfLanes <= numberOfValues)
+	{
+		std::size_t blockEnd = numberOfValues - index > accumulationBlockSize ? index + accumulationBlockSize : numberOfValues;
+		if constexpr (numberOfStorageBits == 16)
+		{
+			const __m256i pairSumOverflow = _mm256_set1_epi64x(static_cast<long long>(INT32_MIN));
+			const __m256i pairSumCorrection = _mm256_set1_epi64x(static_cast<long long>(1) << 32);
+			__m256i sums = _mm256_setzero_si256();
+			for (; index + numberOfLanes <= blockEnd; index += numberOfLanes)
+			{
+				__m256i pairSums = _mm256_madd_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(values1 + index)), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values2 + index)));
+				__m256i lowPairSums = _mm256_cvtepi32_epi64(_mm256_castsi256_si128(pairSums));
+				__m256i highPairSums = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(pairSums, 1));
+				if constexpr (numberOfBits == 16)
+				{
+					lowPairSums = _mm256_add_epi64(lowPairSums, _mm256_and_si256(_mm256_cmpeq_epi64(lowPairSums, pairSumOverflow), pairSumCorrection));
+					highPairSums = _mm256_add_epi64(highPairSums, _mm256_and_si256(_mm256_cmpeq_epi64(highPairSums, pairSumOverflow), pairSumCorrection));
+				}
+				sums = _mm256_add_epi64(sums, _mm256_add_epi64(lowPairSums, highPairSums));
+			}
+			alignas(__m256i) int64_t laneSums[numberOfLanes64];
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(laneSums), sums);
+			for (std::size_t lane = 0; lane < numberOfLanes64; lane++)
+			{
+				accumulator = static_cast<AccumulatorType>(accumulator + static_cast<AccumulatorType>(laneSums[lane]));
+			}
+		}
+		else
+		{
+			const __m256i lowHalfMask = _mm256_set1_epi64x(0xFFFFFFFFLL);
+			__m256i lowSums = _mm256_setzero_si256();
+			__m256i highSums = _mm256_setzero_si256();
+			__m256i negativeCounts = _mm256_setzero_si256();
+			for (; index + numberOfLanes <= blockEnd; index += numberOfLanes)
+			{
+				__m256i vector1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values1 + index));
+				__m256i vector2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values2 + index));
+				__m256i evenProducts = _mm256_mul_epi32(vector1, vector2);
+				__m256i oddProducts = _mm256_mul_epi32(_mm256_srli_epi64(vector1, 32), _mm256_srli_epi64(vector2, 32));
+				lowSums = _mm256_add_epi64(lowSums, _mm256_add_epi64(_mm256_and_si256(evenProducts, lowHalfMask), _mm256_and_si256(oddProducts, lowHalfMask)));
+				highSums = _mm256_add_epi64(highSums, _mm256_add_epi64(_mm256_srli_epi64(evenProducts, 32), _mm256_srli_epi64(oddProducts, 32)));
+				negativeCounts = _mm256_add_epi64(negativeCounts, _mm256_add_epi64(_mm256_srli_epi64(evenProducts, 63), _mm256_srli_epi64(oddProducts, 63)));
+			}
+			alignas(__m256i) uint64_t laneLowSums[numberOfLanes64];
+			alignas(__m256i) uint64_t laneHighSums[numberOfLanes64];
+			alignas(__m256i) uint64_t laneNegativeCounts[numberOfLanes64];
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(laneLowSums), lowSums);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(laneHighSums), highSums);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(laneNegativeCounts), negativeCounts);
+			for (std::size_t lane = 0; lane < numberOfLanes64; lane++)
+			{
+				accumulator = static_cast<AccumulatorType>(accumulator + static_cast<AccumulatorType>(laneLowSums[lane]) + static_cast<AccumulatorType>(static_cast<AccumulatorType>(laneHighSums[lane]) << 32) - static_cast<AccumulatorType>(static_cast<AccumulatorType>(laneNegativeCounts[lane]) << 64));
+			}
+		}
+	}
+	return index;
+}
+/**
+ * @brief Accumulate the exact sum of raw values 32 bytes at a time with AVX2, widening to 64-bit lanes.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param numberOfValues
+ * @param accumulator Exact sum with numberOfFractionalBits fractional bits, updated in place.
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx2"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::sumAvx2(const StorageType* values, std::size_t numberOfValues, AccumulatorType &accumulator)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m256i) / sizeof(StorageType);
+	constexpr std::size_t numberOfLanes64 = sizeof(__m256i) / sizeof(int64_t);
+	std::size_t index = 0;
+	while (index + numberOfLanes <= numberOfValues)
+	{
+		std::size_t blockEnd = numberOfValues - index > accumulationBlockSize ? index + accumulationBlockSize : numberOfValues;
+		__m256i sums = _mm256_setzero_si256();
+		for (; index + numberOfLanes <= blockEnd; index += numberOfLanes)
+		{
+			__m256i vector = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + index));
+			if constexpr (numberOfStorageBits == 16)
+			{
+				vector = _mm256_madd_epi16(vector, _mm256_set1_epi16(1));
+			}
+			sums = _mm256_add_epi64(sums, _mm256_add_epi64(_mm256_cvtepi32_epi64(_mm256_castsi256_si128(vector)), _mm256_cvtepi32_epi64(_mm256_extracti128_si256(vector, 1))));
+		}
+		alignas(__m256i) int64_t laneSums[numberOfLanes64];
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(laneSums), sums);
+		for (std::size_t lane = 0; lane < numberOfLanes64; lane++)
+		{
+			accumulator = static_cast<AccumulatorType>(accumulator + static_cast<AccumulatorType>(laneSums[lane]));
+		}
+	}
+	return index;
+}
+// GCC 12 reports the undefined pass-through operands inside the AVX-512 intrinsics as (maybe-)uninitialized.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+/**
+ * @brief Add raw values 64 bytes at a time with AVX-512, wrapping like the scalar operator.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values1
+ * @param values2
+ * @param result
+ * @param numberOfValues
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx512f,avx512bw"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::addAvx512(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t numberOfValues)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m512i) / sizeof(StorageType);
+	std::size_t index = 0;
+	for (; index + numberOfLanes <= numberOfValues; index += numberOfLanes)
+	{
+		__m512i vector1 = _mm512_loadu_si512(values1 + index);
+		__m512i vector2 = _mm512_loadu_si512(values2 + index);
+		__m512i vectorResult;
+		if constexpr (numberOfStorageBits == 16)
+		{
+			vectorResult = _mm512_add_epi16(vector1, vector2);
+			if constexpr (numberOfBits < numberOfStorageBits)
+			{
+				vectorResult = _mm512_srai_epi16(_mm512_slli_epi16(vectorResult, numberOfStorageBits - numberOfBits), numberOfStorageBits - numberOfBits);
+			}
+		}
+		else
+		{
+			vectorResult = _mm512_add_epi32(vector1, vector2);
+			if constexpr (numberOfBits < numberOfStorageBits)
+			{
+				vectorResult = _mm512_srai_epi32(_mm512_slli_epi32(vectorResult, numberOfStorageBits - numberOfBits), numberOfStorageBits - numberOfBits);
+			}
+		}
+		_mm512_storeu_si512(result + index, vectorResult);
+	}
+	return index;
+}
+/**
+ * @brief Subtract raw values 64 bytes at a time with AVX-512, wrapping like the scalar operator.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values1
+ * @param values2
+ * @param result
+ * @param numberOfValues
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx512f,avx512bw"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::subtractAvx512(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t numberOfValues)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m512i) / sizeof(StorageType);
+	std::size_t index = 0;
+	for (; index + numberOfLanes <= numberOfValues; index += numberOfLanes)
+	{
+		__m512i vector1 = _mm512_loadu_si512(values1 + index);
+		__m512i vector2 = _mm512_loadu_si512(values2 + index);
+		__m512i vectorResult;
+		if constexpr (numberOfStorageBits == 16)
+		{
+			vectorResult = _mm512_sub_epi16(vector1, vector2);
+			if constexpr (numberOfBits < numberOfStorageBits)
+			{
+				vectorResult = _mm512_srai_epi16(_mm512_slli_epi16(vectorResult, numberOfStorageBits - numberOfBits), numberOfStorageBits - numberOfBits);
+			}
+		}
+		else
+		{
+			vectorResult = _mm512_sub_epi32(vector1, vector2);
+			if constexpr (numberOfBits < numberOfStorageBits)
+			{
+				vectorResult = _mm512_srai_epi32(_mm512_slli_epi32(vectorResult, numberOfStorageBits - numberOfBits), numberOfStorageBits - numberOfBits);
+			}
+		}
+		_mm512_storeu_si512(result + index, vectorResult);
+	}
+	return index;
+}
+/**
+ * @brief Add raw values 64 bytes at a time with AVX-512, clamping to the range of the format.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values1
+ * @param values2
+ * @param result
+ * @param numberOfValues
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx512f,avx512bw"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::addSaturatedAvx512(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t numberOfValues)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m512i) / sizeof(StorageType);
+	std::size_t index = 0;
+	for (; index + numberOfLanes <= numberOfValues; index += numberOfLanes)
+	{
+		__m512i vector1 = _mm512_loadu_si512(values1 + index);
+		__m512i vector2 = _mm512_loadu_si512(values2 + index);
+		__m512i vectorResult;
+		if constexpr (numberOfStorageBits == 16 && numberOfBits == 16)
+		{
+			vectorResult = _mm512_adds_epi16(vector1, vector2);
+		}
+		else if constexpr (numberOfStorageBits == 16)
+		{
+			vectorResult = _mm512_add_epi16(vector1, vector2);
+			vectorResult = _mm512_max_epi16(_mm512_min_epi16(vectorResult, _mm512_set1_epi16(static_cast<short>(largestRawValue))), _mm512_set1_epi16(static_cast<short>(smallestRawValue)));
+		}
+		else if constexpr (numberOfBits == 32)
+		{
+			vectorResult = _mm512_add_epi32(vector1, vector2);
+			__m512i isOverflow = _mm512_srai_epi32(_mm512_and_si512(_mm512_xor_si512(vector1, vectorResult), _mm512_xor_si512(vector2, vectorResult)), 31);
+			__m512i saturatedValue = _mm512_xor_si512(_mm512_srai_epi32(vector1, 31), _mm512_set1_epi32(INT32_MAX));
+			vectorResult = _mm512_or_si512(_mm512_andnot_si512(isOverflow, vectorResult), _mm512_and_si512(isOverflow, saturatedValue));
+		}
+		else
+		{
+			vectorResult = _mm512_add_epi32(vector1, vector2);
+			vectorResult = _mm512_max_epi32(_mm512_min_epi32(vectorResult, _mm512_set1_epi32(static_cast<int>(largestRawValue))), _mm512_set1_epi32(static_cast<int>(smallestRawValue)));
+		}
+		_mm512_storeu_si512(result + index, vectorResult);
+	}
+	return index;
+}
+/**
+ * @brief Subtract raw values 64 bytes at a time with AVX-512, clamping to the range of the format.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values1
+ * @param values2
+ * @param result
+ * @param numberOfValues
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx512f,avx512bw"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::subtractSaturatedAvx512(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t numberOfValues)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m512i) / sizeof(StorageType);
+	std::size_t index = 0;
+	for (; index + numberOfLanes <= numberOfValues; index += numberOfLanes)
+	{
+		__m512i vector1 = _mm512_loadu_si512(values1 + index);
+		__m512i vector2 = _mm512_loadu_si512(values2 + index);
+		__m512i vectorResult;
+		if constexpr (numberOfStorageBits == 16 && numberOfBits == 16)
+		{
+			vectorResult = _mm512_subs_epi16(vector1, vector2);
+		}
+		else if constexpr (numberOfStorageBits == 16)
+		{
+			vectorResult = _mm512_sub_epi16(vector1, vector2);
+			vectorResult = _mm512_max_epi16(_mm512_min_epi16(vectorResult, _mm512_set1_epi16(static_cast<short>(largestRawValue))), _mm512_set1_epi16(static_cast<short>(smallestRawValue)));
+		}
+		else if constexpr (numberOfBits == 32)
+		{
+			vectorResult = _mm512_sub_epi32(vector1, vector2);
+			__m512i isOverflow = _mm512_srai_epi32(_mm512_and_si512(_mm512_xor_si512(vector1, vector2), _mm512_xor_si512(vector1, vectorResult)), 31);
+			__m512i saturatedValue = _mm512_xor_si512(_mm512_srai_epi32(vector1, 31), _mm512_set1_epi32(INT32_MAX));
+			vectorResult = _mm512_or_si512(_mm512_andnot_si512(isOverflow, vectorResult), _mm512_and_si512(isOverflow, saturatedValue));
+		}
+		else
+		{
+			vectorResult = _mm512_sub_epi32(vector1, vector2);
+			vectorResult = _mm512_max_epi32(_mm512_min_epi32(vectorResult, _mm512_set1_epi32(static_cast<int>(largestRawValue))), _mm512_set1_epi32(static_cast<int>(smallestRawValue)));
+		}
+		_mm512_storeu_si512(result + index, vectorResult);
+	}
+	return index;
+}
+/**
+ * @brief Bias that makes a floor shift of 64-bit products by numberOfFractionalBits round like the scalar multiply.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam rounding Any rounding but FixedPointRounding::Stochastic.
+ * @param products
+ * @return __m512i
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <FixedPointRounding rounding>
+__attribute__((target("avx512f,avx512bw"))) __m512i FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::productRoundingBiasAvx512(__m512i products)
+{
+	constexpr long long halfLeastSignificantBit = numberOfFractionalBits > 0 ? (1LL << (numberOfFractionalBits - 1)) : 0;
+	if constexpr (numberOfFractionalBits == 0 || rounding == FixedPointRounding::Floor)
+	{
+		static_cast<void>(products);
+		return _mm512_setzero_si512();
+	}
+	else if constexpr (rounding == FixedPointRounding::Truncate)
+	{
+		return _mm512_and_si512(_mm512_srai_epi64(products, 63), _mm512_set1_epi64(2 * halfLeastSignificantBit - 1));
+	}
+	else if constexpr (rounding == FixedPointRounding::RoundHalfEven)
+	{
+		return _mm512_add_epi64(_mm512_set1_epi64(halfLeastSignificantBit - 1), _mm512_and_si512(_mm512_srli_epi64(products, numberOfFractionalBits), _mm512_set1_epi64(1)));
+	}
+	else
+	{
+		return _mm512_set1_epi64(halfLeastSignificantBit);
+	}
+}
+/**
+ * @brief Multiply raw values 64 bytes at a time with AVX-512, rounding like the scalar multiply.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam rounding Any rounding but FixedPointRounding::Stochastic.
+ * @details 16-bit Q15 values rounded half up use the rounding high-half multiply (pmulhrsw), which is exactly the
+ * scalar rounding. Other 16-bit formats add the rounding bias to the low half of the product and carry into the high
+ * half; 32-bit formats form 64-bit products of the even and odd lanes (pmuldq), add the rounding bias, shift them and
+ * interleave the results.
+ * @param values1
+ * @param values2
+ * @param result
+ * @param numberOfValues
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <FixedPointRounding rounding>
+__attribute__((target("avx512f,avx512bw"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::multiplyAvx512(const StorageType* values1, const StorageType* values2, StorageType* result, std::size_t numberOfValues)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m512i) / sizeof(StorageType);
+	constexpr long long halfLeastSignificantBit = numberOfFractionalBits > 0 ? (1LL << (numberOfFractionalBits - 1)) : 0;
+	std::size_t index = 0;
+	for (; index + numberOfLanes <= numberOfValues; index += numberOfLanes)
+	{
+		__m512i vector1 = _mm512_loadu_si512(values1 + index);
+		__m512i vector2 = _mm512_loadu_si512(values2 + index);
+		__m512i vectorResult;
+		if constexpr (rounding == FixedPointRounding::RoundHalfUp && numberOfStorageBits == 16 && numberOfBits == 16 && numberOfFractionalBits == 15)
+		{
+			vectorResult = _mm512_mulhrs_epi16(vector1, vector2);
+		}
+		else if constexpr (numberOfStorageBits == 16)
+		{
+			__m512i lowHalf = _mm512_mullo_epi16(vector1, vector2);
+			__m512i highHalf = _mm512_mulhi_epi16(vector1, vector2);
+			vectorResult = lowHalf;
+			if constexpr (numberOfFractionalBits > 0)
+			{
+				__m512i bias = _mm512_setzero_si512();
+				if constexpr (rounding == FixedPointRounding::Truncate)
+				{
+					bias = _mm512_and_si512(_mm512_srai_epi16(highHalf, 15), _mm512_set1_epi16(static_cast<short>(2 * halfLeastSignificantBit - 1)));
+				}
+				else if constexpr (rounding == FixedPointRounding::RoundHalfUp)
+				{
+					bias = _mm512_set1_epi16(static_cast<short>(halfLeastSignificantBit));
+				}
+				else if constexpr (rounding == FixedPointRounding::RoundHalfEven)
+				{
+					__m512i leastSignificantBit = numberOfFractionalBits == 16 ? highHalf : _mm512_srli_epi16(lowHalf, numberOfFractionalBits);
+					bias = _mm512_add_epi16(_mm512_set1_epi16(static_cast<short>(halfLeastSignificantBit - 1)), _mm512_and_si512(leastSignificantBit, _mm512_set1_epi16(1)));
+				}
+				__m512i roundedLowHalf = _mm512_add_epi16(lowHalf, bias);
+				__m512i carry = _mm512_srli_epi16(_mm512_or_si512(_mm512_and_si512(lowHalf, bias), _mm512_andnot_si512(roundedLowHalf, _mm512_or_si512(lowHalf, bias))), 15);
+				highHalf = _mm512_add_epi16(highHalf, carry);
+				vectorResult = _mm512_or_si512(_mm512_srli_epi16(roundedLowHalf, numberOfFractionalBits), _mm512_slli_epi16(highHalf, 16 - numberOfFractionalBits));
+			}
+			if constexpr (numberOfBits < numberOfStorageBits)
+			{
+				vectorResult = _mm512_srai_epi16(_mm512_slli_epi16(vectorResult, numberOfStorageBits - numberOfBits), numberOfStorageBits - numberOfBits);
+			}
+		}
+		else
+		{
+			__m512i evenProducts = _mm512_mul_epi32(vector1, vector2);
+			__m512i oddProducts = _mm512_mul_epi32(_mm512_srli_epi64(vector1, 32), _mm512_srli_epi64(vector2, 32));
+			evenProducts = _mm512_add_epi64(evenProducts, productRoundingBiasAvx512<rounding>(evenProducts));
+			oddProducts = _mm512_add_epi64(oddProducts, productRoundingBiasAvx512<rounding>(oddProducts));
+			evenProducts = _mm512_srli_epi64(evenProducts, numberOfFractionalBits);
+			oddProducts = _mm512_slli_epi64(_mm512_srli_epi64(oddProducts, numberOfFractionalBits), 32);
+			vectorResult = _mm512_mask_blend_epi32(0xAAAA, evenProducts, oddProducts);
+			if constexpr (numberOfBits < numberOfStorageBits)
+			{
+				vectorResult = _mm512_srai_epi32(_mm512_slli_epi32(vectorResult, numberOfStorageBits - numberOfBits), numberOfStorageBits - numberOfBits);
+			}
+		}
+		_mm512_storeu_si512(result + index, vectorResult);
+	}
+	return index;
+}
+/**
+ * @brief Shift raw values right 64 bytes at a time with AVX-512, rounding like the scalar shiftRight.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam rounding Any rounding but FixedPointRounding::Stochastic.
+ * @details The floor is an arithmetic shift; the rounding bit, the sticky bits below it and the discarded bits are
+ * tested into lane masks that select which lanes add one.
+ * @param values
+ * @param amountToShift At least 1.
+ * @param result
+ * @param numberOfValues
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <FixedPointRounding rounding>
+__attribute__((target("avx512f,avx512bw"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::shiftRightAvx512(const StorageType* values, int amountToShift, StorageType* result, std::size_t numberOfValues)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m512i) / sizeof(StorageType);
+	__m128i shiftCount = _mm_cvtsi32_si128(amountToShift);
+	__m128i roundingBitCount = _mm_cvtsi32_si128(amountToShift - 1);
+	StorageType stickyBits = amountToShift - 1 < numberOfStorageBits ? static_cast<StorageType>((1LL << (amountToShift - 1)) - 1) : static_cast<StorageType>(-1);
+	StorageType discardedBits = amountToShift < numberOfStorageBits ? static_cast<StorageType>((1LL << amountToShift) - 1) : static_cast<StorageType>(-1);
+	__m512i stickyMask = numberOfStorageBits == 16 ? _mm512_set1_epi16(static_cast<short>(stickyBits)) : _mm512_set1_epi32(static_cast<int>(stickyBits));
+	__m512i discardedMask = numberOfStorageBits == 16 ? _mm512_set1_epi16(static_cast<short>(discardedBits)) : _mm512_set1_epi32(static_cast<int>(discardedBits));
+	std::size_t index = 0;
+	for (; index + numberOfLanes <= numberOfValues; index += numberOfLanes)
+	{
+		__m512i vector = _mm512_loadu_si512(values + index);
+		__m512i vectorResult;
+		if constexpr (numberOfStorageBits == 16)
+		{
+			__m512i floor = _mm512_sra_epi16(vector, shiftCount);
+			__mmask32 isRoundedUp = 0;
+			if constexpr (rounding == FixedPointRounding::Truncate)
+			{
+				isRoundedUp = _mm512_cmplt_epi16_mask(vector, _mm512_setzero_si512()) & _mm512_test_epi16_mask(vector, discardedMask);
+			}
+			else if constexpr (rounding == FixedPointRounding::RoundHalfUp)
+			{
+				isRoundedUp = _mm512_test_epi16_mask(_mm512_sra_epi16(vector, roundingBitCount), _mm512_set1_epi16(1));
+			}
+			else if constexpr (rounding == FixedPointRounding::RoundHalfEven)
+			{
+				isRoundedUp = _mm512_test_epi16_mask(_mm512_sra_epi16(vector, roundingBitCount), _mm512_set1_epi16(1)) & (_mm512_test_epi16_mask(vector, stickyMask) | _mm512_test_epi16_mask(floor, _mm512_set1_epi16(1)));
+			}
+			vectorResult = _mm512_mask_add_epi16(floor, isRoundedUp, floor, _mm512_set1_epi16(1));
+		}
+		else
+		{
+			__m512i floor = _mm512_sra_epi32(vector, shiftCount);
+			__mmask16 isRoundedUp = 0;
+			if constexpr (rounding == FixedPointRounding::Truncate)
+			{
+				isRoundedUp = _mm512_cmplt_epi32_mask(vector, _mm512_setzero_si512()) & _mm512_test_epi32_mask(vector, discardedMask);
+			}
+			else if constexpr (rounding == FixedPointRounding::RoundHalfUp)
+			{
+				isRoundedUp = _mm512_test_epi32_mask(_mm512_sra_epi32(vector, roundingBitCount), _mm512_set1_epi32(1));
+			}
+			else if constexpr (rounding == FixedPointRounding::RoundHalfEven)
+			{
+				isRoundedUp = _mm512_test_epi32_mask(_mm512_sra_epi32(vector, roundingBitCount), _mm512_set1_epi32(1)) & (_mm512_test_epi32_mask(vector, stickyMask) | _mm512_test_epi32_mask(floor, _mm512_set1_epi32(1)));
+			}
+			vectorResult = _mm512_mask_add_epi32(floor, isRoundedUp, floor, _mm512_set1_epi32(1));
+		}
+		_mm512_storeu_si512(result + index, vectorResult);
+	}
+	return index;
+}
+/**
+ * @brief Round 128-bit vector of scaled doubles to raw values with SSE4.1, like fromDouble.
+ * @details NaN lanes become zero and the rest are clamped to the range of the format before rounding, which matches the
+ * saturation of fromDouble because the bounds are integers. Round half up adds one half and takes the floor, which is
+ * exact because the clamped values are far below 2^52.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam rounding Any rounding but FixedPointRounding::Stochastic.
+ * @param scaledValues Values already scaled by 2^numberOfFractionalBits.
+ * @return __m128i The raw values as 32-bit integers in the low half.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <FixedPointRounding rounding>
+__attribute__((target("sse4.1"))) __m128i FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::roundToRawSse41(__m128d scaledValues)
+{
+	scaledValues = _mm_and_pd(scaledValues, _mm_cmpord_pd(scaledValues, scaledValues));
+	scaledValues = _mm_min_pd(_mm_max_pd(scaledValues, _mm_set1_pd(static_cast<double>(smallestRawValue))), _mm_set1_pd(static_cast<double>(largestRawValue)));
+	__m128d roundedValues;
+	if constexpr (rounding == FixedPointRounding::Truncate)
+	{
+		roundedValues = _mm_round_pd(scaledValues, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+	}
+	else if constexpr (rounding == FixedPointRounding::Floor)
+	{
+		roundedValues = _mm_round_pd(scaledValues, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+	}
+	else if constexpr (rounding == FixedPointRounding::RoundHalfUp)
+	{
+		roundedValues = _mm_round_pd(_mm_add_pd(scaledValues, _mm_set1_pd(0.5)), _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+	}
+	else
+	{
+		roundedValues = _mm_round_pd(scaledValues, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+	}
+	return _mm_cvttpd_epi32(roundedValues);
+}
+/**
+ * @brief Quantize floats four at a time with SSE4.1, widening each to double so that the scaling rounds like the
+ * scalar reference.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam rounding Any rounding but FixedPointRounding::Stochastic.
+ * @param values
+ * @param scaleFactor 2^numberOfFractionalBits divided by the quantization scale.
+ * @param result
+ * @param numberOfValues
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <FixedPointRounding rounding>
+__attribute__((target("sse4.1"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::quantizeSse41(const float* values, double scaleFactor, StorageType* result, std::size_t numberOfValues)
+{
+	const __m128d vectorScaleFactor = _mm_set1_pd(scaleFactor);
+	std::size_t index = 0;
+	for (; index + 4 <= numberOfValues; index += 4)
+	{
+		__m128 vector = _mm_loadu_ps(values + index);
+		__m128i lowHalf = roundToRawSse41<rounding>(_mm_mul_pd(_mm_cvtps_pd(vector), vectorScaleFactor));
+		__m128i highHalf = roundToRawSse41<rounding>(_mm_mul_pd(_mm_cvtps_pd(_mm_movehl_ps(vector, vector)), vectorScaleFactor));
+		__m128i quantizedValues = _mm_unpacklo_epi64(lowHalf, highHalf);
+		if constexpr (numberOfStorageBits == 16)
+		{
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(result + index), _mm_packs_epi32(quantizedValues, quantizedValues));
+		}
+		else
+		{
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(result + index), quantizedValues);
+		}
+	}
+	return index;
+}
+/**
+ * @brief Dequantize raw values four at a time with SSE4.1, scaling in double and rounding once to float like the
+ * scalar reference.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param scaleFactor The quantization scale times 2^-numberOfFractionalBits.
+ * @param result
+ * @param numberOfValues
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("sse4.1"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::dequantizeSse41(const StorageType* values, double scaleFactor, float* result, std::size_t numberOfValues)
+{
+	const __m128d vectorScaleFactor = _mm_set1_pd(scaleFactor);
+	std::size_t index = 0;
+	for (; index + 4 <= numberOfValues; index += 4)
+	{
+		__m128i vector;
+		if constexpr (numberOfStorageBits == 16)
+		{
+			vector = _mm_cvtepi16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(values + index)));
+		}
+		else
+		{
+			vector = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + index));
+		}
+		__m128 lowHalf = _mm_cvtpd_ps(_mm_mul_pd(_mm_cvtepi32_pd(vector), vectorScaleFactor));
+		__m128 highHalf = _mm_cvtpd_ps(_mm_mul_pd(_mm_cvtepi32_pd(_mm_unpackhi_epi64(vector, vector)), vectorScaleFactor));
+		_mm_storeu_ps(result + index, _mm_movelh_ps(lowHalf, highHalf));
+	}
+	return index;
+}
+/**
+ * @brief Round 256-bit vector of scaled doubles to raw values with AVX2, like fromDouble.
+ * @details NaN lanes become zero and the rest are clamped to the range of the format before rounding, which matches the
+ * saturation of fromDouble because the bounds are integers. Round half up adds one half and takes the floor, which is
+ * exact because the clamped values are far below 2^52.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam rounding Any rounding but FixedPointRounding::Stochastic.
+ * @param scaledValues Values already scaled by 2^numberOfFractionalBits.
+ * @return __m128i The raw values as 32-bit integers.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <FixedPointRounding rounding>
+__attribute__((target("avx2"))) __m128i FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::roundToRawAvx2(__m256d scaledValues)
+{
+	scaledValues = _mm256_and_pd(scaledValues, _mm256_cmp_pd(scaledValues, scaledValues, _CMP_ORD_Q));
+	scaledValues = _mm256_min_pd(_mm256_max_pd(scaledValues, _mm256_set1_pd(static_cast<double>(smallestRawValue))), _mm256_set1_pd(static_cast<double>(largestRawValue)));
+	__m256d roundedValues;
+	if constexpr (rounding == FixedPointRounding::Truncate)
+	{
+		roundedValues = _mm256_round_pd(scaledValues, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+	}
+	else if constexpr (rounding == FixedPointRounding::Floor)
+	{
+		roundedValues = _mm256_round_pd(scaledValues, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+	}
+	else if constexpr (rounding == FixedPointRounding::RoundHalfUp)
+	{
+		roundedValues = _mm256_round_pd(_mm256_add_pd(scaledValues, _mm256_set1_pd(0.5)), _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+	}
+	else
+	{
+		roundedValues = _mm256_round_pd(scaledValues, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+	}
+	return _mm256_cvttpd_epi32(roundedValues);
+}
+/**
+ * @brief Quantize floats eight at a time with AVX2, widening each to double so that the scaling rounds like the scalar
+ * reference.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam rounding Any rounding but FixedPointRounding::Stochastic.
+ * @param values
+ * @param scaleFactor 2^numberOfFractionalBits divided by the quantization scale.
+ * @param result
+ * @param numberOfValues
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <FixedPointRounding rounding>
+__attribute__((target("avx2"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::quantizeAvx2(const float* values, double scaleFactor, StorageType* result, std::size_t numberOfValues)
+{
+	const __m256d vectorScaleFactor = _mm256_set1_pd(scaleFactor);
+	std::size_t index = 0;
+	for (; index + 8 <= numberOfValues; index += 8)
+	{
+		__m256 vector = _mm256_loadu_ps(values + index);
+		__m128i lowHalf = roundToRawAvx2<rounding>(_mm256_mul_pd(_mm256_cvtps_pd(_mm256_castps256_ps128(vector)), vectorScaleFactor));
+		__m128i highHalf = roundToRawAvx2<rounding>(_mm256_mul_pd(_mm256_cvtps_pd(_mm256_extractf128_ps(vector, 1)), vectorScaleFactor));
+		if constexpr (numberOfStorageBits == 16)
+		{
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(result + index), _mm_packs_epi32(lowHalf, highHalf));
+		}
+		else
+		{
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(result + index), _mm256_set_m128i(highHalf, lowHalf));
+		}
+	}
+	return index;
+}
+/**
+ * @brief Dequantize raw values eight at a time with AVX2, scaling in double and rounding once to float like the scalar
+ * reference.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param scaleFactor The quantization scale times 2^-numberOfFractionalBits.
+ * @param result
+ * @param numberOfValues
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx2"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::dequantizeAvx2(const StorageType* values, double scaleFactor, float* result, std::size_t numberOfValues)
+{
+	const __m256d vectorScaleFactor = _mm256_set1_pd(scaleFactor);
+	std::size_t index = 0;
+	for (; index + 8 <= numberOfValues; index += 8)
+	{
+		__m256i vector;
+		if constexpr (numberOfStorageBits == 16)
+		{
+			vector = _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(values + index)));
+		}
+		else
+		{
+			vector = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + index));
+		}
+		__m128 lowHalf = _mm256_cvtpd_ps(_mm256_mul_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(vector)), vectorScaleFactor));
+		__m128 highHalf = _mm256_cvtpd_ps(_mm256_mul_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(vector, 1)), vectorScaleFactor));
+		_mm256_storeu_ps(result + index, _mm256_set_m128(highHalf, lowHalf));
+	}
+	return index;
+}
+/**
+ * @brief Round 512-bit vector of scaled doubles to raw values with AVX-512, like fromDouble.
+ * @details NaN lanes become zero and the rest are clamped to the range of the format before rounding, which matches the
+ * saturation of fromDouble because the bounds are integers. Round half up adds one half and takes the floor, which is
+ * exact because the clamped values are far below 2^52.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam rounding Any rounding but FixedPointRounding::Stochastic.
+ * @param scaledValues Values already scaled by 2^numberOfFractionalBits.
+ * @return __m256i The raw values as 32-bit integers.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <FixedPointRounding rounding>
+__attribute__((target("avx512f,avx512bw"))) __m256i FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::roundToRawAvx512(__m512d scaledValues)
+{
+	scaledValues = _mm512_maskz_mov_pd(_mm512_cmp_pd_mask(scaledValues, scaledValues, _CMP_ORD_Q), scaledValues);
+	scaledValues = _mm512_min_pd(_mm512_max_pd(scaledValues, _mm512_set1_pd(static_cast<double>(smallestRawValue))), _mm512_set1_pd(static_cast<double>(largestRawValue)));
+	__m512d roundedValues;
+	if constexpr (rounding == FixedPointRounding::Truncate)
+	{
+		roundedValues = _mm512_roundscale_pd(scaledValues, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+	}
+	else if constexpr (rounding == FixedPointRounding::Floor)
+	{
+		roundedValues = _mm512_roundscale_pd(scaledValues, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+	}
+	else if constexpr (rounding == FixedPointRounding::RoundHalfUp)
+	{
+		roundedValues = _mm512_roundscale_pd(_mm512_add_pd(scaledValues, _mm512_set1_pd(0.5)), _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+	}
+	else
+	{
+		roundedValues = _mm512_roundscale_pd(scaledValues, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+	}
+	return _mm512_cvttpd_epi32(roundedValues);
+}
+/**
+ * @brief Quantize floats sixteen at a time with AVX-512, widening each to double so that the scaling rounds like the
+ * scalar reference.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam rounding Any rounding but FixedPointRounding::Stochastic.
+ * @details The 16-bit pack works within 128-bit lanes, so a cross-lane permute restores the element order.
+ * @param values
+ * @param scaleFactor 2^numberOfFractionalBits divided by the quantization scale.
+ * @param result
+ * @param numberOfValues
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <FixedPointRounding rounding>
+__attribute__((target("avx512f,avx512bw"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::quantizeAvx512(const float* values, double scaleFactor, StorageType* result, std::size_t numberOfValues)
+{
+	const __m512d vectorScaleFactor = _mm512_set1_pd(scaleFactor);
+	std::size_t index = 0;
+	for (; index + 16 <= numberOfValues; index += 16)
+	{
+		__m256i lowHalf = roundToRawAvx512<rounding>(_mm512_mul_pd(_mm512_cvtps_pd(_mm256_loadu_ps(values + index)), vectorScaleFactor));
+		__m256i highHalf = roundToRawAvx512<rounding>(_mm512_mul_pd(_mm512_cvtps_pd(_mm256_loadu_ps(values + index + 8)), vectorScaleFactor));
+		if constexpr (numberOfStorageBits == 16)
+		{
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(result + index), _mm256_permute4x64_epi64(_mm256_packs_epi32(lowHalf, highHalf), 0xD8));
+		}
+		else
+		{
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(result + index), lowHalf);
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(result + index + 8), highHalf);
+		}
+	}
+	return index;
+}
+/**
+ * @brief Dequantize raw values sixteen at a time with AVX-512, scaling in double and rounding once to float like the
+ * scalar reference.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param scaleFactor The quantization scale times 2^-numberOfFractionalBits.
+ * @param result
+ * @param numberOfValues
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx512f,avx512bw"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::dequantizeAvx512(const StorageType* values, double scaleFactor, float* result, std::size_t numberOfValues)
+{
+	const __m512d vectorScaleFactor = _mm512_set1_pd(scaleFactor);
+	std::size_t index = 0;
+	for (; index + 16 <= numberOfValues; index += 16)
+	{
+		__m512i vector;
+		if constexpr (numberOfStorageBits == 16)
+		{
+			vector = _mm512_cvtepi16_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + index)));
+		}
+		else
+		{
+			vector = _mm512_loadu_si512(values + index);
+		}
+		_mm256_storeu_ps(result + index, _mm512_cvtpd_ps(_mm512_mul_pd(_mm512_cvtepi32_pd(_mm512_castsi512_si256(vector)), vectorScaleFactor)));
+		_mm256_storeu_ps(result + index + 8, _mm512_cvtpd_ps(_mm512_mul_pd(_mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(vector, 1)), vectorScaleFactor)));
+	}
+	return index;
+}
+/**
+ * @brief Find the smallest and largest raw values 64 bytes at a time with AVX-512.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param numberOfValues
+ * @param minimum Running minimum, updated in place when at least one full vector is processed.
+ * @param maximum Running maximum, updated in place when at least one full vector is processed.
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx512f,avx512bw"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::minimumAndMaximumAvx512(const StorageType* values, std::size_t numberOfValues, StorageType &minimum, StorageType &maximum)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m512i) / sizeof(StorageType);
+	__m512i vectorMinimum;
+	__m512i vectorMaximum;
+	if constexpr (numberOfStorageBits == 16)
+	{
+		vectorMinimum = _mm512_set1_epi16(static_cast<short>(minimum));
+		vectorMaximum = _mm512_set1_epi16(static_cast<short>(maximum));
+	}
+	else
+	{
+		vectorMinimum = _mm512_set1_epi32(static_cast<int>(minimum));
+		vectorMaximum = _mm512_set1_epi32(static_cast<int>(maximum));
+	}
+	std::size_t index = 0;
+	for (; index + numberOfLanes <= numberOfValues; index += numberOfLanes)
+	{
+		__m512i vector = _mm512_loadu_si512(values + index);
+		if constexpr (numberOfStorageBits == 16)
+		{
+			vectorMinimum = _mm512_min_epi16(vectorMinimum, vector);
+			vectorMaximum = _mm512_max_epi16(vectorMaximum, vector);
+		}
+		else
+		{
+			vectorMinimum = _mm512_min_epi32(vectorMinimum, vector);
+			vectorMaximum = _mm512_max_epi32(vectorMaximum, vector);
+		}
+	}
+	alignas(__m512i) StorageType laneMinimums[numberOfLanes];
+	alignas(__m512i) StorageType laneMaximums[numberOfLanes];
+	_mm512_storeu_si512(laneMinimums, vectorMinimum);
+	_mm512_storeu_si512(laneMaximums, vectorMaximum);
+	minimumAndMaximumScalar(laneMinimums, 0, numberOfLanes, minimum, maximum);
+	minimumAndMaximumScalar(laneMaximums, 0, numberOfLanes, minimum, maximum);
+	return index;
+}
+/**
+ * @brief Search for a raw value 64 bytes at a time with AVX-512.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param numberOfValues
+ * @param value
+ * @return std::size_t Start of the first vector containing a match, or the number of elements processed if no vector
+ * matched; either way the caller finishes the search from there.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx512f,avx512bw"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::indexOfAvx512(const StorageType* values, std::size_t numberOfValues, StorageType value)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m512i) / sizeof(StorageType);
+	__m512i vectorValue;
+	if constexpr (numberOfStorageBits == 16)
+	{
+		vectorValue = _mm512_set1_epi16(static_cast<short>(value));
+	}
+	else
+	{
+		vectorValue = _mm512_set1_epi32(static_cast<int>(value));
+	}
+	std::size_t index = 0;
+	for (; index + numberOfLanes <= numberOfValues; index += numberOfLanes)
+	{
+		__m512i vector = _mm512_loadu_si512(values + index);
+		bool isFound;
+		if constexpr (numberOfStorageBits == 16)
+		{
+			isFound = _mm512_cmpeq_epi16_mask(vector, vectorValue) != 0;
+		}
+		else
+		{
+			isFound = _mm512_cmpeq_epi32_mask(vector, vectorValue) != 0;
+		}
+		if (isFound)
+		{
+			return index;
+		}
+	}
+	return index;
+}
+/**
+ * @brief Accumulate the exact products of raw values 64 bytes at a time with AVX-512.
+ * @details 16-bit formats multiply and add pairs with madd and widen the pair sums to 64-bit lanes; the only pair sum
+ * that overflows 32 bits, 2^31 from two products of the most negative value, is corrected after widening. 32-bit
+ * formats split every 64-bit product into its low and high 32-bit halves and count the negative products, so the
+ * 64-bit lanes cannot overflow within a block. The lanes are folded into the accumulator after every block.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values1
+ * @param values2
+ * @param numberOfValues
+ * @param accumulator Exact sum of products with 2 * numberOfFractionalBits fractional bits, updated in place.
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx512f,avx512bw"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::dotAvx512(const StorageType* values1, const StorageType* values2, std::size_t numberOfValues, AccumulatorType &accumulator)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m512i) / sizeof(StorageType);
+	constexpr std::size_t numberOfLanes64 = sizeof(__m512i) / sizeof(int64_t);
+	std::size_t index = 0;
+	while (index + numberOfLanes <= numberOfValues)
+	{
+		std::size_t blockEnd = numberOfValues - index > accumulationBlockSize ? index + accumulationBlockSize : numberOfValues;
+		if constexpr (numberOfStorageBits == 16)
+		{
+			const __m512i pairSumOverflow = _mm512_set1_epi64(static_cast<long long>(INT32_MIN));
+			const __m512i pairSumCorrection = _mm512_set1_epi64(static_cast<long long>(1) << 32);
+			__m512i sums = _mm512_setzero_si512();
+			for (; index + numberOfLanes <= blockEnd; index += numberOfLanes)
+			{
+				__m512i pairSums = _mm512_madd_epi16(_mm512_loadu_si512(values1 + index), _mm512_loadu_si512(values2 + index));
+				__m512i lowPairSums = _mm512_cvtepi32_epi64(_mm512_castsi512_si256(pairSums));
+				__m512i highPairSums = _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(pairSums, 1));
+				if constexpr (numberOfBits == 16)
+				{
+					lowPairSums = _mm512_mask_add_epi64(lowPairSums, _mm512_cmpeq_epi64_mask(lowPairSums, pairSumOverflow), lowPairSums, pairSumCorrection);
+					highPairSums = _mm512_mask_add_epi64(highPairSums, _mm512_cmpeq_epi64_mask(highPairSums, pairSumOverflow), highPairSums, pairSumCorrection);
+				}
+				sums = _mm512_add_epi64(sums, _mm512_add_epi64(lowPairSums, highPairSums));
+			}
+			alignas(__m512i) int64_t laneSums[numberOfLanes64];
+			_mm512_storeu_si512(laneSums, sums);
+			for (std::size_t lane = 0; lane < numberOfLanes64; lane++)
+			{
+				accumulator = static_cast<AccumulatorType>(accumulator + static_cast<AccumulatorType>(laneSums[lane]));
+			}
+		}
+		else
+		{
+			const __m512i lowHalfMask = _mm512_set1_epi64(0xFFFFFFFFLL);
+			__m512i lowSums = _mm512_setzero_si512();
+			__m512i highSums = _mm512_setzero_si512();
+			__m512i negativeCounts = _mm512_setzero_si512();
+			for (; index + numberOfLanes <= blockEnd; index += numberOfLanes)
+			{
+				__m512i vector1 = _mm512_loadu_si512(values1 + index);
+				__m512i vector2 = _mm512_loadu_si512(values2 + index);
+				__m512i evenProducts = _mm512_mul_epi32(vector1, vector2);
+				__m512i oddProducts = _mm512_mul_epi32(_mm512_srli_epi64(vector1, 32), _mm512_srli_epi64(vector2, 32));
+				lowSums = _mm512_add_epi64(lowSums, _mm512_add_epi64(_mm512_and_si512(evenProducts, lowHalfMask), _mm512_and_si512(oddProducts, lowHalfMask)));
+				highSums = _mm512_add_epi64(highSums, _mm512_add_epi64(_mm512_srli_epi64(evenProducts, 32), _mm512_srli_epi64(oddProducts, 32)));
+				negativeCounts = _mm512_add_epi64(negativeCounts, _mm512_add_epi64(_mm512_srli_epi64(evenProducts, 63), _mm512_srli_epi64(oddProducts, 63)));
+			}
+			alignas(__m512i) uint64_t laneLowSums[numberOfLanes64];
+			alignas(__m512i) uint64_t laneHighSums[numberOfLanes64];
+			alignas(__m512i) uint64_t laneNegativeCounts[numberOfLanes64];
+			_mm512_storeu_si512(laneLowSums, lowSums);
+			_mm512_storeu_si512(laneHighSums, highSums);
+			_mm512_storeu_si512(laneNegativeCounts, negativeCounts);
+			for (std::size_t lane = 0; lane < numberOfLanes64; lane++)
+			{
+				accumulator = static_cast<AccumulatorType>(accumulator + static_cast<AccumulatorType>(laneLowSums[lane]) + static_cast<AccumulatorType>(static_cast<AccumulatorType>(laneHighSums[lane]) << 32) - static_cast<AccumulatorType>(static_cast<AccumulatorType>(laneNegativeCounts[lane]) << 64));
+			}
+		}
+	}
+	return index;
+}
+/**
+ * @brief Accumulate the exact sum of raw values 64 bytes at a time with AVX-512, widening to 64-bit lanes.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param numberOfValues
+ * @param accumulator Exact sum with numberOfFractionalBits fractional bits, updated in place.
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx512f,avx512bw"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::sumAvx512(const StorageType* values, std::size_t numberOfValues, AccumulatorType &accumulator)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m512i) / sizeof(StorageType);
+	constexpr std::size_t numberOfLanes64 = sizeof(__m512i) / sizeof(int64_t);
+	std::size_t index = 0;
+	while (index + numberOfLanes <= numberOfValues)
+	{
+		std::size_t blockEnd = numberOfValues - index > accumulationBlockSize ? index + accumulationBlockSize : numberOfValues;
+		__m512i sums = _mm512_setzero_si512();
+		for (; index + numberOfLanes <= blockEnd; index += numberOfLanes)
+		{
+			__m512i vector = _mm512_loadu_si512(values + index);
+			if constexpr (numberOfStorageBits == 16)
+			{
+				vector = _mm512_madd_epi16(vector, _mm512_set1_epi16(1));
+			}
+			sums = _mm512_add_epi64(sums, _mm512_add_epi64(_mm512_cvtepi32_epi64(_mm512_castsi512_si256(vector)), _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(vector, 1))));
+		}
+		alignas(__m512i) int64_t laneSums[numberOfLanes64];
+		_mm512_storeu_si512(laneSums, sums);
+		for (std::size_t lane = 0; lane < numberOfLanes64; lane++)
+		{
+			accumulator = static_cast<AccumulatorType>(accumulator + static_cast<AccumulatorType>(laneSums[lane]));
+		}
+	}
+	return index;
+}
+/**
+ * @brief Load four raw values with AVX2, sign-extended to 64-bit lanes.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @return __m256i
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx2"))) __m256i FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::loadWidenedAvx2(const StorageType* values)
+{
+	if constexpr (numberOfStorageBits == 16)
+	{
+		return _mm256_cvtepi16_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(values)));
+	}
+	else
+	{
+		return _mm256_cvtepi32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(values)));
+	}
+}
+/**
+ * @brief Store four 64-bit lanes that are already in the range of the format as raw values with AVX2.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param result
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx2"))) void FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::storeNarrowedAvx2(__m256i values, StorageType* result)
+{
+	__m128i narrowedValues = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(values, _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6)));
+	if constexpr (numberOfStorageBits == 16)
+	{
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(result), _mm_packs_epi32(narrowedValues, narrowedValues));
+	}
+	else
+	{
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(result), narrowedValues);
+	}
+}
+/**
+ * @brief Shift 64-bit lanes right arithmetically with AVX2, which has no 64-bit arithmetic shift.
+ * @details The lanes are complemented around a logical shift wherever they are negative.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param amountsToShift Per-lane amounts; amounts above 63 give the sign of the lane.
+ * @return __m256i
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx2"))) __m256i FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::shiftRightArithmeticAvx2(__m256i values, __m256i amountsToShift)
+{
+	__m256i signs = _mm256_cmpgt_epi64(_mm256_setzero_si256(), values);
+	return _mm256_xor_si256(_mm256_srlv_epi64(_mm256_xor_si256(values, signs), amountsToShift), signs);
+}
+/**
+ * @brief Negate the 64-bit lanes selected by a mask with AVX2.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param mask All ones in the lanes to negate and zero elsewhere.
+ * @return __m256i
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx2"))) __m256i FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::negateWhereAvx2(__m256i values, __m256i mask)
+{
+	return _mm256_sub_epi64(_mm256_xor_si256(values, mask), mask);
+}
+/**
+ * @brief Multiply 64-bit lanes holding raw values by a positive 64-bit constant into exact 128-bit products with AVX2.
+ * @details The constant is split into 32-bit halves, each multiplied by the low half of the lane, and the unsigned
+ * multiply of the low half is corrected for negative lanes, so the products equal the scalar 128-bit products.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values Lanes in the range of a 32-bit signed integer.
+ * @param constant
+ * @param high Receives the upper 64 bits of the products.
+ * @param low Receives the lower 64 bits of the products.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx2"))) void FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::multiplyByConstantAvx2(__m256i values, int64_t constant, __m256i &high, __m256i &low)
+{
+	const __m256i lowHalf = _mm256_set1_epi64x(constant & 0xFFFFFFFF);
+	const __m256i signBit = _mm256_set1_epi64x(std::numeric_limits<int64_t>::min());
+	__m256i highProducts = _mm256_mul_epi32(values, _mm256_set1_epi64x(constant >> 32));
+	highProducts = _mm256_sub_epi64(highProducts, _mm256_and_si256(_mm256_cmpgt_epi64(_mm256_setzero_si256(), values), lowHalf));
+	__m256i lowProducts = _mm256_mul_epu32(values, lowHalf);
+	low = _mm256_add_epi64(_mm256_slli_epi64(highProducts, 32), lowProducts);
+	__m256i carries = _mm256_cmpgt_epi64(_mm256_xor_si256(lowProducts, signBit), _mm256_xor_si256(low, signBit));
+	high = _mm256_sub_epi64(shiftRightArithmeticAvx2(highProducts, _mm256_set1_epi64x(32)), carries);
+}
+/**
+ * @brief Count the significant bits of non-negative 64-bit lanes below 2^52 with AVX2, which has no 64-bit lzcnt.
+ * @details Each lane is converted exactly to a double by the magic-number trick, and the biased exponent of the double
+ * is the bit length plus 1022; zero lanes give -1022.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @return __m256i
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx2"))) __m256i FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::bitLengthAvx2(__m256i values)
+{
+	const __m256i magicNumber = _mm256_set1_epi64x(0x4330000000000000);
+	__m256d convertedValues = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(values, magicNumber)), _mm256_castsi256_pd(magicNumber));
+	return _mm256_sub_epi64(_mm256_srli_epi64(_mm256_castpd_si256(convertedValues), 52), _mm256_set1_epi64x(1022));
+}
+/**
+ * @brief Saturate 64-bit lanes to the range of the format with AVX2, which has no 64-bit minimum or maximum.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @return __m256i
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx2"))) __m256i FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::saturateAvx2(__m256i values)
+{
+	const __m256i largestValue = _mm256_set1_epi64x(static_cast<int64_t>(largestRawValue));
+	const __m256i smallestValue = _mm256_set1_epi64x(static_cast<int64_t>(smallestRawValue));
+	values = _mm256_blendv_epi8(values, largestValue, _mm256_cmpgt_epi64(values, largestValue));
+	return _mm256_blendv_epi8(values, smallestValue, _mm256_cmpgt_epi64(smallestValue, values));
+}
+/**
+ * @brief Round 64-bit lanes half up by per-lane shifts and saturate them to the range of the format with AVX2, like
+ * FixedPointNumber::fromScaledInteger.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param amountsToShift Per-lane amounts from 1 to 63.
+ * @return __m256i
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx2"))) __m256i FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::roundAndSaturateAvx2(__m256i values, __m256i amountsToShift)
+{
+	const __m256i one = _mm256_set1_epi64x(1);
+	values = _mm256_add_epi64(values, _mm256_sllv_epi64(one, _mm256_sub_epi64(amountsToShift, one)));
+	return saturateAvx2(shiftRightArithmeticAvx2(values, amountsToShift));
+}
+/**
+ * @brief Compute the sines or cosines of raw values four at a time with AVX2, one 64-bit lane per value.
+ * @details Runs the branchless circular CORDIC rotation of FixedPointNumber::sine in every lane, so the results are
+ * bit-exact with the scalar functions.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam isCosine Whether to compute cosines instead of sines.
+ * @param values
+ * @param result
+ * @param numberOfValues
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <bool isCosine>
+__attribute__((target("avx2"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::sineOrCosineAvx2(const StorageType* values, StorageType* result, std::size_t numberOfValues)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m256i) / sizeof(int64_t);
+	constexpr int numberOfIterations = fixedPointCordicIterations(numberOfFractionalBits);
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i roundingShift = _mm256_set1_epi64x(61 - numberOfFractionalBits);
+	std::size_t index = 0;
+	for (; index + numberOfLanes <= numberOfValues; index += numberOfLanes)
+	{
+		__m256i high;
+		__m256i low;
+		multiplyByConstantAvx2(loadWidenedAvx2(values + index), fixedPointInverseTwoPi, high, low);
+		__m256i turns = low;
+		if constexpr (numberOfFractionalBits > 2)
+		{
+			turns = _mm256_or_si256(_mm256_srli_epi64(low, numberOfFractionalBits - 2), _mm256_slli_epi64(high, 66 - numberOfFractionalBits));
+		}
+		__m256i isReflected = _mm256_cmpgt_epi64(zero, _mm256_add_epi64(turns, _mm256_set1_epi64x(static_cast<int64_t>(1) << 62)));
+		turns = _mm256_xor_si256(turns, _mm256_and_si256(isReflected, _mm256_set1_epi64x(std::numeric_limits<int64_t>::min())));
+		__m256i residualAngle = shiftRightArithmeticAvx2(turns, _mm256_set1_epi64x(2));
+		__m256i x = _mm256_set1_epi64x(fixedPointCordicCircularGains[numberOfIterations < 31 ? numberOfIterations : 31]);
+		__m256i y = zero;
+		for (int iteration = 0; iteration < numberOfIterations; iteration++)
+		{
+			const __m256i amountToShift = _mm256_set1_epi64x(iteration);
+			__m256i direction = _mm256_cmpgt_epi64(zero, residualAngle);
+			__m256i shiftedX = negateWhereAvx2(shiftRightArithmeticAvx2(x, amountToShift), direction);
+			x = _mm256_sub_epi64(x, negateWhereAvx2(shiftRightArithmeticAvx2(y, amountToShift), direction));
+			y = _mm256_add_epi64(y, shiftedX);
+			residualAngle = _mm256_sub_epi64(residualAngle, negateWhereAvx2(_mm256_set1_epi64x(fixedPointCordicCircularTurns[iteration]), direction));
+		}
+		__m256i vectorResult = negateWhereAvx2(isCosine ? x : y, isReflected);
+		storeNarrowedAvx2(roundAndSaturateAvx2(vectorResult, roundingShift), result + index);
+	}
+	return index;
+}
+/**
+ * @brief Compute e raised to the power of raw values four at a time with AVX2, one 64-bit lane per value.
+ * @details Runs the hyperbolic CORDIC rotation of FixedPointNumber::exponential in every lane and scales each result by
+ * its own power of two, so the results are bit-exact with the scalar function.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param result
+ * @param numberOfValues
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx2"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::exponentialAvx2(const StorageType* values, StorageType* result, std::size_t numberOfValues)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m256i) / sizeof(int64_t);
+	constexpr int numberOfIterations = fixedPointCordicIterations(numberOfBits);
+	const __m256i zero = _mm256_setzero_si256();
+	std::size_t index = 0;
+	for (; index + numberOfLanes <= numberOfValues; index += numberOfLanes)
+	{
+		__m256i high;
+		__m256i low;
+		multiplyByConstantAvx2(loadWidenedAvx2(values + index), fixedPointLog2E, high, low);
+		__m256i exponent = shiftRightArithmeticAvx2(high, _mm256_set1_epi64x(numberOfFractionalBits - 2));
+		__m256i residualAngle = _mm256_and_si256(_mm256_or_si256(_mm256_slli_epi64(high, 63 - numberOfFractionalBits), _mm256_srli_epi64(low, numberOfFractionalBits + 1)), _mm256_set1_epi64x((static_cast<int64_t>(1) << 61) - 1));
+		__m256i x = _mm256_set1_epi64x(fixedPointCordicHyperbolicGains[numberOfIterations < 31 ? numberOfIterations : 31]);
+		__m256i y = zero;
+		for (int iteration = 1; iteration <= numberOfIterations; iteration++)
+		{
+			for (int repetition = (iteration == 4 || iteration == 13 || iteration == 40) ? 0 : 1; repetition < 2; repetition++)
+			{
+				const __m256i amountToShift = _mm256_set1_epi64x(iteration);
+				__m256i direction = _mm256_cmpgt_epi64(zero, residualAngle);
+				__m256i shiftedX = negateWhereAvx2(shiftRightArithmeticAvx2(x, amountToShift), direction);
+				x = _mm256_add_epi64(x, negateWhereAvx2(shiftRightArithmeticAvx2(y, amountToShift), direction));
+				y = _mm256_add_epi64(y, shiftedX);
+				residualAngle = _mm256_sub_epi64(residualAngle, negateWhereAvx2(_mm256_set1_epi64x(fixedPointCordicHyperbolicAngles[iteration - 1]), direction));
+			}
+		}
+		__m256i vectorResult = roundAndSaturateAvx2(_mm256_add_epi64(x, y), _mm256_sub_epi64(_mm256_set1_epi64x(61 - numberOfFractionalBits), exponent));
+		vectorResult = _mm256_blendv_epi8(vectorResult, _mm256_set1_epi64x(static_cast<int64_t>(largestRawValue)), _mm256_cmpgt_epi64(exponent, _mm256_set1_epi64x(numberOfIntegerBits)));
+		vectorResult = _mm256_andnot_si256(_mm256_cmpgt_epi64(_mm256_set1_epi64x(-(numberOfFractionalBits + 2)), exponent), vectorResult);
+		storeNarrowedAvx2(vectorResult, result + index);
+	}
+	return index;
+}
+/**
+ * @brief Compute the base-2 logarithms of raw values four at a time with AVX2, one 64-bit lane per value.
+ * @details Runs the hyperbolic CORDIC vectoring of FixedPointNumber::logarithmBase2 in every lane, so the results are
+ * bit-exact with the scalar function. It stops before the first group of lanes holding a value that is not positive,
+ * so that the scalar loop throws for it.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param result
+ * @param numberOfValues
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx2"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::logarithmBase2Avx2(const StorageType* values, StorageType* result, std::size_t numberOfValues)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m256i) / sizeof(int64_t);
+	constexpr int numberOfIterations = fixedPointCordicIterations(numberOfFractionalBits);
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i mantissaOne = _mm256_set1_epi64x(static_cast<int64_t>(1) << 61);
+	std::size_t index = 0;
+	for (; index + numberOfLanes <= numberOfValues; index += numberOfLanes)
+	{
+		__m256i vector = loadWidenedAvx2(values + index);
+		if (_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(vector, zero))) != 0xF)
+		{
+			break;
+		}
+		__m256i length = bitLengthAvx2(vector);
+		__m256i mantissa = _mm256_sllv_epi64(vector, _mm256_sub_epi64(_mm256_set1_epi64x(62), length));
+		__m256i x = _mm256_add_epi64(mantissa, mantissaOne);
+		__m256i y = _mm256_sub_epi64(mantissa, mantissaOne);
+		__m256i halfLogarithm = zero;
+		for (int iteration = 1; iteration <= numberOfIterations; iteration++)
+		{
+			for (int repetition = (iteration == 4 || iteration == 13 || iteration == 40) ? 0 : 1; repetition < 2; repetition++)
+			{
+				const __m256i amountToShift = _mm256_set1_epi64x(iteration);
+				__m256i direction = _mm256_cmpgt_epi64(y, _mm256_set1_epi64x(-1));
+				__m256i shiftedX = negateWhereAvx2(shiftRightArithmeticAvx2(x, amountToShift), direction);
+				x = _mm256_add_epi64(x, negateWhereAvx2(shiftRightArithmeticAvx2(y, amountToShift), direction));
+				y = _mm256_add_epi64(y, shiftedX);
+				halfLogarithm = _mm256_sub_epi64(halfLogarithm, negateWhereAvx2(_mm256_set1_epi64x(fixedPointCordicHyperbolicAngles[iteration - 1]), direction));
+			}
+		}
+		__m256i fraction = _mm256_add_epi64(_mm256_add_epi64(halfLogarithm, halfLogarithm), _mm256_set1_epi64x(static_cast<int64_t>(1) << (60 - numberOfFractionalBits)));
+		fraction = shiftRightArithmeticAvx2(fraction, _mm256_set1_epi64x(61 - numberOfFractionalBits));
+		__m256i exponent = _mm256_slli_epi64(_mm256_sub_epi64(length, _mm256_set1_epi64x(1 + numberOfFractionalBits)), numberOfFractionalBits);
+		storeNarrowedAvx2(saturateAvx2(_mm256_add_epi64(exponent, fraction)), result + index);
+	}
+	return index;
+}
+/**
+ * @brief Compute the angles of points four at a time with AVX2, one 64-bit lane per point.
+ * @details Runs the circular CORDIC vectoring of FixedPointNumber::arcTangent2 in every lane, so the results are
+ * bit-exact with the scalar function.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param ordinates
+ * @param abscissas
+ * @param result
+ * @param numberOfValues
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx2"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::arcTangent2Avx2(const StorageType* ordinates, const StorageType* abscissas, StorageType* result, std::size_t numberOfValues)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m256i) / sizeof(int64_t);
+	constexpr int numberOfIterations = fixedPointCordicIterations(numberOfFractionalBits);
+	const __m256i zero = _mm256_setzero_si256();
+	std::size_t index = 0;
+	for (; index + numberOfLanes <= numberOfValues; index += numberOfLanes)
+	{
+		__m256i ordinate = loadWidenedAvx2(ordinates + index);
+		__m256i abscissa = loadWidenedAvx2(abscissas + index);
+		__m256i isLeftHalfPlane = _mm256_cmpgt_epi64(zero, abscissa);
+		__m256i angle = _mm256_and_si256(isLeftHalfPlane, negateWhereAvx2(_mm256_set1_epi64x(fixedPointPi), _mm256_cmpgt_epi64(zero, ordinate)));
+		abscissa = negateWhereAvx2(abscissa, isLeftHalfPlane);
+		ordinate = negateWhereAvx2(ordinate, isLeftHalfPlane);
+		__m256i magnitude = negateWhereAvx2(ordinate, _mm256_cmpgt_epi64(zero, ordinate));
+		magnitude = _mm256_blendv_epi8(abscissa, magnitude, _mm256_cmpgt_epi64(magnitude, abscissa));
+		__m256i normalizingShift = _mm256_sub_epi64(_mm256_set1_epi64x(61), bitLengthAvx2(magnitude));
+		__m256i x = _mm256_sllv_epi64(abscissa, normalizingShift);
+		__m256i y = _mm256_sllv_epi64(ordinate, normalizingShift);
+		for (int iteration = 0; iteration < numberOfIterations; iteration++)
+		{
+			const __m256i amountToShift = _mm256_set1_epi64x(iteration);
+			__m256i direction = _mm256_cmpgt_epi64(zero, y);
+			__m256i shiftedX = negateWhereAvx2(shiftRightArithmeticAvx2(x, amountToShift), direction);
+			x = _mm256_add_epi64(x, negateWhereAvx2(shiftRightArithmeticAvx2(y, amountToShift), direction));
+			y = _mm256_sub_epi64(y, shiftedX);
+			angle = _mm256_add_epi64(angle, negateWhereAvx2(_mm256_set1_epi64x(fixedPointCordicCircularRadians[iteration]), direction));
+		}
+		__m256i vectorResult = roundAndSaturateAvx2(angle, _mm256_set1_epi64x(60 - numberOfFractionalBits));
+		storeNarrowedAvx2(_mm256_andnot_si256(_mm256_cmpeq_epi64(magnitude, zero), vectorResult), result + index);
+	}
+	return index;
+}
+/**
+ * @brief Load eight raw values with AVX-512, sign-extended to 64-bit lanes.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @return __m512i
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx512f,avx512bw"))) __m512i FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::loadWidenedAvx512(const StorageType* values)
+{
+	if constexpr (numberOfStorageBits == 16)
+	{
+		return _mm512_cvtepi16_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(values)));
+	}
+	else
+	{
+		return _mm512_cvtepi32_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(values)));
+	}
+}
+/**
+ * @brief Store eight 64-bit lanes that are already in the range of the format as raw values with AVX-512.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param result
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx512f,avx512bw"))) void FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::storeNarrowedAvx512(__m512i values, StorageType* result)
+{
+	if constexpr (numberOfStorageBits == 16)
+	{
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(result), _mm512_cvtepi64_epi16(values));
+	}
+	else
+	{
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(result), _mm512_cvtepi64_epi32(values));
+	}
+}
+/**
+ * @brief Negate the 64-bit lanes selected by a mask with AVX-512.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param mask All ones in the lanes to negate and zero elsewhere.
+ * @return __m512i
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx512f,avx512bw"))) __m512i FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::negateWhereAvx512(__m512i values, __m512i mask)
+{
+	return _mm512_sub_epi64(_mm512_xor_si512(values, mask), mask);
+}
+/**
+ * @brief Multiply 64-bit lanes holding raw values by a positive 64-bit constant into exact 128-bit products with
+ * AVX-512, as multiplyByConstantAvx2 does.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values Lanes in the range of a 32-bit signed integer.
+ * @param constant
+ * @param high Receives the upper 64 bits of the products.
+ * @param low Receives the lower 64 bits of the products.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx512f,avx512bw"))) void FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::multiplyByConstantAvx512(__m512i values, int64_t constant, __m512i &high, __m512i &low)
+{
+	const __m512i lowHalf = _mm512_set1_epi64(constant & 0xFFFFFFFF);
+	__m512i highProducts = _mm512_mul_epi32(values, _mm512_set1_epi64(constant >> 32));
+	highProducts = _mm512_sub_epi64(highProducts, _mm512_and_si512(_mm512_srai_epi64(values, 63), lowHalf));
+	__m512i lowProducts = _mm512_mul_epu32(values, lowHalf);
+	low = _mm512_add_epi64(_mm512_slli_epi64(highProducts, 32), lowProducts);
+	high = _mm512_mask_add_epi64(_mm512_srai_epi64(highProducts, 32), _mm512_cmplt_epu64_mask(low, lowProducts), _mm512_srai_epi64(highProducts, 32), _mm512_set1_epi64(1));
+}
+/**
+ * @brief Count the significant bits of non-negative 64-bit lanes below 2^52 with AVX-512F, which has no 64-bit lzcnt,
+ * as bitLengthAvx2 does.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @return __m512i
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx512f,avx512bw"))) __m512i FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::bitLengthAvx512(__m512i values)
+{
+	const __m512i magicNumber = _mm512_set1_epi64(0x4330000000000000);
+	__m512d convertedValues = _mm512_sub_pd(_mm512_castsi512_pd(_mm512_or_si512(values, magicNumber)), _mm512_castsi512_pd(magicNumber));
+	return _mm512_sub_epi64(_mm512_srli_epi64(_mm512_castpd_si512(convertedValues), 52), _mm512_set1_epi64(1022));
+}
+/**
+ * @brief Saturate 64-bit lanes to the range of the format with AVX-512.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @return __m512i
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx512f,avx512bw"))) __m512i FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::saturateAvx512(__m512i values)
+{
+	return _mm512_max_epi64(_mm512_min_epi64(values, _mm512_set1_epi64(static_cast<int64_t>(largestRawValue))), _mm512_set1_epi64(static_cast<int64_t>(smallestRawValue)));
+}
+/**
+ * @brief Round 64-bit lanes half up by per-lane shifts and saturate them to the range of the format with AVX-512, like
+ * FixedPointNumber::fromScaledInteger.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param amountsToShift Per-lane amounts from 1 to 63.
+ * @return __m512i
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx512f,avx512bw"))) __m512i FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::roundAndSaturateAvx512(__m512i values, __m512i amountsToShift)
+{
+	const __m512i one = _mm512_set1_epi64(1);
+	values = _mm512_add_epi64(values, _mm512_sllv_epi64(one, _mm512_sub_epi64(amountsToShift, one)));
+	return saturateAvx512(_mm512_srav_epi64(values, amountsToShift));
+}
+/**
+ * @brief Compute the sines or cosines of raw values eight at a time with AVX-512, one 64-bit lane per value.
+ * @details Runs the branchless circular CORDIC rotation of FixedPointNumber::sine in every lane, so the results are
+ * bit-exact with the scalar functions.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam isCosine Whether to compute cosines instead of sines.
+ * @param values
+ * @param result
+ * @param numberOfValues
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <bool isCosine>
+__attribute__((target("avx512f,avx512bw"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::sineOrCosineAvx512(const StorageType* values, StorageType* result, std::size_t numberOfValues)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m512i) / sizeof(int64_t);
+	constexpr int numberOfIterations = fixedPointCordicIterations(numberOfFractionalBits);
+	const __m512i roundingShift = _mm512_set1_epi64(61 - numberOfFractionalBits);
+	std::size_t index = 0;
+	for (; index + numberOfLanes <= numberOfValues; index += numberOfLanes)
+	{
+		__m512i high;
+		__m512i low;
+		multiplyByConstantAvx512(loadWidenedAvx512(values + index), fixedPointInverseTwoPi, high, low);
+		__m512i turns = low;
+		if constexpr (numberOfFractionalBits > 2)
+		{
+			turns = _mm512_or_si512(_mm512_srli_epi64(low, numberOfFractionalBits - 2), _mm512_slli_epi64(high, 66 - numberOfFractionalBits));
+		}
+		__m512i isReflected = _mm512_srai_epi64(_mm512_add_epi64(turns, _mm512_set1_epi64(static_cast<int64_t>(1) << 62)), 63);
+		turns = _mm512_xor_si512(turns, _mm512_and_si512(isReflected, _mm512_set1_epi64(std::numeric_limits<int64_t>::min())));
+		__m512i residualAngle = _mm512_srai_epi64(turns, 2);
+		__m512i x = _mm512_set1_epi64(fixedPointCordicCircularGains[numberOfIterations < 31 ? numberOfIterations : 31]);
+		__m512i y = _mm512_setzero_si512();
+		for (int iteration = 0; iteration < numberOfIterations; iteration++)
+		{
+			const __m128i amountToShift = _mm_cvtsi32_si128(iteration);
+			__m512i direction = _mm512_srai_epi64(residualAngle, 63);
+			__m512i shiftedX = negateWhereAvx512(_mm512_sra_epi64(x, amountToShift), direction);
+			x = _mm512_sub_epi64(x, negateWhereAvx512(_mm512_sra_epi64(y, amountToShift), direction));
+			y = _mm512_add_epi64(y, shiftedX);
+			residualAngle = _mm512_sub_epi64(residualAngle, negateWhereAvx512(_mm512_set1_epi64(fixedPointCordicCircularTurns[iteration]), direction));
+		}
+		__m512i vectorResult = negateWhereAvx512(isCosine ? x : y, isReflected);
+		storeNarrowedAvx512(roundAndSaturateAvx512(vectorResult, roundingShift), result + index);
+	}
+	return index;
+}
+/**
+ * @brief Compute e raised to the power of raw values eight at a time with AVX-512, one 64-bit lane per value.
+ * @details Runs the hyperbolic CORDIC rotation of FixedPointNumber::exponential in every lane and scales each result by
+ * its own power of two, so the results are bit-exact with the scalar function.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param result
+ * @param numberOfValues
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx512f,avx512bw"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::exponentialAvx512(const StorageType* values, StorageType* result, std::size_t numberOfValues)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m512i) / sizeof(int64_t);
+	constexpr int numberOfIterations = fixedPointCordicIterations(numberOfBits);
+	std::size_t index = 0;
+	for (; index + numberOfLanes <= numberOfValues; index += numberOfLanes)
+	{
+		__m512i high;
+		__m512i low;
+		multiplyByConstantAvx512(loadWidenedAvx512(values + index), fixedPointLog2E, high, low);
+		__m512i exponent = _mm512_srai_epi64(high, numberOfFractionalBits - 2);
+		__m512i residualAngle = _mm512_and_si512(_mm512_or_si512(_mm512_slli_epi64(high, 63 - numberOfFractionalBits), _mm512_srli_epi64(low, numberOfFractionalBits + 1)), _mm512_set1_epi64((static_cast<int64_t>(1) << 61) - 1));
+		__m512i x = _mm512_set1_epi64(fixedPointCordicHyperbolicGains[numberOfIterations < 31 ? numberOfIterations : 31]);
+		__m512i y = _mm512_setzero_si512();
+		for (int iteration = 1; iteration <= numberOfIterations; iteration++)
+		{
+			for (int repetition = (iteration == 4 || iteration == 13 || iteration == 40) ? 0 : 1; repetition < 2; repetition++)
+			{
+				const __m128i amountToShift = _mm_cvtsi32_si128(iteration);
+				__m512i direction = _mm512_srai_epi64(residualAngle, 63);
+				__m512i shiftedX = negateWhereAvx512(_mm512_sra_epi64(x, amountToShift), direction);
+				x = _mm512_add_epi64(x, negateWhereAvx512(_mm512_sra_epi64(y, amountToShift), direction));
+				y = _mm512_add_epi64(y, shiftedX);
+				residualAngle = _mm512_sub_epi64(residualAngle, negateWhereAvx512(_mm512_set1_epi64(fixedPointCordicHyperbolicAngles[iteration - 1]), direction));
+			}
+		}
+		__m512i vectorResult = roundAndSaturateAvx512(_mm512_add_epi64(x, y), _mm512_sub_epi64(_mm512_set1_epi64(61 - numberOfFractionalBits), exponent));
+		vectorResult = _mm512_mask_mov_epi64(vectorResult, _mm512_cmpgt_epi64_mask(exponent, _mm512_set1_epi64(numberOfIntegerBits)), _mm512_set1_epi64(static_cast<int64_t>(largestRawValue)));
+		vectorResult = _mm512_maskz_mov_epi64(_mm512_cmpge_epi64_mask(exponent, _mm512_set1_epi64(-(numberOfFractionalBits + 2))), vectorResult);
+		storeNarrowedAvx512(vectorResult, result + index);
+	}
+	return index;
+}
+/**
+ * @brief Compute the base-2 logarithms of raw values eight at a time with AVX-512, one 64-bit lane per value.
+ * @details Runs the hyperbolic CORDIC vectoring of FixedPointNumber::logarithmBase2 in every lane, so the results are
+ * bit-exact with the scalar function. It stops before the first group of lanes holding a value that is not positive,
+ * so that the scalar loop throws for it.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param result
+ * @param numberOfValues
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx512f,avx512bw"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::logarithmBase2Avx512(const StorageType* values, StorageType* result, std::size_t numberOfValues)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m512i) / sizeof(int64_t);
+	constexpr int numberOfIterations = fixedPointCordicIterations(numberOfFractionalBits);
+	const __m512i mantissaOne = _mm512_set1_epi64(static_cast<int64_t>(1) << 61);
+	std::size_t index = 0;
+	for (; index + numberOfLanes <= numberOfValues; index += numberOfLanes)
+	{
+		__m512i vector = loadWidenedAvx512(values + index);
+		if (_mm512_cmpgt_epi64_mask(vector, _mm512_setzero_si512()) != 0xFF)
+		{
+			break;
+		}
+		__m512i length = bitLengthAvx512(vector);
+		__m512i mantissa = _mm512_sllv_epi64(vector, _mm512_sub_epi64(_mm512_set1_epi64(62), length));
+		__m512i x = _mm512_add_epi64(mantissa, mantissaOne);
+		__m512i y = _mm512_sub_epi64(mantissa, mantissaOne);
+		__m512i halfLogarithm = _mm512_setzero_si512();
+		for (int iteration = 1; iteration <= numberOfIterations; iteration++)
+		{
+			for (int repetition = (iteration == 4 || iteration == 13 || iteration == 40) ? 0 : 1; repetition < 2; repetition++)
+			{
+				const __m128i amountToShift = _mm_cvtsi32_si128(iteration);
+				__m512i direction = _mm512_xor_si512(_mm512_srai_epi64(y, 63), _mm512_set1_epi64(-1));
+				__m512i shiftedX = negateWhereAvx512(_mm512_sra_epi64(x, amountToShift), direction);
+				x = _mm512_add_epi64(x, negateWhereAvx512(_mm512_sra_epi64(y, amountToShift), direction));
+				y = _mm512_add_epi64(y, shiftedX);
+				halfLogarithm = _mm512_sub_epi64(halfLogarithm, negateWhereAvx512(_mm512_set1_epi64(fixedPointCordicHyperbolicAngles[iteration - 1]), direction));
+			}
+		}
+		__m512i fraction = _mm512_add_epi64(_mm512_add_epi64(halfLogarithm, halfLogarithm), _mm512_set1_epi64(static_cast<int64_t>(1) << (60 - numberOfFractionalBits)));
+		fraction = _mm512_srai_epi64(fraction, 61 - numberOfFractionalBits);
+		__m512i exponent = _mm512_slli_epi64(_mm512_sub_epi64(length, _mm512_set1_epi64(1 + numberOfFractionalBits)), numberOfFractionalBits);
+		storeNarrowedAvx512(saturateAvx512(_mm512_add_epi64(exponent, fraction)), result + index);
+	}
+	return index;
+}
+/**
+ * @brief Compute the angles of points eight at a time with AVX-512, one 64-bit lane per point.
+ * @details Runs the circular CORDIC vectoring of FixedPointNumber::arcTangent2 in every lane, so the results are
+ * bit-exact with the scalar function.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param ordinates
+ * @param abscissas
+ * @param result
+ * @param numberOfValues
+ * @return std::size_t Number of elements processed; the caller finishes the remainder.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+__attribute__((target("avx512f,avx512bw"))) std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::arcTangent2Avx512(const StorageType* ordinates, const StorageType* abscissas, StorageType* result, std::size_t numberOfValues)
+{
+	constexpr std::size_t numberOfLanes = sizeof(__m512i) / sizeof(int64_t);
+	constexpr int numberOfIterations = fixedPointCordicIterations(numberOfFractionalBits);
+	std::size_t index = 0;
+	for (; index + numberOfLanes <= numberOfValues; index += numberOfLanes)
+	{
+		__m512i ordinate = loadWidenedAvx512(ordinates + index);
+		__m512i abscissa = loadWidenedAvx512(abscissas + index);
+		__m512i isLeftHalfPlane = _mm512_srai_epi64(abscissa, 63);
+		__m512i angle = _mm512_and_si512(isLeftHalfPlane, negateWhereAvx512(_mm512_set1_epi64(fixedPointPi), _mm512_srai_epi64(ordinate, 63)));
+		abscissa = negateWhereAvx512(abscissa, isLeftHalfPlane);
+		ordinate = negateWhereAvx512(ordinate, isLeftHalfPlane);
+		__m512i magnitude = _mm512_max_epi64(abscissa, _mm512_abs_epi64(ordinate));
+		__m512i normalizingShift = _mm512_sub_epi64(_mm512_set1_epi64(61), bitLengthAvx512(magnitude));
+		__m512i x = _mm512_sllv_epi64(abscissa, normalizingShift);
+		__m512i y = _mm512_sllv_epi64(ordinate, normalizingShift);
+		for (int iteration = 0; iteration < numberOfIterations; iteration++)
+		{
+			const __m128i amountToShift = _mm_cvtsi32_si128(iteration);
+			__m512i direction = _mm512_srai_epi64(y, 63);
+			__m512i shiftedX = negateWhereAvx512(_mm512_sra_epi64(x, amountToShift), direction);
+			x = _mm512_add_epi64(x, negateWhereAvx512(_mm512_sra_epi64(y, amountToShift), direction));
+			y = _mm512_sub_epi64(y, shiftedX);
+			angle = _mm512_add_epi64(angle, negateWhereAvx512(_mm512_set1_epi64(fixedPointCordicCircularRadians[iteration]), direction));
+		}
+		__m512i vectorResult = roundAndSaturateAvx512(angle, _mm512_set1_epi64(60 - numberOfFractionalBits));
+		storeNarrowedAvx512(_mm512_maskz_mov_epi64(_mm512_test_epi64_mask(magnitude, magnitude), vectorResult), result + index);
+	}
+	return index;
+}
+#pragma GCC diagnostic pop
+#endif
+/**
+ * @brief Add two spans element by element, wrapping like operator+.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values1
+ * @param values2
+ * @param result May alias either input.
+ * @param instructionSet Most capable instruction set to use; defaults to the best one the processor supports.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::add(std::span<const ValueType> values1, std::span<const ValueType> values2, std::span<ValueType> result, FixedPointInstructionSet instructionSet)
+{
+	checkSizes(values1.size(), values2.size(), result.size());
+	const StorageType* rawValues1 = rawValues(values1);
+	const StorageType* rawValues2 = rawValues(values2);
+	StorageType* rawResult = rawValues(result);
+	std::size_t index = 0;
+#if FIXEDPOINT_X86_KERNELS
+	if constexpr (hasVectorKernels)
+	{
+		switch (selectInstructionSet(instructionSet))
+		{
+		case FixedPointInstructionSet::Avx512:
+			index = addAvx512(rawValues1, rawValues2, rawResult, result.size());
+			break;
+		case FixedPointInstructionSet::Avx2:
+			index = addAvx2(rawValues1, rawValues2, rawResult, result.size());
+			break;
+		case FixedPointInstructionSet::Sse41:
+			index = addSse41(rawValues1, rawValues2, rawResult, result.size());
+			break;
+		default:
+			break;
+		}
+	}
+#endif
+	addScalar(rawValues1, rawValues2, rawResult, index, result.size());
+}
+/**
+ * @brief Subtract two spans element by element, wrapping like operator-.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values1
+ * @param values2
+ * @param result May alias either input.
+ * @param instructionSet Most capable instruction set to use; defaults to the best one the processor supports.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::subtract(std::span<const ValueType> values1, std::span<const ValueType> values2, std::span<ValueType> result, FixedPointInstructionSet instructionSet)
+{
+	checkSizes(values1.size(), values2.size(), result.size());
+	const StorageType* rawValues1 = rawValues(values1);
+	const StorageType* rawValues2 = rawValues(values2);
+	StorageType* rawResult = rawValues(result);
+	std::size_t index = 0;
+#if FIXEDPOINT_X86_KERNELS
+	if constexpr (hasVectorKernels)
+	{
+		switch (selectInstructionSet(instructionSet))
+		{
+		case FixedPointInstructionSet::Avx512:
+			index = subtractAvx512(rawValues1, rawValues2, rawResult, result.size());
+			break;
+		case FixedPointInstructionSet::Avx2:
+			index = subtractAvx2(rawValues1, rawValues2, rawResult, result.size());
+			break;
+		case FixedPointInstructionSet::Sse41:
+			index = subtractSse41(rawValues1, rawValues2, rawResult, result.size());
+			break;
+		default:
+			break;
+		}
+	}
+#endif
+	subtractScalar(rawValues1, rawValues2, rawResult, index, result.size());
+}
+/**
+ * @brief Multiply two spans element by element, rounding like the scalar multiply.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam rounding The rounding applied to the discarded fractional bits of every product.
+ * @param values1
+ * @param values2
+ * @param result May alias either input.
+ * @param instructionSet Most capable instruction set to use; defaults to the best one the processor supports.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <FixedPointRounding rounding>
+void FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::multiply(std::span<const ValueType> values1, std::span<const ValueType> values2, std::span<ValueType> result, FixedPointInstructionSet instructionSet)
+{
+	checkSizes(values1.size(), values2.size(), result.size());
+	const StorageType* rawValues1 = rawValues(values1);
+	const StorageType* rawValues2 = rawValues(values2);
+	StorageType* rawResult = rawValues(result);
+	std::size_t index = 0;
+#if FIXEDPOINT_X86_KERNELS
+	if constexpr (hasVectorKernels && rounding != FixedPointRounding::Stochastic)
+	{
+		switch (selectInstructionSet(instructionSet))
+		{
+		case FixedPointInstructionSet::Avx512:
+			index = multiplyAvx512<rounding>(rawValues1, rawValues2, rawResult, result.size());
+			break;
+		case FixedPointInstructionSet::Avx2:
+			index = multiplyAvx2<rounding>(rawValues1, rawValues2, rawResult, result.size());
+			break;
+		case FixedPointInstructionSet::Sse41:
+			index = multiplySse41<rounding>(rawValues1, rawValues2, rawResult, result.size());
+			break;
+		default:
+			break;
+		}
+	}
+#endif
+	multiplyScalar<rounding>(rawValues1, rawValues2, rawResult, index, result.size());
+}
+/**
+ * @brief Shift every element of a span right by the same number of bits, rounding like the scalar shiftRight.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam rounding The rounding applied to the discarded bits of every element.
+ * @param values
+ * @param amountToShift A negative amount gives zeros.
+ * @param result May alias the input.
+ * @param instructionSet Most capable instruction set to use; defaults to the best one the processor supports.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <FixedPointRounding rounding>
+void FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::shiftRight(std::span<const ValueType> values, int amountToShift, std::span<ValueType> result, FixedPointInstructionSet instructionSet)
+{
+	checkSizes(values.size(), values.size(), result.size());
+	const StorageType* rawInput = rawValues(values);
+	StorageType* rawResult = rawValues(result);
+	std::size_t index = 0;
+#if FIXEDPOINT_X86_KERNELS
+	if constexpr (hasVectorKernels && rounding != FixedPointRounding::Stochastic)
+	{
+		if (amountToShift > 0)
+		{
+			switch (selectInstructionSet(instructionSet))
+			{
+			case FixedPointInstructionSet::Avx512:
+				index = shiftRightAvx512<rounding>(rawInput, amountToShift, rawResult, result.size());
+				break;
+			case FixedPointInstructionSet::Avx2:
+				index = shiftRightAvx2<rounding>(rawInput, amountToShift, rawResult, result.size());
+				break;
+			case FixedPointInstructionSet::Sse41:
+				index = shiftRightSse41<rounding>(rawInput, amountToShift, rawResult, result.size());
+				break;
+			default:
+				break;
+			}
+		}
+	}
+#endif
+	shiftRightScalar<rounding>(rawInput, amountToShift, rawResult, index, result.size());
+}
+/**
+ * @brief Quantize floats to fixed point with a per-tensor scale, so that each element becomes values[i] / scale rounded
+ * like fromDouble.
+ * @details Each float is widened to double and multiplied by the reciprocal of the scale, and out-of-range values and
+ * infinities saturate while NaN becomes zero. The vector kernels fold 2^numberOfFractionalBits into the multiplier,
+ * which is exact, and round with the vector rounding instructions, so they match the scalar reference bit for bit.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @tparam rounding The rounding applied to every quantized value.
+ * @param values
+ * @param scale Real value of one unit of the fixed-point format; must be positive and finite.
+ * @param result
+ * @param instructionSet Most capable instruction set to use; defaults to the best one the processor supports.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+template <FixedPointRounding rounding>
+void FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::quantize(std::span<const float> values, double scale, std::span<ValueType> result, FixedPointInstructionSet instructionSet)
+{
+	checkSizes(values.size(), values.size(), result.size());
+	if (!(scale > 0.0 && scale < std::numeric_limits<double>::infinity()))
+	{
+		throw std::invalid_argument("Quantization scale must be positive and finite.");
+	}
+	double inverseScale = 1.0 / scale;
+	StorageType* rawResult = rawValues(result);
+	std::size_t index = 0;
+#if FIXEDPOINT_X86_KERNELS
+	if constexpr (hasVectorKernels && rounding != FixedPointRounding::Stochastic)
+	{
+		double scaleFactor = inverseScale / ValueType::fromRawValue(1).toDouble();
+		switch (selectInstructionSet(instructionSet))
+		{
+		case FixedPointInstructionSet::Avx512:
+			index = quantizeAvx512<rounding>(values.data(), scaleFactor, rawResult, result.size());
+			break;
+		case FixedPointInstructionSet::Avx2:
+			index = quantizeAvx2<rounding>(values.data(), scaleFactor, rawResult, result.size());
+			break;
+		case FixedPointInstructionSet::Sse41:
+			index = quantizeSse41<rounding>(values.data(), scaleFactor, rawResult, result.size());
+			break;
+		default:
+			break;
+		}
+	}
+#endif
+	quantizeScalar<rounding>(values.data(), inverseScale, rawResult, index, result.size());
+}
+/**
+ * @brief Dequantize fixed point to floats with a per-tensor scale, so that each element becomes values[i] * scale.
+ * @details The product is formed in double and rounded once to float, and the vector kernels fold
+ * 2^-numberOfFractionalBits into the multiplier, which is exact, so they match the scalar reference bit for bit.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param scale Real value of one unit of the fixed-point format; must be positive and finite.
+ * @param result
+ * @param instructionSet Most capable instruction set to use; defaults to the best one the processor supports.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::dequantize(std::span<const ValueType> values, double scale, std::span<float> result, FixedPointInstructionSet instructionSet)
+{
+	checkSizes(values.size(), values.size(), result.size());
+	if (!(scale > 0.0 && scale < std::numeric_limits<double>::infinity()))
+	{
+		throw std::invalid_argument("Quantization scale must be positive and finite.");
+	}
+	const StorageType* rawInput = rawValues(values);
+	std::size_t index = 0;
+#if FIXEDPOINT_X86_KERNELS
+	if constexpr (hasVectorKernels)
+	{
+		double scaleFactor = scale * ValueType::fromRawValue(1).toDouble();
+		switch (selectInstructionSet(instructionSet))
+		{
+		case FixedPointInstructionSet::Avx512:
+			index = dequantizeAvx512(rawInput, scaleFactor, result.data(), result.size());
+			break;
+		case FixedPointInstructionSet::Avx2:
+			index = dequantizeAvx2(rawInput, scaleFactor, result.data(), result.size());
+			break;
+		case FixedPointInstructionSet::Sse41:
+			index = dequantizeSse41(rawInput, scaleFactor, result.data(), result.size());
+			break;
+		default:
+			break;
+		}
+	}
+#endif
+	dequantizeScalar(rawInput, scale, result.data(), index, result.size());
+}
+/**
+ * @brief Add two spans element by element, clamping each sum to the range of the format.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values1
+ * @param values2
+ * @param result May alias either input.
+ * @param instructionSet Most capable instruction set to use; defaults to the best one the processor supports.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::addSaturated(std::span<const ValueType> values1, std::span<const ValueType> values2, std::span<ValueType> result, FixedPointInstructionSet instructionSet)
+{
+	checkSizes(values1.size(), values2.size(), result.size());
+	const StorageType* rawValues1 = rawValues(values1);
+	const StorageType* rawValues2 = rawValues(values2);
+	StorageType* rawResult = rawValues(result);
+	std::size_t index = 0;
+#if FIXEDPOINT_X86_KERNELS
+	if constexpr (hasVectorKernels)
+	{
+		switch (selectInstructionSet(instructionSet))
+		{
+		case FixedPointInstructionSet::Avx512:
+			index = addSaturatedAvx512(rawValues1, rawValues2, rawResult, result.size());
+			break;
+		case FixedPointInstructionSet::Avx2:
+			index = addSaturatedAvx2(rawValues1, rawValues2, rawResult, result.size());
+			break;
+		case FixedPointInstructionSet::Sse41:
+			index = addSaturatedSse41(rawValues1, rawValues2, rawResult, result.size());
+			break;
+		default:
+			break;
+		}
+	}
+#endif
+	addSaturatedScalar(rawValues1, rawValues2, rawResult, index, result.size());
+}
+/**
+ * @brief Subtract two spans element by element, clamping each difference to the range of the format.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values1
+ * @param values2
+ * @param result May alias either input.
+ * @param instructionSet Most capable instruction set to use; defaults to the best one the processor supports.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::subtractSaturated(std::span<const ValueType> values1, std::span<const ValueType> values2, std::span<ValueType> result, FixedPointInstructionSet instructionSet)
+{
+	checkSizes(values1.size(), values2.size(), result.size());
+	const StorageType* rawValues1 = rawValues(values1);
+	const StorageType* rawValues2 = rawValues(values2);
+	StorageType* rawResult = rawValues(result);
+	std::size_t index = 0;
+#if FIXEDPOINT_X86_KERNELS
+	if constexpr (hasVectorKernels)
+	{
+		switch (selectInstructionSet(instructionSet))
+		{
+		case FixedPointInstructionSet::Avx512:
+			index = subtractSaturatedAvx512(rawValues1, rawValues2, rawResult, result.size());
+			break;
+		case FixedPointInstructionSet::Avx2:
+			index = subtractSaturatedAvx2(rawValues1, rawValues2, rawResult, result.size());
+			break;
+		case FixedPointInstructionSet::Sse41:
+			index = subtractSaturatedSse41(rawValues1, rawValues2, rawResult, result.size());
+			break;
+		default:
+			break;
+		}
+	}
+#endif
+	subtractSaturatedScalar(rawValues1, rawValues2, rawResult, index, result.size());
+}
+/**
+ * @brief Find the smallest and largest elements of a span in a single pass over the raw values.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values Must not be empty.
+ * @param minimum Receives the smallest element.
+ * @param maximum Receives the largest element.
+ * @param instructionSet Most capable instruction set to use; defaults to the best one the processor supports.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::minimumAndMaximum(std::span<const ValueType> values, ValueType &minimum, ValueType &maximum, FixedPointInstructionSet instructionSet)
+{
+	if (values.empty())
+	{
+		throw std::runtime_error("Cannot determine minimum and maximum of an empty array.");
+	}
+	const StorageType* rawValuesToSearch = rawValues(values);
+	StorageType rawMinimum = rawValuesToSearch[0];
+	StorageType rawMaximum = rawValuesToSearch[0];
+	std::size_t index = 0;
+#if FIXEDPOINT_X86_KERNELS
+	if constexpr (hasVectorKernels)
+	{
+		switch (selectInstructionSet(instructionSet))
+		{
+		case FixedPointInstructionSet::Avx512:
+			index = minimumAndMaximumAvx512(rawValuesToSearch, values.size(), rawMinimum, rawMaximum);
+			break;
+		case FixedPointInstructionSet::Avx2:
+			index = minimumAndMaximumAvx2(rawValuesToSearch, values.size(), rawMinimum, rawMaximum);
+			break;
+		case FixedPointInstructionSet::Sse41:
+			index = minimumAndMaximumSse41(rawValuesToSearch, values.size(), rawMinimum, rawMaximum);
+			break;
+		default:
+			break;
+		}
+	}
+#endif
+	minimumAndMaximumScalar(rawValuesToSearch, index, values.size(), rawMinimum, rawMaximum);
+	minimum = ValueType::fromRawValue(rawMinimum);
+	maximum = ValueType::fromRawValue(rawMaximum);
+}
+/**
+ * @brief Find the first element of a span equal to a value by comparing raw values.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param value
+ * @param instructionSet Most capable instruction set to use; defaults to the best one the processor supports.
+ * @return std::size_t Index of the first match, or values.size() if there is none.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+std::size_t FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::indexOf(std::span<const ValueType> values, const ValueType &value, FixedPointInstructionSet instructionSet)
+{
+	const StorageType* rawValuesToSearch = rawValues(values);
+	std::size_t index = 0;
+#if FIXEDPOINT_X86_KERNELS
+	if constexpr (hasVectorKernels)
+	{
+		switch (selectInstructionSet(instructionSet))
+		{
+		case FixedPointInstructionSet::Avx512:
+			index = indexOfAvx512(rawValuesToSearch, values.size(), value.getRawValue());
+			break;
+		case FixedPointInstructionSet::Avx2:
+			index = indexOfAvx2(rawValuesToSearch, values.size(), value.getRawValue());
+			break;
+		case FixedPointInstructionSet::Sse41:
+			index = indexOfSse41(rawValuesToSearch, values.size(), value.getRawValue());
+			break;
+		default:
+			break;
+		}
+	}
+#endif
+	return indexOfScalar(rawValuesToSearch, index, values.size(), value.getRawValue());
+}
+/**
+ * @brief Compute the exact dot product of two spans without rounding.
+ * @details The raw products are accumulated in AccumulatorType, so the result has 2 * numberOfFractionalBits fractional
+ * bits and no intermediate step rounds or overflows; FixedPointArray::dot rounds it once into a result format.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values1
+ * @param values2
+ * @param instructionSet Most capable instruction set to use; defaults to the best one the processor supports.
+ * @return AccumulatorType
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+typename FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::AccumulatorType FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::dot(std::span<const ValueType> values1, std::span<const ValueType> values2, FixedPointInstructionSet instructionSet)
+{
+	checkSizes(values1.size(), values2.size(), values1.size());
+	const StorageType* rawValues1 = rawValues(values1);
+	const StorageType* rawValues2 = rawValues(values2);
+	AccumulatorType accumulator = static_cast<AccumulatorType>(0);
+	std::size_t index = 0;
+#if FIXEDPOINT_X86_KERNELS
+	if constexpr (hasVectorKernels)
+	{
+		switch (selectInstructionSet(instructionSet))
+		{
+		case FixedPointInstructionSet::Avx512:
+			index = dotAvx512(rawValues1, rawValues2, values1.size(), accumulator);
+			break;
+		case FixedPointInstructionSet::Avx2:
+			index = dotAvx2(rawValues1, rawValues2, values1.size(), accumulator);
+			break;
+		case FixedPointInstructionSet::Sse41:
+			index = dotSse41(rawValues1, rawValues2, values1.size(), accumulator);
+			break;
+		default:
+			break;
+		}
+	}
+#endif
+	dotScalar(rawValues1, rawValues2, index, values1.size(), accumulator);
+	return accumulator;
+}
+/**
+ * @brief Compute the exact sum of a span without overflow.
+ * @details The raw values are accumulated in AccumulatorType, so the result has numberOfFractionalBits fractional bits.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param instructionSet Most capable instruction set to use; defaults to the best one the processor supports.
+ * @return AccumulatorType
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+typename FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::AccumulatorType FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::sum(std::span<const ValueType> values, FixedPointInstructionSet instructionSet)
+{
+	const StorageType* rawValuesToSum = rawValues(values);
+	AccumulatorType accumulator = static_cast<AccumulatorType>(0);
+	std::size_t index = 0;
+#if FIXEDPOINT_X86_KERNELS
+	if constexpr (hasVectorKernels)
+	{
+		switch (selectInstructionSet(instructionSet))
+		{
+		case FixedPointInstructionSet::Avx512:
+			index = sumAvx512(rawValuesToSum, values.size(), accumulator);
+			break;
+		case FixedPointInstructionSet::Avx2:
+			index = sumAvx2(rawValuesToSum, values.size(), accumulator);
+			break;
+		case FixedPointInstructionSet::Sse41:
+			index = sumSse41(rawValuesToSum, values.size(), accumulator);
+			break;
+		default:
+			break;
+		}
+	}
+#endif
+	sumScalar(rawValuesToSum, index, values.size(), accumulator);
+	return accumulator;
+}
+/**
+ * @brief Compute the sine of every element of a span, bit-exact with FixedPointNumber::sine.
+ * @details The kernels compute in 64-bit lanes, four per AVX2 vector and eight per AVX-512 vector; SSE4.1 has no 64-bit
+ * comparison and uses the scalar loop.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param result May alias values.
+ * @param instructionSet Most capable instruction set to use; defaults to the best one the processor supports.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::sine(std::span<const ValueType> values, std::span<ValueType> result, FixedPointInstructionSet instructionSet)
+{
+	checkSizes(values.size(), values.size(), result.size());
+	const StorageType* rawInput = rawValues(values);
+	StorageType* rawResult = rawValues(result);
+	std::size_t index = 0;
+#if FIXEDPOINT_X86_KERNELS
+	if constexpr (hasVectorMathKernels)
+	{
+		switch (selectInstructionSet(instructionSet))
+		{
+		case FixedPointInstructionSet::Avx512:
+			index = sineOrCosineAvx512<false>(rawInput, rawResult, result.size());
+			break;
+		case FixedPointInstructionSet::Avx2:
+			index = sineOrCosineAvx2<false>(rawInput, rawResult, result.size());
+			break;
+		default:
+			break;
+		}
+	}
+#endif
+	sineScalar(rawInput, rawResult, index, result.size());
+}
+/**
+ * @brief Compute the cosine of every element of a span, bit-exact with FixedPointNumber::cosine.
+ * @details See sine for the kernels.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param result May alias values.
+ * @param instructionSet Most capable instruction set to use; defaults to the best one the processor supports.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::cosine(std::span<const ValueType> values, std::span<ValueType> result, FixedPointInstructionSet instructionSet)
+{
+	checkSizes(values.size(), values.size(), result.size());
+	const StorageType* rawInput = rawValues(values);
+	StorageType* rawResult = rawValues(result);
+	std::size_t index = 0;
+#if FIXEDPOINT_X86_KERNELS
+	if constexpr (hasVectorMathKernels)
+	{
+		switch (selectInstructionSet(instructionSet))
+		{
+		case FixedPointInstructionSet::Avx512:
+			index = sineOrCosineAvx512<true>(rawInput, rawResult, result.size());
+			break;
+		case FixedPointInstructionSet::Avx2:
+			index = sineOrCosineAvx2<true>(rawInput, rawResult, result.size());
+			break;
+		default:
+			break;
+		}
+	}
+#endif
+	cosineScalar(rawInput, rawResult, index, result.size());
+}
+/**
+ * @brief Compute e raised to the power of every element of a span, bit-exact with FixedPointNumber::exponential.
+ * @details See sine for the kernels.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param result May alias values.
+ * @param instructionSet Most capable instruction set to use; defaults to the best one the processor supports.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::exponential(std::span<const ValueType> values, std::span<ValueType> result, FixedPointInstructionSet instructionSet)
+{
+	checkSizes(values.size(), values.size(), result.size());
+	const StorageType* rawInput = rawValues(values);
+	StorageType* rawResult = rawValues(result);
+	std::size_t index = 0;
+#if FIXEDPOINT_X86_KERNELS
+	if constexpr (hasVectorMathKernels)
+	{
+		switch (selectInstructionSet(instructionSet))
+		{
+		case FixedPointInstructionSet::Avx512:
+			index = exponentialAvx512(rawInput, rawResult, result.size());
+			break;
+		case FixedPointInstructionSet::Avx2:
+			index = exponentialAvx2(rawInput, rawResult, result.size());
+			break;
+		default:
+			break;
+		}
+	}
+#endif
+	exponentialScalar(rawInput, rawResult, index, result.size());
+}
+/**
+ * @brief Compute the base-2 logarithm of every element of a span, bit-exact with FixedPointNumber::logarithmBase2.
+ * @details See sine for the kernels. The elements before the first one that is not positive are written before the
+ * exception is thrown.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param values
+ * @param result May alias values.
+ * @param instructionSet Most capable instruction set to use; defaults to the best one the processor supports.
+ * @throws std::domain_error If an element is not positive.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::logarithmBase2(std::span<const ValueType> values, std::span<ValueType> result, FixedPointInstructionSet instructionSet)
+{
+	checkSizes(values.size(), values.size(), result.size());
+	const StorageType* rawInput = rawValues(values);
+	StorageType* rawResult = rawValues(result);
+	std::size_t index = 0;
+#if FIXEDPOINT_X86_KERNELS
+	if constexpr (hasVectorMathKernels)
+	{
+		switch (selectInstructionSet(instructionSet))
+		{
+		case FixedPointInstructionSet::Avx512:
+			index = logarithmBase2Avx512(rawInput, rawResult, result.size());
+			break;
+		case FixedPointInstructionSet::Avx2:
+			index = logarithmBase2Avx2(rawInput, rawResult, result.size());
+			break;
+		default:
+			break;
+		}
+	}
+#endif
+	logarithmBase2Scalar(rawInput, rawResult, index, result.size());
+}
+/**
+ * @brief Compute the angle of every point of two spans of coordinates, bit-exact with FixedPointNumber::arcTangent2.
+ * @details See sine for the kernels.
+ * @tparam numberOfIntegerBits
+ * @tparam numberOfFractionalBits
+ * @param ordinates The y coordinates.
+ * @param abscissas The x coordinates.
+ * @param result May alias either input.
+ * @param instructionSet Most capable instruction set to use; defaults to the best one the processor supports.
+ */
+template <int numberOfIntegerBits, int numberOfFractionalBits>
+void FixedPointSimd<numberOfIntegerBits, numberOfFractionalBits>::arcTangent2(std::span<const ValueType> ordinates, std::span<const ValueType> abscissas, std::span<ValueType> result, FixedPointInstructionSet instructionSet)
+{
+	checkSizes(ordinates.size(), abscissas.size(), result.size());
+	const StorageType* rawOrdinates = rawValues(ordinates);
+	const StorageType* rawAbscissas = rawValues(abscissas);
+	StorageType* rawResult = rawValues(result);
+	std::size_t index = 0;
+#if FIXEDPOINT_X86_KERNELS
+	if constexpr (hasVectorMathKernels)
+	{
+		switch (selectInstructionSet(instructionSet))
+		{
+		case FixedPointInstructionSet::Avx512:
+			index = arcTangent2Avx512(rawOrdinates, rawAbscissas, rawResult, result.size());
+			break;
+		case FixedPointInstructionSet::Avx2:
+			index = arcTangent2Avx2(rawOrdinates, rawAbscissas, rawResult, result.size());
+			break;
+		default:
+			break;
+		}
+	}
+#endif
+	arcTangent2Scalar(rawOrdinates, rawAbscissas, rawResult, index, result.size());
+}
+#endif
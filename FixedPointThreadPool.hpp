@@ -0,0 +1,221 @@
+/**
+ * @file FixedPointThreadPool.hpp
+ * @author Robert Connor Luce
+ * @brief Header file for FixedPointThreadPool class, a small work-stealing thread pool for the bulk algorithms.
+ */
+#include <cstddef>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#ifndef FIXEDPOINTTHREADPOOL_HPP
+#define FIXEDPOINTTHREADPOOL_HPP
+/**
+ * @brief Work-stealing thread pool that runs batches of indexed tasks.
+ * @details Every worker owns a queue. A batch is dealt round-robin across the queues; a worker takes tasks from the
+ * back of its own queue and steals from the front of the others when it runs out. The thread that submits a batch
+ * runs tasks too while it waits, so batches may be submitted from inside a task without deadlocking, and a pool of one
+ * thread runs everything on the calling thread.
+ */
+class FixedPointThreadPool
+{
+private:
+	struct TaskQueue
+	{
+		std::mutex mutex;
+		std::deque<std::function<void()>> tasks;
+	};
+	std::vector<std::unique_ptr<TaskQueue>> taskQueues;
+	std::vector<std::thread> workers;
+	std::mutex sleepMutex;
+	std::condition_variable wakeCondition;
+	std::atomic<std::size_t> numberOfQueuedTasks;
+	std::atomic<std::size_t> nextTaskQueue;
+	bool isStopping;
+	bool tryRunTask(std::size_t taskQueueIndex);
+	void runWorker(std::size_t taskQueueIndex);
+public:
+	explicit FixedPointThreadPool(std::size_t numberOfThreads = std::thread::hardware_concurrency());
+	FixedPointThreadPool(const FixedPointThreadPool &other) = delete;
+	FixedPointThreadPool& operator=(const FixedPointThreadPool &other) = delete;
+	~FixedPointThreadPool();
+	std::size_t getNumberOfThreads() const;
+	template<typename TaskFunction>
+	void parallelFor(std::size_t numberOfTasks, TaskFunction taskFunction);
+};
+/**
+ * @brief Construct a new Fixed Point Thread Pool object.
+ * @param numberOfThreads Threads that run tasks, counting the thread that submits a batch; 0 is treated as 1.
+ */
+inline FixedPointThreadPool::FixedPointThreadPool(std::size_t numberOfThreads) : numberOfQueuedTasks(0), nextTaskQueue(0), isStopping(false)
+{
+	std::size_t numberOfWorkers = numberOfThreads > 1 ? numberOfThreads - 1 : 0;
+	for (std::size_t taskQueueIndex = 0; taskQueueIndex <= numberOfWorkers; taskQueueIndex++)
+	{
+		this->taskQueues.push_back(std::make_unique<TaskQueue>());
+	}
+	for (std::size_t worker = 1; worker <= numberOfWorkers; worker++)
+	{
+		this->workers.emplace_back(&FixedPointThreadPool::runWorker, this, worker);
+	}
+}
+/**
+ * @brief Destroy the Fixed Point Thread Pool object, stopping and joining the workers.
+ */
+inline FixedPointThreadPool::~FixedPointThreadPool()
+{
+	{
+		std::lock_guard<std::mutex> lock(this->sleepMutex);
+		this->isStopping = true;
+	}
+	this->wakeCondition.notify_all();
+	for (std::thread &worker : this->workers)
+	{
+		worker.join();
+	}
+}
+/**
+ * @brief Get the number of threads that run tasks, counting the thread that submits a batch.
+ * @return std::size_t
+ */
+inline std::size_t FixedPointThreadPool::getNumberOfThreads() const
+{
+	return this->workers.size() + 1;
+}
+/**
+ * @brief Run one task, taking it from the back of a queue or stealing it from the front of another.
+ * @param taskQueueIndex The queue of the calling thread.
+ * @return true If a task was run.
+ * @return false If every queue was empty.
+ */
+inline bool FixedPointThreadPool::tryRunTask(std::size_t taskQueueIndex)
+{
+	std::function<void()> task;
+	for (std::size_t offset = 0; offset < this->taskQueues.size() && !task; offset++)
+	{
+		TaskQueue &taskQueue = *this->taskQueues[(taskQueueIndex + offset) % this->taskQueues.size()];
+		std::lock_guard<std::mutex> lock(taskQueue.mutex);
+		if (!taskQueue.tasks.empty())
+		{
+			if (offset == 0)
+			{
+				task = std::move(taskQueue.tasks.back());
+				taskQueue.tasks.pop_back();
+			}
+			else
+			{
+				task = std::move(taskQueue.tasks.front());
+				taskQueue.tasks.pop_front();
+			}
+		}
+	}
+	if (!task)
+	{
+		return false;
+	}
+	this->numberOfQueuedTasks--;
+	task();
+	return true;
+}
+/**
+ * @brief Loop of a worker thread: run tasks while there are any and sleep otherwise.
+ * @param taskQueueIndex The queue owned by the worker.
+ */
+inline void FixedPointThreadPool::runWorker(std::size_t taskQueueIndex)
+{
+	while (true)
+	{
+		if (this->tryRunTask(taskQueueIndex))
+		{
+			continue;
+		}
+		std::unique_lock<std::mutex> lock(this->sleepMutex);
+		this->wakeCondition.wait(lock, [this]()
+		{
+			return this->isStopping || this->numberOfQueuedTasks > 0;
+		});
+		if (this->isStopping)
+		{
+			return;
+		}
+	}
+}
+/**
+ * @brief Run taskFunction(task) for every task from 0 to numberOfTasks - 1 and wait for all of them.
+ * @details The first exception thrown by a task is rethrown once the whole batch has finished.
+ * @tparam TaskFunction Callable as taskFunction(std::size_t).
+ * @param numberOfTasks
+ * @param taskFunction
+ */
+template<typename TaskFunction>
+void FixedPointThreadPool::parallelFor(std::size_t numberOfTasks, TaskFunction taskFunction)
+{
+	if (numberOfTasks == 0)
+	{
+		return;
+	}
+	if (numberOfTasks == 1 || this->workers.empty())
+	{
+		for (std::size_t task = 0; task < numberOfTasks; task++)
+		{
+			taskFunction(task);
+		}
+		return;
+	}
+	std::atomic<std::size_t> numberOfRemainingTasks(numberOfTasks);
+	std::mutex exceptionMutex;
+	std::exception_ptr firstException;
+	std::size_t firstTaskQueue = this->nextTaskQueue++;
+	for (std::size_t task = 0; task < numberOfTasks; task++)
+	{
+		TaskQueue &taskQueue = *this->taskQueues[(firstTaskQueue + task) % this->taskQueues.size()];
+		this->numberOfQueuedTasks++;
+		std::lock_guard<std::mutex> lock(taskQueue.mutex);
+		taskQueue.tasks.emplace_back([&taskFunction, &numberOfRemainingTasks, &exceptionMutex, &firstException, task]()
+		{
+			try
+			{
+				taskFunction(task);
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> exceptionLock(exceptionMutex);
+				if (!firstException)
+				{
+					firstException = std::current_exception();
+				}
+			}
+			numberOfRemainingTasks--;
+		});
+	}
+	{
+		std::lock_guard<std::mutex> lock(this->sleepMutex);
+	}
+	this->wakeCondition.notify_all();
+	while (numberOfRemainingTasks > 0)
+	{
+		if (!this->tryRunTask(firstTaskQueue % this->taskQueues.size()))
+		{
+			std::this_thread::yield();
+		}
+	}
+	if (firstException)
+	{
+		std::rethrow_exception(firstException);
+	}
+}
+/**
+ * @brief Get the pool shared by the bulk algorithms when no pool is given, with one thread per hardware thread.
+ * @return FixedPointThreadPool&
+ */
+inline FixedPointThreadPool& fixedPointDefaultThreadPool()
+{
+	static FixedPointThreadPool defaultThreadPool;
+	return defaultThreadPool;
+}
+#endif
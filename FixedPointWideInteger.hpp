@@ -0,0 +1,1051 @@
+/**
+ * @file FixedPointWideInteger.hpp
+ * @author Robert Connor Luce
+ * @brief Header file for FixedPointWideInteger class for two's complement integers wider than the native types.
+ */
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+#include <compare>
+#if defined(__GNUC__) && defined(__x86_64__)
+#include <immintrin.h>
+#define FIXEDPOINT_X86_64_CARRY_CHAINS 1
+#else
+#define FIXEDPOINT_X86_64_CARRY_CHAINS 0
+#endif
+#ifndef FIXEDPOINTWIDEINTEGER_HPP
+#define FIXEDPOINTWIDEINTEGER_HPP
+#ifdef __SIZEOF_INT128__
+__extension__ typedef __int128 FixedPointInt128;
+__extension__ typedef unsigned __int128 FixedPointUInt128;
+#endif
+/**
+ * @brief Class template for two's complement integers made of 64-bit limbs.
+ * @details Arithmetic wraps modulo 2^(64 * numberOfLimbs) exactly like the native types, so the class serves both as
+ * the storage of formats wider than 128 bits, with an unsigned counterpart for the bit manipulation done on the raw
+ * value, and as the double-width and accumulator types of wide formats. Limbs are stored least significant first.
+ * Addition and subtraction run as add-with-carry and subtract-with-borrow chains, division by a single limb is a
+ * short division, and the double-width product of multiplyFull switches from schoolbook to Karatsuba multiplication at
+ * karatsubaThreshold limbs. Like the native types, a default-constructed value is left uninitialised, so the class
+ * stays trivially default constructible; value-initialise it with {} for zero.
+ * @tparam numberOfLimbs Number of 64-bit limbs.
+ * @tparam isSigned Whether the value is signed, which changes comparison, division and right shifts like native types.
+ */
+template<int numberOfLimbs, bool isSigned = true>
+class FixedPointWideInteger
+{
+public:
+	static constexpr int karatsubaThreshold = 16;
+private:
+	static_assert(numberOfLimbs >= 2, "FixedPointWideInteger needs at least two limbs.");
+	uint64_t limbs[numberOfLimbs];
+	template<int, bool>
+	friend class FixedPointWideInteger;
+	static constexpr uint64_t multiplyLimbs(uint64_t limb1, uint64_t limb2, uint64_t &highLimb);
+	static constexpr uint64_t addWithCarry(uint64_t limb1, uint64_t limb2, unsigned char &carry);
+	static constexpr uint64_t subtractWithBorrow(uint64_t limb1, uint64_t limb2, unsigned char &borrow);
+	static constexpr unsigned char addLimbArrays(uint64_t* limbs, const uint64_t* otherLimbs, int numberOfLimbsToAdd);
+	static constexpr unsigned char subtractLimbArrays(uint64_t* limbs, const uint64_t* otherLimbs, int numberOfLimbsToSubtract);
+	template<int numberOfOperandLimbs>
+	static constexpr void multiplyLimbArrays(const uint64_t* limbs1, const uint64_t* limbs2, uint64_t* productLimbs);
+#ifdef __SIZEOF_INT128__
+	static constexpr uint64_t divideLimbs(uint64_t highLimb, uint64_t lowLimb, uint64_t divisor, uint64_t &remainder);
+#endif
+	static constexpr bool isLessUnsigned(const FixedPointWideInteger<numberOfLimbs, isSigned> &value1, const FixedPointWideInteger<numberOfLimbs, isSigned> &value2);
+	static constexpr void divideUnsigned(const FixedPointWideInteger<numberOfLimbs, isSigned> &dividend, const FixedPointWideInteger<numberOfLimbs, isSigned> &divisor, FixedPointWideInteger<numberOfLimbs, isSigned> &quotient, FixedPointWideInteger<numberOfLimbs, isSigned> &remainder);
+public:
+	constexpr FixedPointWideInteger() = default;
+	template<typename Integer>
+		requires (!std::is_class_v<Integer> && !std::is_floating_point_v<Integer>)
+	constexpr FixedPointWideInteger(Integer value);
+	template<int otherNumberOfLimbs, bool otherIsSigned>
+	constexpr FixedPointWideInteger(const FixedPointWideInteger<otherNumberOfLimbs, otherIsSigned> &value);
+	constexpr explicit FixedPointWideInteger(double value);
+	template<typename Integer>
+		requires (!std::is_class_v<Integer> && !std::is_floating_point_v<Integer>)
+	constexpr explicit operator Integer() const;
+	constexpr explicit operator double() const;
+	static constexpr FixedPointWideInteger<2 * numberOfLimbs, isSigned> multiplyFull(const FixedPointWideInteger<numberOfLimbs, isSigned> &value1, const FixedPointWideInteger<numberOfLimbs, isSigned> &value2);
+	constexpr uint64_t getLimb(int limbNumber) const;
+	constexpr bool isNegative() const;
+	constexpr FixedPointWideInteger<numberOfLimbs, isSigned> operator+(const FixedPointWideInteger<numberOfLimbs, isSigned> &other) const;
+	constexpr FixedPointWideInteger<numberOfLimbs, isSigned> operator-() const;
+	constexpr FixedPointWideInteger<numberOfLimbs, isSigned> operator-(const FixedPointWideInteger<numberOfLimbs, isSigned> &other) const;
+	constexpr FixedPointWideInteger<numberOfLimbs, isSigned> operator*(const FixedPointWideInteger<numberOfLimbs, isSigned> &other) const;
+	constexpr FixedPointWideInteger<numberOfLimbs, isSigned> operator/(const FixedPointWideInteger<numberOfLimbs, isSigned> &other) const;
+	constexpr FixedPointWideInteger<numberOfLimbs, isSigned> operator%(const FixedPointWideInteger<numberOfLimbs, isSigned> &other) const;
+	constexpr FixedPointWideInteger<numberOfLimbs, isSigned> operator<<(const int amountToShift) const;
+	constexpr FixedPointWideInteger<numberOfLimbs, isSigned> operator>>(const int amountToShift) const;
+	constexpr FixedPointWideInteger<numberOfLimbs, isSigned> operator~() const;
+	constexpr FixedPointWideInteger<numberOfLimbs, isSigned> operator&(const FixedPointWideInteger<numberOfLimbs, isSigned> &other) const;
+	constexpr FixedPointWideInteger<numberOfLimbs, isSigned> operator|(const FixedPointWideInteger<numberOfLimbs, isSigned> &other) const;
+	constexpr FixedPointWideInteger<numberOfLimbs, isSigned> operator^(const FixedPointWideInteger<numberOfLimbs, isSigned> &other) const;
+	constexpr FixedPointWideInteger<numberOfLimbs, isSigned>& operator+=(const FixedPointWideInteger<numberOfLimbs, isSigned> &other);
+	constexpr FixedPointWideInteger<numberOfLimbs, isSigned>& operator-=(const FixedPointWideInteger<numberOfLimbs, isSigned> &other);
+	constexpr FixedPointWideInteger<numberOfLimbs, isSigned>& operator&=(const FixedPointWideInteger<numberOfLimbs, isSigned> &other);
+	constexpr FixedPointWideInteger<numberOfLimbs, isSigned>& operator|=(const FixedPointWideInteger<numberOfLimbs, isSigned> &other);
+	constexpr FixedPointWideInteger<numberOfLimbs, isSigned>& operator^=(const FixedPointWideInteger<numberOfLimbs, isSigned> &other);
+	constexpr bool operator==(const FixedPointWideInteger<numberOfLimbs, isSigned> &other) const;
+	constexpr bool operator!=(const FixedPointWideInteger<numberOfLimbs, isSigned> &other) const;
+	constexpr bool operator<(const FixedPointWideInteger<numberOfLimbs, isSigned> &other) const;
+	constexpr bool operator<=(const FixedPointWideInteger<numberOfLimbs, isSigned> &other) const;
+	constexpr bool operator>(const FixedPointWideInteger<numberOfLimbs, isSigned> &other) const;
+	constexpr bool operator>=(const FixedPointWideInteger<numberOfLimbs, isSigned> &other) const;
+	constexpr std::strong_ordering operator<=>(const FixedPointWideInteger<numberOfLimbs, isSigned> &other) const;
+};
+/**
+ * @brief Whether a type is a FixedPointWideInteger, used to pick wide-integer algorithms over native operators.
+ * @tparam Integer
+ */
+template<typename Integer>
+inline constexpr bool fixedPointIsWideInteger = false;
+template<int numberOfLimbs, bool isSigned>
+inline constexpr bool fixedPointIsWideInteger<FixedPointWideInteger<numberOfLimbs, isSigned>> = true;
+/**
+ * @brief Multiply two limbs into a 128-bit result.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @param limb1
+ * @param limb2
+ * @param highLimb Receives the upper 64 bits of the product.
+ * @return uint64_t The lower 64 bits of the product.
+ */
+template <int numberOfLimbs, bool isSigned>
+constexpr uint64_t FixedPointWideInteger<numberOfLimbs, isSigned>::multiplyLimbs(uint64_t limb1, uint64_t limb2, uint64_t &highLimb)
+{
+#ifdef __SIZEOF_INT128__
+	FixedPointUInt128 product = static_cast<FixedPointUInt128>(limb1) * limb2;
+	highLimb = static_cast<uint64_t>(product >> 64);
+	return static_cast<uint64_t>(product);
+#else
+	uint64_t lowProduct = (limb1 & 0xFFFFFFFFu) * (limb2 & 0xFFFFFFFFu);
+	uint64_t middleProduct1 = (limb1 >> 32) * (limb2 & 0xFFFFFFFFu);
+	uint64_t middleProduct2 = (limb1 & 0xFFFFFFFFu) * (limb2 >> 32);
+	uint64_t highProduct = (limb1 >> 32) * (limb2 >> 32);
+	uint64_t middleSum = (lowProduct >> 32) + (middleProduct1 & 0xFFFFFFFFu) + (middleProduct2 & 0xFFFFFFFFu);
+	highLimb = highProduct + (middleProduct1 >> 32) + (middleProduct2 >> 32) + (middleSum >> 32);
+	return (middleSum << 32) | (lowProduct & 0xFFFFFFFFu);
+#endif
+}
+/**
+ * @brief Add two limbs and an incoming carry, as one add-with-carry instruction where available.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @param limb1
+ * @param limb2
+ * @param carry The incoming carry, 0 or 1; receives the outgoing carry.
+ * @return uint64_t The low 64 bits of the sum.
+ */
+template <int numberOfLimbs, bool isSigned>
+constexpr uint64_t FixedPointWideInteger<numberOfLimbs, isSigned>::addWithCarry(uint64_t limb1, uint64_t limb2, unsigned char &carry)
+{
+#if FIXEDPOINT_X86_64_CARRY_CHAINS
+	if (!std::is_constant_evaluated())
+	{
+		unsigned long long sum;
+		carry = _addcarry_u64(carry, limb1, limb2, &sum);
+		return sum;
+	}
+#endif
+	uint64_t partialSum = limb1 + carry;
+	uint64_t sum = partialSum + limb2;
+	carry = static_cast<unsigned char>((partialSum < limb1) | (sum < partialSum));
+	return sum;
+}
+/**
+ * @brief Subtract a limb and an incoming borrow from another limb, as one subtract-with-borrow instruction where
+ * available.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @param limb1
+ * @param limb2
+ * @param borrow The incoming borrow, 0 or 1; receives the outgoing borrow.
+ * @return uint64_t The low 64 bits of the difference.
+ */
+template <int numberOfLimbs, bool isSigned>
+constexpr uint64_t FixedPointWideInteger<numberOfLimbs, isSigned>::subtractWithBorrow(uint64_t limb1, uint64_t limb2, unsigned char &borrow)
+{
+#if FIXEDPOINT_X86_64_CARRY_CHAINS
+	if (!std::is_constant_evaluated())
+	{
+		unsigned long long difference;
+		borrow = _subborrow_u64(borrow, limb1, limb2, &difference);
+		return difference;
+	}
+#endif
+	uint64_t partialDifference = limb1 - borrow;
+	uint64_t difference = partialDifference - limb2;
+	borrow = static_cast<unsigned char>((limb1 < borrow) | (partialDifference < limb2));
+	return difference;
+}
+/**
+ * @brief Add one little-endian array of limbs into another with a single carry chain.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @param limbs Receives the sum.
+ * @param otherLimbs
+ * @param numberOfLimbsToAdd
+ * @return unsigned char The carry out of the most significant limb.
+ */
+template <int numberOfLimbs, bool isSigned>
+constexpr unsigned char FixedPointWideInteger<numberOfLimbs, isSigned>::addLimbArrays(uint64_t* limbs, const uint64_t* otherLimbs, int numberOfLimbsToAdd)
+{
+	unsigned char carry = 0;
+	for (int limbNumber = 0; limbNumber < numberOfLimbsToAdd; limbNumber++)
+	{
+		limbs[limbNumber] = addWithCarry(limbs[limbNumber], otherLimbs[limbNumber], carry);
+	}
+	return carry;
+}
+/**
+ * @brief Subtract one little-endian array of limbs from another with a single borrow chain.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @param limbs Receives the difference.
+ * @param otherLimbs
+ * @param numberOfLimbsToSubtract
+ * @return unsigned char The borrow out of the most significant limb.
+ */
+template <int numberOfLimbs, bool isSigned>
+constexpr unsigned char FixedPointWideInteger<numberOfLimbs, isSigned>::subtractLimbArrays(uint64_t* limbs, const uint64_t* otherLimbs, int numberOfLimbsToSubtract)
+{
+	unsigned char borrow = 0;
+	for (int limbNumber = 0; limbNumber < numberOfLimbsToSubtract; limbNumber++)
+	{
+		limbs[limbNumber] = subtractWithBorrow(limbs[limbNumber], otherLimbs[limbNumber], borrow);
+	}
+	return borrow;
+}
+/**
+ * @brief Multiply two unsigned arrays of limbs into their full double-length product.
+ * @details Below karatsubaThreshold limbs, and for odd lengths, this is schoolbook multiplication. Above it, the
+ * operands are split into halves a1 * 2^(64h) + a0 and b1 * 2^(64h) + b0, and the middle term a0 * b1 + a1 * b0 is
+ * recovered from a0 * b0, a1 * b1 and |a0 - a1| * |b1 - b0|, so three half-length products replace four.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @tparam numberOfOperandLimbs Number of limbs of each operand.
+ * @param limbs1
+ * @param limbs2
+ * @param productLimbs Receives 2 * numberOfOperandLimbs limbs; must not overlap the operands.
+ */
+template <int numberOfLimbs, bool isSigned>
+template <int numberOfOperandLimbs>
+constexpr void FixedPointWideInteger<numberOfLimbs, isSigned>::multiplyLimbArrays(const uint64_t* limbs1, const uint64_t* limbs2, uint64_t* productLimbs)
+{
+	if constexpr (numberOfOperandLimbs < karatsubaThreshold || numberOfOperandLimbs % 2 != 0)
+	{
+		for (int limbNumber = 0; limbNumber < 2 * numberOfOperandLimbs; limbNumber++)
+		{
+			productLimbs[limbNumber] = 0;
+		}
+		for (int limbNumber1 = 0; limbNumber1 < numberOfOperandLimbs; limbNumber1++)
+		{
+			uint64_t carry = 0;
+			for (int limbNumber2 = 0; limbNumber2 < numberOfOperandLimbs; limbNumber2++)
+			{
+				uint64_t highLimb;
+				uint64_t lowLimb = multiplyLimbs(limbs1[limbNumber1], limbs2[limbNumber2], highLimb);
+				lowLimb += carry;
+				highLimb += lowLimb < carry;
+				productLimbs[limbNumber1 + limbNumber2] += lowLimb;
+				highLimb += productLimbs[limbNumber1 + limbNumber2] < lowLimb;
+				carry = highLimb;
+			}
+			productLimbs[limbNumber1 + numberOfOperandLimbs] = carry;
+		}
+	}
+	else
+	{
+		constexpr int numberOfHalfLimbs = numberOfOperandLimbs / 2;
+		multiplyLimbArrays<numberOfHalfLimbs>(limbs1, limbs2, productLimbs);
+		multiplyLimbArrays<numberOfHalfLimbs>(limbs1 + numberOfHalfLimbs, limbs2 + numberOfHalfLimbs, productLimbs + numberOfOperandLimbs);
+		uint64_t difference1[numberOfHalfLimbs];
+		uint64_t difference2[numberOfHalfLimbs];
+		bool isDifference1Negative = false;
+		bool isDifference2Negative = false;
+		for (int limbNumber = 0; limbNumber < numberOfHalfLimbs; limbNumber++)
+		{
+			difference1[limbNumber] = limbs1[limbNumber];
+			difference2[limbNumber] = limbs2[numberOfHalfLimbs + limbNumber];
+		}
+		if (subtractLimbArrays(difference1, limbs1 + numberOfHalfLimbs, numberOfHalfLimbs) != 0)
+		{
+			isDifference1Negative = true;
+			for (int limbNumber = 0; limbNumber < numberOfHalfLimbs; limbNumber++)
+			{
+				difference1[limbNumber] = limbs1[numberOfHalfLimbs + limbNumber];
+			}
+			subtractLimbArrays(difference1, limbs1, numberOfHalfLimbs);
+		}
+		if (subtractLimbArrays(difference2, limbs2, numberOfHalfLimbs) != 0)
+		{
+			isDifference2Negative = true;
+			for (int limbNumber = 0; limbNumber < numberOfHalfLimbs; limbNumber++)
+			{
+				difference2[limbNumber] = limbs2[limbNumber];
+			}
+			subtractLimbArrays(difference2, limbs2 + numberOfHalfLimbs, numberOfHalfLimbs);
+		}
+		uint64_t middleLimbs[numberOfOperandLimbs + 1];
+		uint64_t differenceProduct[numberOfOperandLimbs];
+		for (int limbNumber = 0; limbNumber < numberOfOperandLimbs; limbNumber++)
+		{
+			middleLimbs[limbNumber] = productLimbs[limbNumber];
+		}
+		middleLimbs[numberOfOperandLimbs] = addLimbArrays(middleLimbs, productLimbs + numberOfOperandLimbs, numberOfOperandLimbs);
+		multiplyLimbArrays<numberOfHalfLimbs>(difference1, difference2, differenceProduct);
+		if (isDifference1Negative == isDifference2Negative)
+		{
+			middleLimbs[numberOfOperandLimbs] += addLimbArrays(middleLimbs, differenceProduct, numberOfOperandLimbs);
+		}
+		else
+		{
+			middleLimbs[numberOfOperandLimbs] -= subtractLimbArrays(middleLimbs, differenceProduct, numberOfOperandLimbs);
+		}
+		unsigned char carry = addLimbArrays(productLimbs + numberOfHalfLimbs, middleLimbs, numberOfOperandLimbs + 1);
+		for (int limbNumber = numberOfHalfLimbs + numberOfOperandLimbs + 1; limbNumber < 2 * numberOfOperandLimbs; limbNumber++)
+		{
+			productLimbs[limbNumber] = addWithCarry(productLimbs[limbNumber], 0, carry);
+		}
+	}
+}
+/**
+ * @brief Compare two wide integers as unsigned values.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @param value1
+ * @param value2
+ * @return true If value1 is less than value2.
+ * @return false Otherwise.
+ */
+template <int numberOfLimbs, bool isSigned>
+constexpr bool FixedPointWideInteger<numberOfLimbs, isSigned>::isLessUnsigned(const FixedPointWideInteger<numberOfLimbs, isSigned> &value1, const FixedPointWideInteger<numberOfLimbs, isSigned> &value2)
+{
+	for (int limbNumber = numberOfLimbs - 1; limbNumber >= 0; limbNumber--)
+	{
+		if (value1.limbs[limbNumber] != value2.limbs[limbNumber])
+		{
+			return value1.limbs[limbNumber] < value2.limbs[limbNumber];
+		}
+	}
+	return false;
+}
+#ifdef __SIZEOF_INT128__
+/**
+ * @brief Divide a two-limb value by a limb whose quotient fits in one limb, as one divide instruction where available.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @param highLimb Must be less than divisor.
+ * @param lowLimb
+ * @param divisor Must not be zero.
+ * @param remainder Receives the remainder.
+ * @return uint64_t The quotient.
+ */
+template <int numberOfLimbs, bool isSigned>
+constexpr uint64_t FixedPointWideInteger<numberOfLimbs, isSigned>::divideLimbs(uint64_t highLimb, uint64_t lowLimb, uint64_t divisor, uint64_t &remainder)
+{
+#if FIXEDPOINT_X86_64_CARRY_CHAINS
+	if (!std::is_constant_evaluated())
+	{
+		uint64_t quotient;
+		__asm__("divq %4" : "=a"(quotient), "=d"(remainder) : "a"(lowLimb), "d"(highLimb), "rm"(divisor));
+		return quotient;
+	}
+#endif
+	FixedPointUInt128 dividend = (static_cast<FixedPointUInt128>(highLimb) << 64) | lowLimb;
+	remainder = static_cast<uint64_t>(dividend % divisor);
+	return static_cast<uint64_t>(dividend / divisor);
+}
+#endif
+/**
+ * @brief Divide two wide integers as unsigned values.
+ * @details A divisor that fits in one limb, such as the powers of ten used for formatting, takes a short division with
+ * one 128-by-64-bit division per limb. Other divisors use Knuth's algorithm D: both operands are normalised so the
+ * divisor's top bit is set, then each quotient limb is estimated from the top two dividend limbs, corrected at most
+ * twice, and confirmed by a multiply-and-subtract pass. Without 128-bit integers this falls back to restoring long
+ * division, which runs 64 * numberOfLimbs iterations.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @param dividend
+ * @param divisor Must not be zero.
+ * @param quotient Receives the quotient rounded toward zero.
+ * @param remainder Receives the remainder.
+ */
+template <int numberOfLimbs, bool isSigned>
+constexpr void FixedPointWideInteger<numberOfLimbs, isSigned>::divideUnsigned(const FixedPointWideInteger<numberOfLimbs, isSigned> &dividend, const FixedPointWideInteger<numberOfLimbs, isSigned> &divisor, FixedPointWideInteger<numberOfLimbs, isSigned> &quotient, FixedPointWideInteger<numberOfLimbs, isSigned> &remainder)
+{
+	quotient = FixedPointWideInteger<numberOfLimbs, isSigned>();
+	remainder = FixedPointWideInteger<numberOfLimbs, isSigned>();
+#ifdef __SIZEOF_INT128__
+	bool isSingleLimbDivisor = true;
+	for (int limbNumber = 1; limbNumber < numberOfLimbs; limbNumber++)
+	{
+		isSingleLimbDivisor = isSingleLimbDivisor && divisor.limbs[limbNumber] == 0;
+	}
+	if (isSingleLimbDivisor)
+	{
+		uint64_t remainderLimb = 0;
+		for (int limbNumber = numberOfLimbs - 1; limbNumber >= 0; limbNumber--)
+		{
+			quotient.limbs[limbNumber] = divideLimbs(remainderLimb, dividend.limbs[limbNumber], divisor.limbs[0], remainderLimb);
+		}
+		remainder.limbs[0] = remainderLimb;
+		return;
+	}
+	int divisorLength = numberOfLimbs;
+	while (divisor.limbs[divisorLength - 1] == 0)
+	{
+		divisorLength--;
+	}
+	int dividendLength = numberOfLimbs;
+	while (dividendLength > 0 && dividend.limbs[dividendLength - 1] == 0)
+	{
+		dividendLength--;
+	}
+	if (dividendLength < divisorLength)
+	{
+		remainder = dividend;
+		return;
+	}
+	int normalisationShift = 0;
+	while ((divisor.limbs[divisorLength - 1] << normalisationShift) >> 63 == 0)
+	{
+		normalisationShift++;
+	}
+	uint64_t normalisedDivisor[numberOfLimbs] = {};
+	uint64_t normalisedDividend[numberOfLimbs + 1] = {};
+	for (int limbNumber = divisorLength - 1; limbNumber >= 0; limbNumber--)
+	{
+		uint64_t lowerBits = limbNumber > 0 && normalisationShift > 0 ? divisor.limbs[limbNumber - 1] >> (64 - normalisationShift) : 0;
+		normalisedDivisor[limbNumber] = (divisor.limbs[limbNumber] << normalisationShift) | lowerBits;
+	}
+	normalisedDividend[dividendLength] = normalisationShift > 0 ? dividend.limbs[dividendLength - 1] >> (64 - normalisationShift) : 0;
+	for (int limbNumber = dividendLength - 1; limbNumber >= 0; limbNumber--)
+	{
+		uint64_t lowerBits = limbNumber > 0 && normalisationShift > 0 ? dividend.limbs[limbNumber - 1] >> (64 - normalisationShift) : 0;
+		normalisedDividend[limbNumber] = (dividend.limbs[limbNumber] << normalisationShift) | lowerBits;
+	}
+	const uint64_t topDivisorLimb = normalisedDivisor[divisorLength - 1];
+	const uint64_t nextDivisorLimb = normalisedDivisor[divisorLength - 2];
+	for (int quotientLimbNumber = dividendLength - divisorLength; quotientLimbNumber >= 0; quotientLimbNumber--)
+	{
+		FixedPointUInt128 topDividendLimbs = (static_cast<FixedPointUInt128>(normalisedDividend[quotientLimbNumber + divisorLength]) << 64) | normalisedDividend[quotientLimbNumber + divisorLength - 1];
+		FixedPointUInt128 quotientEstimate = topDividendLimbs / topDivisorLimb;
+		FixedPointUInt128 remainderEstimate = topDividendLimbs % topDivisorLimb;
+		while ((quotientEstimate >> 64) != 0 || quotientEstimate * nextDivisorLimb > ((remainderEstimate << 64) | normalisedDividend[quotientLimbNumber + divisorLength - 2]))
+		{
+			quotientEstimate--;
+			remainderEstimate += topDivisorLimb;
+			if ((remainderEstimate >> 64) != 0)
+			{
+				break;
+			}
+		}
+		uint64_t quotientLimb = static_cast<uint64_t>(quotientEstimate);
+		uint64_t productCarry = 0;
+		unsigned char borrow = 0;
+		for (int limbNumber = 0; limbNumber < divisorLength; limbNumber++)
+		{
+			FixedPointUInt128 product = static_cast<FixedPointUInt128>(quotientLimb) * normalisedDivisor[limbNumber] + productCarry;
+			productCarry = static_cast<uint64_t>(product >> 64);
+			normalisedDividend[quotientLimbNumber + limbNumber] = subtractWithBorrow(normalisedDividend[quotientLimbNumber + limbNumber], static_cast<uint64_t>(product), borrow);
+		}
+		normalisedDividend[quotientLimbNumber + divisorLength] = subtractWithBorrow(normalisedDividend[quotientLimbNumber + divisorLength], productCarry, borrow);
+		if (borrow != 0)
+		{
+			quotientLimb--;
+			unsigned char carry = 0;
+			for (int limbNumber = 0; limbNumber < divisorLength; limbNumber++)
+			{
+				normalisedDividend[quotientLimbNumber + limbNumber] = addWithCarry(normalisedDividend[quotientLimbNumber + limbNumber], normalisedDivisor[limbNumber], carry);
+			}
+			normalisedDividend[quotientLimbNumber + divisorLength] += carry;
+		}
+		quotient.limbs[quotientLimbNumber] = quotientLimb;
+	}
+	for (int limbNumber = 0; limbNumber < divisorLength; limbNumber++)
+	{
+		uint64_t upperBits = normalisationShift > 0 ? normalisedDividend[limbNumber + 1] << (64 - normalisationShift) : 0;
+		remainder.limbs[limbNumber] = (normalisedDividend[limbNumber] >> normalisationShift) | upperBits;
+	}
+#else
+	for (int bitNumber = 64 * numberOfLimbs - 1; bitNumber >= 0; bitNumber--)
+	{
+		bool carryOut = (remainder.limbs[numberOfLimbs - 1] >> 63) != 0;
+		remainder = remainder << 1;
+		remainder.limbs[0] |= (dividend.limbs[bitNumber / 64] >> (bitNumber % 64)) & 1;
+		if (carryOut || !isLessUnsigned(remainder, divisor))
+		{
+			remainder = remainder - divisor;
+			quotient.limbs[bitNumber / 64] |= static_cast<uint64_t>(1) << (bitNumber % 64);
+		}
+	}
+#endif
+}
+/**
+ * @brief Construct a new Fixed Point Wide Integer object from a native integer, sign-extending signed values.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @tparam Integer A native integer type of at most 128 bits.
+ * @param value
+ */
+template <int numberOfLimbs, bool isSigned>
+template <typename Integer>
+	requires (!std::is_class_v<Integer> && !std::is_floating_point_v<Integer>)
+constexpr FixedPointWideInteger<numberOfLimbs, isSigned>::FixedPointWideInteger(Integer value)
+{
+	bool isValueNegative = value < static_cast<Integer>(0);
+	uint64_t extensionLimb = isValueNegative ? ~static_cast<uint64_t>(0) : 0;
+	this->limbs[0] = static_cast<uint64_t>(value);
+	if constexpr (sizeof(Integer) > sizeof(uint64_t))
+	{
+		this->limbs[1] = static_cast<uint64_t>(value >> 64);
+	}
+	else
+	{
+		this->limbs[1] = extensionLimb;
+	}
+	for (int limbNumber = 2; limbNumber < numberOfLimbs; limbNumber++)
+	{
+		this->limbs[limbNumber] = extensionLimb;
+	}
+}
+/**
+ * @brief Construct a new Fixed Point Wide Integer object from another wide integer, keeping the low limbs or extending
+ * with the sign of the source as native conversions do.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @tparam otherNumberOfLimbs
+ * @tparam otherIsSigned
+ * @param value
+ */
+template <int numberOfLimbs, bool isSigned>
+template <int otherNumberOfLimbs, bool otherIsSigned>
+constexpr FixedPointWideInteger<numberOfLimbs, isSigned>::FixedPointWideInteger(const FixedPointWideInteger<otherNumberOfLimbs, otherIsSigned> &value)
+{
+	uint64_t extensionLimb = value.isNegative() ? ~static_cast<uint64_t>(0) : 0;
+	for (int limbNumber = 0; limbNumber < numberOfLimbs; limbNumber++)
+	{
+		this->limbs[limbNumber] = limbNumber < otherNumberOfLimbs ? value.limbs[limbNumber] : extensionLimb;
+	}
+}
+/**
+ * @brief Construct a new Fixed Point Wide Integer object from a double, rounding toward zero as native conversions do.
+ * @details Each limb is peeled off the magnitude with a division and a subtraction by a power of two, both exact.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @param value Must be finite and within the range of the type.
+ */
+template <int numberOfLimbs, bool isSigned>
+constexpr FixedPointWideInteger<numberOfLimbs, isSigned>::FixedPointWideInteger(double value)
+{
+	double magnitude = value < 0.0 ? -value : value;
+	double limbScale = 1.0;
+	for (int limbNumber = 1; limbNumber < numberOfLimbs; limbNumber++)
+	{
+		limbScale *= 18446744073709551616.0;
+	}
+	for (int limbNumber = numberOfLimbs - 1; limbNumber >= 0; limbNumber--)
+	{
+		double limbValue = magnitude / limbScale;
+		this->limbs[limbNumber] = limbValue < 1.0 ? 0 : static_cast<uint64_t>(limbValue);
+		magnitude -= static_cast<double>(this->limbs[limbNumber]) * limbScale;
+		limbScale /= 18446744073709551616.0;
+	}
+	if (value < 0.0)
+	{
+		*this = -(*this);
+	}
+}
+/**
+ * @brief Convert to a native integer, keeping only the low bits that fit.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @tparam Integer A native integer type of at most 128 bits.
+ * @return Integer
+ */
+template <int numberOfLimbs, bool isSigned>
+template <typename Integer>
+	requires (!std::is_class_v<Integer> && !std::is_floating_point_v<Integer>)
+constexpr FixedPointWideInteger<numberOfLimbs, isSigned>::operator Integer() const
+{
+	if constexpr (sizeof(Integer) > sizeof(uint64_t))
+	{
+#ifdef __SIZEOF_INT128__
+		return static_cast<Integer>((static_cast<FixedPointUInt128>(this->limbs[1]) << 64) | this->limbs[0]);
+#endif
+	}
+	else
+	{
+		return static_cast<Integer>(this->limbs[0]);
+	}
+}
+/**
+ * @brief Get one 64-bit limb of the two's complement representation.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @param limbNumber Index of the limb, 0 being the least significant.
+ * @return uint64_t
+ */
+template <int numberOfLimbs, bool isSigned>
+constexpr uint64_t FixedPointWideInteger<numberOfLimbs, isSigned>::getLimb(int limbNumber) const
+{
+	return this->limbs[limbNumber];
+}
+/**
+ * @brief Convert to the nearest double, ties to even, as native conversions do.
+ * @details The two most significant nonzero limbs of the magnitude are converted together, with any lower nonzero limb
+ * folded into their lowest bit so that it still breaks ties, and scaled by an exact power of two.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @return double
+ */
+template <int numberOfLimbs, bool isSigned>
+constexpr FixedPointWideInteger<numberOfLimbs, isSigned>::operator double() const
+{
+	FixedPointWideInteger<numberOfLimbs, isSigned> magnitude = this->isNegative() ? -(*this) : *this;
+	int topLimbNumber = numberOfLimbs - 1;
+	while (topLimbNumber > 1 && magnitude.limbs[topLimbNumber] == 0)
+	{
+		topLimbNumber--;
+	}
+	uint64_t stickyBit = 0;
+	for (int limbNumber = 0; limbNumber < topLimbNumber - 1; limbNumber++)
+	{
+		stickyBit |= magnitude.limbs[limbNumber] != 0;
+	}
+#ifdef __SIZEOF_INT128__
+	double result = static_cast<double>((static_cast<FixedPointUInt128>(magnitude.limbs[topLimbNumber]) << 64) | (magnitude.limbs[topLimbNumber - 1] | stickyBit));
+#else
+	double result = static_cast<double>(magnitude.limbs[topLimbNumber]) * 18446744073709551616.0 + static_cast<double>(magnitude.limbs[topLimbNumber - 1] | stickyBit);
+#endif
+	for (int limbNumber = 1; limbNumber < topLimbNumber; limbNumber++)
+	{
+		result *= 18446744073709551616.0;
+	}
+	return this->isNegative() ? -result : result;
+}
+/**
+ * @brief Multiply two wide integers into their exact double-width product.
+ * @details The operands are multiplied as unsigned limb arrays, with Karatsuba multiplication from karatsubaThreshold
+ * limbs. Reading a negative operand as unsigned adds 2^(64 * numberOfLimbs) times the other operand to the product, so
+ * for signed operands that term is subtracted back out of the upper half.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @param value1
+ * @param value2
+ * @return FixedPointWideInteger<2 * numberOfLimbs, isSigned>
+ */
+template <int numberOfLimbs, bool isSigned>
+constexpr FixedPointWideInteger<2 * numberOfLimbs, isSigned> FixedPointWideInteger<numberOfLimbs, isSigned>::multiplyFull(const FixedPointWideInteger<numberOfLimbs, isSigned> &value1, const FixedPointWideInteger<numberOfLimbs, isSigned> &value2)
+{
+	FixedPointWideInteger<2 * numberOfLimbs, isSigned> product{};
+	multiplyLimbArrays<numberOfLimbs>(value1.limbs, value2.limbs, product.limbs);
+	if (value1.isNegative())
+	{
+		subtractLimbArrays(product.limbs + numberOfLimbs, value2.limbs, numberOfLimbs);
+	}
+	if (value2.isNegative())
+	{
+		subtractLimbArrays(product.limbs + numberOfLimbs, value1.limbs, numberOfLimbs);
+	}
+	return product;
+}
+/**
+ * @brief Check if the wide integer is negative.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @return true
+ * @return false
+ */
+template <int numberOfLimbs, bool isSigned>
+constexpr bool FixedPointWideInteger<numberOfLimbs, isSigned>::isNegative() const
+{
+	return isSigned && (this->limbs[numberOfLimbs - 1] >> 63) != 0;
+}
+/**
+ * @brief Add two wide integers.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @param other
+ * @return FixedPointWideInteger<numberOfLimbs, isSigned>
+ */
+template <int numberOfLimbs, bool isSigned>
+constexpr FixedPointWideInteger<numberOfLimbs, isSigned> FixedPointWideInteger<numberOfLimbs, isSigned>::operator+(const FixedPointWideInteger<numberOfLimbs, isSigned> &other) const
+{
+	FixedPointWideInteger<numberOfLimbs, isSigned> sum = *this;
+	addLimbArrays(sum.limbs, other.limbs, numberOfLimbs);
+	return sum;
+}
+/**
+ * @brief Negate the wide integer.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @return FixedPointWideInteger<numberOfLimbs, isSigned>
+ */
+template <int numberOfLimbs, bool isSigned>
+constexpr FixedPointWideInteger<numberOfLimbs, isSigned> FixedPointWideInteger<numberOfLimbs, isSigned>::operator-() const
+{
+	return ~(*this) + FixedPointWideInteger<numberOfLimbs, isSigned>(1);
+}
+/**
+ * @brief Subtract another wide integer from this one.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @param other
+ * @return FixedPointWideInteger<numberOfLimbs, isSigned>
+ */
+template <int numberOfLimbs, bool isSigned>
+constexpr FixedPointWideInteger<numberOfLimbs, isSigned> FixedPointWideInteger<numberOfLimbs, isSigned>::operator-(const FixedPointWideInteger<numberOfLimbs, isSigned> &other) const
+{
+	FixedPointWideInteger<numberOfLimbs, isSigned> difference = *this;
+	subtractLimbArrays(difference.limbs, other.limbs, numberOfLimbs);
+	return difference;
+}
+/**
+ * @brief Multiply two wide integers, keeping the low numberOfLimbs limbs of the product.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @param other
+ * @return FixedPointWideInteger<numberOfLimbs, isSigned>
+ */
+template <int numberOfLimbs, bool isSigned>
+constexpr FixedPointWideInteger<numberOfLimbs, isSigned> FixedPointWideInteger<numberOfLimbs, isSigned>::operator*(const FixedPointWideInteger<numberOfLimbs, isSigned> &other) const
+{
+	FixedPointWideInteger<numberOfLimbs, isSigned> product{};
+	for (int limbNumber1 = 0; limbNumber1 < numberOfLimbs; limbNumber1++)
+	{
+		uint64_t carry = 0;
+		for (int limbNumber2 = 0; limbNumber1 + limbNumber2 < numberOfLimbs; limbNumber2++)
+		{
+			uint64_t highLimb;
+			uint64_t lowLimb = multiplyLimbs(this->limbs[limbNumber1], other.limbs[limbNumber2], highLimb);
+			lowLimb += carry;
+			highLimb += lowLimb < carry;
+			product.limbs[limbNumber1 + limbNumber2] += lowLimb;
+			highLimb += product.limbs[limbNumber1 + limbNumber2] < lowLimb;
+			carry = highLimb;
+		}
+	}
+	return product;
+}
+/**
+ * @brief Divide this wide integer by another, rounding the quotient toward zero.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @param other Must not be zero.
+ * @return FixedPointWideInteger<numberOfLimbs, isSigned>
+ */
+template <int numberOfLimbs, bool isSigned>
+constexpr FixedPointWideInteger<numberOfLimbs, isSigned> FixedPointWideInteger<numberOfLimbs, isSigned>::operator/(const FixedPointWideInteger<numberOfLimbs, isSigned> &other) const
+{
+	FixedPointWideInteger<numberOfLimbs, isSigned> quotient;
+	FixedPointWideInteger<numberOfLimbs, isSigned> remainder;
+	divideUnsigned(this->isNegative() ? -(*this) : *this, other.isNegative() ? -other : other, quotient, remainder);
+	return (this->isNegative() != other.isNegative()) ? -quotient : quotient;
+}
+/**
+ * @brief Calculate the remainder of division between two wide integers, taking the sign of the dividend.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @param other Must not be zero.
+ * @return FixedPointWideInteger<numberOfLimbs, isSigned>
+ */
+template <int numberOfLimbs, bool isSigned>
+constexpr FixedPointWideInteger<numberOfLimbs, isSigned> FixedPointWideInteger<numberOfLimbs, isSigned>::operator%(const FixedPointWideInteger<numberOfLimbs, isSigned> &other) const
+{
+	FixedPointWideInteger<numberOfLimbs, isSigned> quotient;
+	FixedPointWideInteger<numberOfLimbs, isSigned> remainder;
+	divideUnsigned(this->isNegative() ? -(*this) : *this, other.isNegative() ? -other : other, quotient, remainder);
+	return this->isNegative() ? -remainder : remainder;
+}
+/**
+ * @brief Shift the wide integer to the left by a specified amount.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @param amountToShift Number of bits, between 0 and 64 * numberOfLimbs - 1.
+ * @return FixedPointWideInteger<numberOfLimbs, isSigned>
+ */
+template <int numberOfLimbs, bool isSigned>
+constexpr FixedPointWideInteger<numberOfLimbs, isSigned> FixedPointWideInteger<numberOfLimbs, isSigned>::operator<<(const int amountToShift) const
+{
+	FixedPointWideInteger<numberOfLimbs, isSigned> shiftedValue{};
+	int limbShift = amountToShift / 64;
+	int bitShift = amountToShift % 64;
+	for (int limbNumber = numberOfLimbs - 1; limbNumber >= limbShift; limbNumber--)
+	{
+		shiftedValue.limbs[limbNumber] = this->limbs[limbNumber - limbShift] << bitShift;
+		if (bitShift != 0 && limbNumber - limbShift - 1 >= 0)
+		{
+			shiftedValue.limbs[limbNumber] |= this->limbs[limbNumber - limbShift - 1] >> (64 - bitShift);
+		}
+	}
+	return shiftedValue;
+}
+/**
+ * @brief Shift the wide integer to the right by a specified amount, arithmetically if it is signed and logically if not.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @param amountToShift Number of bits, between 0 and 64 * numberOfLimbs - 1.
+ * @return FixedPointWideInteger<numberOfLimbs, isSigned>
+ */
+template <int numberOfLimbs, bool isSigned>
+constexpr FixedPointWideInteger<numberOfLimbs, isSigned> FixedPointWideInteger<numberOfLimbs, isSigned>::operator>>(const int amountToShift) const
+{
+	FixedPointWideInteger<numberOfLimbs, isSigned> shiftedValue;
+	uint64_t extensionLimb = this->isNegative() ? ~static_cast<uint64_t>(0) : 0;
+	int limbShift = amountToShift / 64;
+	int bitShift = amountToShift % 64;
+	for (int limbNumber = 0; limbNumber < numberOfLimbs; limbNumber++)
+	{
+		uint64_t lowerLimb = (limbNumber + limbShift < numberOfLimbs) ? this->limbs[limbNumber + limbShift] : extensionLimb;
+		uint64_t upperLimb = (limbNumber + limbShift + 1 < numberOfLimbs) ? this->limbs[limbNumber + limbShift + 1] : extensionLimb;
+		shiftedValue.limbs[limbNumber] = (bitShift == 0) ? lowerLimb : ((lowerLimb >> bitShift) | (upperLimb << (64 - bitShift)));
+	}
+	return shiftedValue;
+}
+/**
+ * @brief Bitwise NOT operation on the wide integer.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @return FixedPointWideInteger<numberOfLimbs, isSigned>
+ */
+template <int numberOfLimbs, bool isSigned>
+constexpr FixedPointWideInteger<numberOfLimbs, isSigned> FixedPointWideInteger<numberOfLimbs, isSigned>::operator~() const
+{
+	FixedPointWideInteger<numberOfLimbs, isSigned> result;
+	for (int limbNumber = 0; limbNumber < numberOfLimbs; limbNumber++)
+	{
+		result.limbs[limbNumber] = ~this->limbs[limbNumber];
+	}
+	return result;
+}
+/**
+ * @brief Bitwise AND operation on the wide integer.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @param other
+ * @return FixedPointWideInteger<numberOfLimbs, isSigned>
+ */
+template <int numberOfLimbs, bool isSigned>
+constexpr FixedPointWideInteger<numberOfLimbs, isSigned> FixedPointWideInteger<numberOfLimbs, isSigned>::operator&(const FixedPointWideInteger<numberOfLimbs, isSigned> &other) const
+{
+	FixedPointWideInteger<numberOfLimbs, isSigned> result;
+	for (int limbNumber = 0; limbNumber < numberOfLimbs; limbNumber++)
+	{
+		result.limbs[limbNumber] = this->limbs[limbNumber] & other.limbs[limbNumber];
+	}
+	return result;
+}
+/**
+ * @brief Bitwise OR operation on the wide integer.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @param other
+ * @return FixedPointWideInteger<numberOfLimbs, isSigned>
+ */
+template <int numberOfLimbs, bool isSigned>
+constexpr FixedPointWideInteger<numberOfLimbs, isSigned> FixedPointWideInteger<numberOfLimbs, isSigned>::operator|(const FixedPointWideInteger<numberOfLimbs, isSigned> &other) const
+{
+	FixedPointWideInteger<numberOfLimbs, isSigned> result;
+	for (int limbNumber = 0; limbNumber < numberOfLimbs; limbNumber++)
+	{
+		result.limbs[limbNumber] = this->limbs[limbNumber] | other.limbs[limbNumber];
+	}
+	return result;
+}
+/**
+ * @brief Bitwise XOR operation on the wide integer.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @param other
+ * @return FixedPointWideInteger<numberOfLimbs, isSigned>
+ */
+template <int numberOfLimbs, bool isSigned>
+constexpr FixedPointWideInteger<numberOfLimbs, isSigned> FixedPointWideInteger<numberOfLimbs, isSigned>::operator^(const FixedPointWideInteger<numberOfLimbs, isSigned> &other) const
+{
+	FixedPointWideInteger<numberOfLimbs, isSigned> result;
+	for (int limbNumber = 0; limbNumber < numberOfLimbs; limbNumber++)
+	{
+		result.limbs[limbNumber] = this->limbs[limbNumber] ^ other.limbs[limbNumber];
+	}
+	return result;
+}
+/**
+ * @brief Add another wide integer to this one in place, with a single carry chain.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @param other
+ * @return FixedPointWideInteger<numberOfLimbs, isSigned>&
+ */
+template <int numberOfLimbs, bool isSigned>
+constexpr FixedPointWideInteger<numberOfLimbs, isSigned>& FixedPointWideInteger<numberOfLimbs, isSigned>::operator+=(const FixedPointWideInteger<numberOfLimbs, isSigned> &other)
+{
+	addLimbArrays(this->limbs, other.limbs, numberOfLimbs);
+	return *this;
+}
+/**
+ * @brief Subtract another wide integer from this one in place, with a single borrow chain.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @param other
+ * @return FixedPointWideInteger<numberOfLimbs, isSigned>&
+ */
+template <int numberOfLimbs, bool isSigned>
+constexpr FixedPointWideInteger<numberOfLimbs, isSigned>& FixedPointWideInteger<numberOfLimbs, isSigned>::operator-=(const FixedPointWideInteger<numberOfLimbs, isSigned> &other)
+{
+	subtractLimbArrays(this->limbs, other.limbs, numberOfLimbs);
+	return *this;
+}
+/**
+ * @brief Bitwise AND assignment.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @param other
+ * @return FixedPointWideInteger<numberOfLimbs, isSigned>&
+ */
+template <int numberOfLimbs, bool isSigned>
+constexpr FixedPointWideInteger<numberOfLimbs, isSigned>& FixedPointWideInteger<numberOfLimbs, isSigned>::operator&=(const FixedPointWideInteger<numberOfLimbs, isSigned> &other)
+{
+	*this = *this & other;
+	return *this;
+}
+/**
+ * @brief Bitwise OR assignment.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @param other
+ * @return FixedPointWideInteger<numberOfLimbs, isSigned>&
+ */
+template <int numberOfLimbs, bool isSigned>
+constexpr FixedPointWideInteger<numberOfLimbs, isSigned>& FixedPointWideInteger<numberOfLimbs, isSigned>::operator|=(const FixedPointWideInteger<numberOfLimbs, isSigned> &other)
+{
+	*this = *this | other;
+	return *this;
+}
+/**
+ * @brief Bitwise XOR assignment.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @param other
+ * @return FixedPointWideInteger<numberOfLimbs, isSigned>&
+ */
+template <int numberOfLimbs, bool isSigned>
+constexpr FixedPointWideInteger<numberOfLimbs, isSigned>& FixedPointWideInteger<numberOfLimbs, isSigned>::operator^=(const FixedPointWideInteger<numberOfLimbs, isSigned> &other)
+{
+	*this = *this ^ other;
+	return *this;
+}
+/**
+ * @brief Check if two wide integers are equal.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @param other
+ * @return true
+ * @return false
+ */
+template <int numberOfLimbs, bool isSigned>
+constexpr bool FixedPointWideInteger<numberOfLimbs, isSigned>::operator==(const FixedPointWideInteger<numberOfLimbs, isSigned> &other) const
+{
+	for (int limbNumber = 0; limbNumber < numberOfLimbs; limbNumber++)
+	{
+		if (this->limbs[limbNumber] != other.limbs[limbNumber])
+		{
+			return false;
+		}
+	}
+	return true;
+}
+/**
+ * @brief Check if two wide integers are not equal.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @param other
+ * @return true
+ * @return false
+ */
+template <int numberOfLimbs, bool isSigned>
+constexpr bool FixedPointWideInteger<numberOfLimbs, isSigned>::operator!=(const FixedPointWideInteger<numberOfLimbs, isSigned> &other) const
+{
+	return !(*this == other);
+}
+/**
+ * @brief Check if this wide integer is less than another, comparing as signed or unsigned values according to isSigned.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @param other
+ * @return true
+ * @return false
+ */
+template <int numberOfLimbs, bool isSigned>
+constexpr bool FixedPointWideInteger<numberOfLimbs, isSigned>::operator<(const FixedPointWideInteger<numberOfLimbs, isSigned> &other) const
+{
+	if (this->isNegative() != other.isNegative())
+	{
+		return this->isNegative();
+	}
+	for (int limbNumber = numberOfLimbs - 1; limbNumber >= 0; limbNumber--)
+	{
+		if (this->limbs[limbNumber] != other.limbs[limbNumber])
+		{
+			return this->limbs[limbNumber] < other.limbs[limbNumber];
+		}
+	}
+	return false;
+}
+/**
+ * @brief Check if this wide integer is less than or equal to another.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @param other
+ * @return true
+ * @return false
+ */
+template <int numberOfLimbs, bool isSigned>
+constexpr bool FixedPointWideInteger<numberOfLimbs, isSigned>::operator<=(const FixedPointWideInteger<numberOfLimbs, isSigned> &other) const
+{
+	return !(other < *this);
+}
+/**
+ * @brief Check if this wide integer is greater than another.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @param other
+ * @return true
+ * @return false
+ */
+template <int numberOfLimbs, bool isSigned>
+constexpr bool FixedPointWideInteger<numberOfLimbs, isSigned>::operator>(const FixedPointWideInteger<numberOfLimbs, isSigned> &other) const
+{
+	return other < *this;
+}
+/**
+ * @brief Check if this wide integer is greater than or equal to another.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @param other
+ * @return true
+ * @return false
+ */
+template <int numberOfLimbs, bool isSigned>
+constexpr bool FixedPointWideInteger<numberOfLimbs, isSigned>::operator>=(const FixedPointWideInteger<numberOfLimbs, isSigned> &other) const
+{
+	return !(*this < other);
+}
+/**
+ * @brief Three-way comparison, ordering like the relational operators.
+ * @tparam numberOfLimbs
+ * @tparam isSigned
+ * @param other
+ * @return std::strong_ordering
+ */
+template <int numberOfLimbs, bool isSigned>
+constexpr std::strong_ordering FixedPointWideInteger<numberOfLimbs, isSigned>::operator<=>(const FixedPointWideInteger<numberOfLimbs, isSigned> &other) const
+{
+	if (*this < other)
+	{
+		return std::strong_ordering::less;
+	}
+	return *this == other ? std::strong_ordering::equal : std::strong_ordering::greater;
+}
+#endif